@@ -0,0 +1,93 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "benchmark_utilities.h"
+
+#include <cmath>
+#include <map>
+#include <mutex>
+
+namespace maliput {
+namespace object {
+namespace benchmarking {
+namespace {
+
+constexpr double kTolerance{1e-3};
+// Square meters per object.
+constexpr double kAreaPerObject{100.};
+constexpr unsigned int kSeed{42};
+
+}  // namespace
+
+double GetSideLength(int num_objects) { return std::sqrt(kAreaPerObject * num_objects); }
+
+generator::GeneratorConfig MakeGeneratorConfig(int num_objects) {
+  generator::GeneratorConfig config;
+  config.num_objects = num_objects;
+  config.seed = kSeed;
+  config.spatial_distribution = generator::SpatialDistribution::kUniform;
+  config.region_min = {0., 0., 0.};
+  config.region_max = {GetSideLength(num_objects), GetSideLength(num_objects), 0.};
+  config.min_box_size = {1., 1., 1.};
+  config.max_box_size = {3., 3., 3.};
+  config.tolerance = kTolerance;
+  config.num_properties = 1;
+  config.property_cardinality = 4;
+  return config;
+}
+
+std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> MakeObjects(int num_objects) {
+  return generator::GenerateObjects(MakeGeneratorConfig(num_objects));
+}
+
+const ManualObjectBook<maliput::math::Vector3>& GetObjectBook(int num_objects) {
+  static std::mutex mutex;
+  static std::map<int, std::unique_ptr<ManualObjectBook<maliput::math::Vector3>>> object_books;
+  std::lock_guard<std::mutex> lock(mutex);
+  std::unique_ptr<ManualObjectBook<maliput::math::Vector3>>& object_book = object_books[num_objects];
+  if (object_book == nullptr) {
+    object_book = std::make_unique<ManualObjectBook<maliput::math::Vector3>>(kTolerance);
+    object_book->AddObjects(MakeObjects(num_objects));
+  }
+  return *object_book;
+}
+
+std::string MakeYamlDocument(int num_objects) {
+  const std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> objects = MakeObjects(num_objects);
+  std::vector<const api::Object<maliput::math::Vector3>*> object_ptrs;
+  object_ptrs.reserve(objects.size());
+  for (const auto& object : objects) {
+    object_ptrs.push_back(object.get());
+  }
+  return generator::ToYamlDocument(object_ptrs);
+}
+
+}  // namespace benchmarking
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,71 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/generator/generator.h"
+
+namespace maliput {
+namespace object {
+namespace benchmarking {
+
+/// Number of objects the benchmarks that sweep the size of the book run with.
+constexpr int kMinNumObjects{1000};
+constexpr int kMaxNumObjects{1000000};
+
+/// @returns The side of the square the objects of MakeObjects() are spread over. It grows with @p num_objects so that
+///          every book has the same density of objects.
+double GetSideLength(int num_objects);
+
+/// @returns The configuration of MakeObjects(): @p num_objects boxes, with sides between 1 and 3 meters, uniformly
+///          spread over a square of GetSideLength(@p num_objects) meters. Every object has a `property_0` property out
+///          of four possible values.
+generator::GeneratorConfig MakeGeneratorConfig(int num_objects);
+
+/// Creates the objects described by MakeGeneratorConfig(@p num_objects).
+std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> MakeObjects(int num_objects);
+
+/// @returns A book holding MakeObjects(@p num_objects). Books are cached, so the cost of building them is paid once per
+///          process.
+const ManualObjectBook<maliput::math::Vector3>& GetObjectBook(int num_objects);
+
+/// @returns A `maliput_objects` YAML document describing MakeObjects(@p num_objects).
+std::string MakeYamlDocument(int num_objects);
+
+}  // namespace benchmarking
+}  // namespace object
+}  // namespace maliput
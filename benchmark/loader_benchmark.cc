@@ -0,0 +1,58 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utilities.h"
+#include "maliput_object/loader/loader.h"
+
+namespace maliput {
+namespace object {
+namespace benchmarking {
+namespace {
+
+// Loading is dominated by YAML parsing, so the largest documents are left out to keep the suite fast.
+constexpr int kMaxNumLoadedObjects{100000};
+
+void BM_Load(::benchmark::State& state) {
+  const std::string document = MakeYamlDocument(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(loader::Load(document));
+  }
+  state.SetBytesProcessed(state.iterations() * document.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Load)->RangeMultiplier(10)->Range(kMinNumObjects, kMaxNumLoadedObjects)->Unit(::benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,143 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "benchmark_utilities.h"
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/base/memory_usage.h"
+
+namespace maliput {
+namespace object {
+namespace benchmarking {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::OverlappingType;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr unsigned int kSeed{7};
+// Side of the query boxes, in meters.
+constexpr double kQuerySize{20.};
+
+void BM_ObjectBookFindById(::benchmark::State& state) {
+  const int num_objects = static_cast<int>(state.range(0));
+  const ManualObjectBook<Vector3>& object_book = GetObjectBook(num_objects);
+  std::mt19937 generator(kSeed);
+  std::uniform_int_distribution<int> index_distribution(0, num_objects - 1);
+  std::vector<api::Object<Vector3>::Id> ids;
+  for (int i = 0; i < 1024; ++i) {
+    ids.emplace_back("object_" + std::to_string(index_distribution(generator)));
+  }
+  std::size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(object_book.FindById(ids[i++ % ids.size()]));
+  }
+}
+BENCHMARK(BM_ObjectBookFindById)->RangeMultiplier(10)->Range(kMinNumObjects, kMaxNumObjects);
+
+void BM_ObjectBookFindByPredicate(::benchmark::State& state) {
+  const ManualObjectBook<Vector3>& object_book = GetObjectBook(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(object_book.FindByPredicate(
+        [](const api::Object<Vector3>* object) { return object->get_property("property_0") == "value_0"; }));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ObjectBookFindByPredicate)
+    ->RangeMultiplier(10)
+    ->Range(kMinNumObjects, kMaxNumObjects)
+    ->Unit(::benchmark::kMillisecond);
+
+// Arguments are the number of objects and the OverlappingType.
+void BM_ObjectBookFindOverlappingIn(::benchmark::State& state) {
+  const int num_objects = static_cast<int>(state.range(0));
+  const OverlappingType overlapping_type = static_cast<OverlappingType>(state.range(1));
+  const ManualObjectBook<Vector3>& object_book = GetObjectBook(num_objects);
+  std::mt19937 generator(kSeed);
+  std::uniform_real_distribution<double> position_distribution(0., GetSideLength(num_objects));
+  std::vector<BoundingBox> regions;
+  for (int i = 0; i < 64; ++i) {
+    regions.emplace_back(Vector3(position_distribution(generator), position_distribution(generator), 0.),
+                         Vector3(kQuerySize, kQuerySize, kQuerySize), RollPitchYaw(0., 0., 0.), 1e-3);
+  }
+  std::size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(object_book.FindOverlappingIn(regions[i++ % regions.size()], overlapping_type));
+  }
+}
+BENCHMARK(BM_ObjectBookFindOverlappingIn)
+    ->ArgsProduct({::benchmark::CreateRange(kMinNumObjects, kMaxNumObjects, 10),
+                   {static_cast<int>(OverlappingType::kIntersected), static_cast<int>(OverlappingType::kContained),
+                    static_cast<int>(OverlappingType::kDisjointed)}})
+    ->ArgNames({"num_objects", "overlapping_type"})
+    ->Unit(::benchmark::kMicrosecond);
+
+void BM_ObjectBookObjects(::benchmark::State& state) {
+  const ManualObjectBook<Vector3>& object_book = GetObjectBook(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(object_book.objects());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ObjectBookObjects)
+    ->RangeMultiplier(10)
+    ->Range(kMinNumObjects, kMaxNumObjects)
+    ->Unit(::benchmark::kMillisecond);
+
+// Reports the memory used by the book as counters, so regressions show up next to the timings.
+void BM_ObjectBookMemoryUsage(::benchmark::State& state) {
+  const ManualObjectBook<Vector3>& object_book = GetObjectBook(static_cast<int>(state.range(0)));
+  MemoryUsageReport report;
+  for (auto _ : state) {
+    report = object_book.MemoryUsage();
+  }
+  state.counters["bytes_total"] = static_cast<double>(report.total());
+  state.counters["bytes_index"] = static_cast<double>(report.index);
+  state.counters["bytes_per_object"] = static_cast<double>(report.total()) / static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_ObjectBookMemoryUsage)
+    ->RangeMultiplier(10)
+    ->Range(kMinNumObjects, kMaxNumObjects)
+    ->Unit(::benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace object
+}  // namespace maliput
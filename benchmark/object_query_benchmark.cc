@@ -0,0 +1,148 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <maliput/api/road_network.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/vector.h>
+#include <maliput/plugin/create_road_network.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/base/simple_object_query.h"
+#include "maliput_object/generator/generator.h"
+
+namespace maliput {
+namespace object {
+namespace benchmarking {
+namespace {
+
+using maliput::math::OverlappingType;
+using maliput::math::Vector3;
+
+constexpr int kNumLanes{4};
+constexpr double kLength{1000.};
+constexpr double kLaneWidth{3.7};
+constexpr int kNumObjects{1000};
+constexpr unsigned int kSeed{42};
+
+// Objects spread over a dragway, the query under benchmark and the road network it runs on.
+struct Scenario {
+  std::unique_ptr<maliput::api::RoadNetwork> road_network;
+  std::unique_ptr<ManualObjectBook<Vector3>> object_book;
+  std::unique_ptr<SimpleObjectQuery> object_query;
+  std::vector<const api::Object<Vector3>*> objects;
+};
+
+std::unique_ptr<Scenario> MakeScenario() {
+  auto scenario = std::make_unique<Scenario>();
+  scenario->road_network = maliput::plugin::CreateRoadNetwork(
+      "maliput_dragway", {{"num_lanes", std::to_string(kNumLanes)},
+                          {"length", std::to_string(kLength)},
+                          {"lane_width", std::to_string(kLaneWidth)},
+                          {"shoulder_width", "3."},
+                          {"maximum_height", "5."}});
+  generator::GeneratorConfig config;
+  config.num_objects = kNumObjects;
+  config.seed = kSeed;
+  config.spatial_distribution = generator::SpatialDistribution::kAlongLanes;
+  config.road_geometry = scenario->road_network->road_geometry();
+  config.min_box_size = {0.5, 0.5, 1.};
+  config.max_box_size = {3., 3., 1.};
+  config.max_yaw = 0.;
+  std::vector<std::unique_ptr<api::Object<Vector3>>> objects = generator::GenerateObjects(config);
+  for (const auto& object : objects) {
+    scenario->objects.push_back(object.get());
+  }
+  scenario->object_book = std::make_unique<ManualObjectBook<Vector3>>();
+  scenario->object_book->AddObjects(std::move(objects));
+  scenario->object_query =
+      std::make_unique<SimpleObjectQuery>(scenario->road_network.get(), scenario->object_book.get());
+  return scenario;
+}
+
+// @returns The scenario, built on first use, or nullptr when the dragway backend is not available. In that case the
+//          benchmark is skipped.
+const Scenario* GetScenario(::benchmark::State& state) {
+  static const std::unique_ptr<Scenario> scenario = []() -> std::unique_ptr<Scenario> {
+    try {
+      return MakeScenario();
+    } catch (const std::exception&) {
+      return nullptr;
+    }
+  }();
+  if (scenario == nullptr) {
+    state.SkipWithError("Unable to load the maliput_dragway road network.");
+  }
+  return scenario.get();
+}
+
+void BM_FindOverlappingLanesIn(::benchmark::State& state) {
+  const Scenario* scenario = GetScenario(state);
+  if (scenario == nullptr) {
+    return;
+  }
+  const OverlappingType overlapping_type = static_cast<OverlappingType>(state.range(0));
+  std::size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(scenario->object_query->FindOverlappingLanesIn(
+        scenario->objects[i++ % scenario->objects.size()], overlapping_type));
+  }
+}
+BENCHMARK(BM_FindOverlappingLanesIn)
+    ->Arg(static_cast<int>(OverlappingType::kIntersected))
+    ->Arg(static_cast<int>(OverlappingType::kContained))
+    ->Arg(static_cast<int>(OverlappingType::kDisjointed))
+    ->ArgName("overlapping_type")
+    ->Unit(::benchmark::kMicrosecond);
+
+void BM_Route(::benchmark::State& state) {
+  const Scenario* scenario = GetScenario(state);
+  if (scenario == nullptr) {
+    return;
+  }
+  const std::size_t num_objects = scenario->objects.size();
+  std::size_t i{0};
+  for (auto _ : state) {
+    const api::Object<Vector3>* origin = scenario->objects[i % num_objects];
+    const api::Object<Vector3>* target = scenario->objects[(i + num_objects / 2) % num_objects];
+    ::benchmark::DoNotOptimize(scenario->object_query->Route(origin, target));
+    ++i;
+  }
+}
+BENCHMARK(BM_Route)->Unit(::benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,81 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <optional>
+
+#include <maliput/math/bounding_region.h>
+
+#include "maliput_object/api/frustum.h"
+#include "maliput_object/api/ray.h"
+
+namespace maliput {
+namespace object {
+namespace api {
+
+/// Computes the distance from @p position to @p region.
+/// @param region The bounding region to measure the distance to. The distance to a maliput::math::BoundingBox is
+///        exact, whereas the distance to any other type of region is measured to its position.
+/// @param position The position to measure the distance from.
+/// @returns The distance, which is zero when @p region contains @p position.
+template <typename Coordinate>
+double ComputeDistance(const maliput::math::BoundingRegion<Coordinate>& region, const Coordinate& position);
+
+/// Computes the minimum distance between two regions.
+/// @param lhs One of the regions.
+/// @param rhs The other region.
+/// @returns The distance, which is zero when the regions overlap. The distance between two maliput::math::BoundingBox
+///          regions is exact: it is the smallest of the distances from the vertices of each box to the other one and
+///          of the distances between the edges of both boxes. When either region is of any other type, the distance
+///          is measured from its position to the other region.
+template <typename Coordinate>
+double ComputeDistance(const maliput::math::BoundingRegion<Coordinate>& lhs,
+                       const maliput::math::BoundingRegion<Coordinate>& rhs);
+
+/// Intersects @p region with @p ray.
+/// @param region The bounding region to intersect. Only maliput::math::BoundingBox regions can be hit.
+/// @param ray The ray to intersect @p region with. Its direction must be a unit vector.
+/// @returns The distance from the origin of @p ray to the point it enters @p region, or std::nullopt when @p ray
+///          misses @p region or the type of @p region is not supported.
+template <typename Coordinate>
+std::optional<double> ComputeRayIntersection(const maliput::math::BoundingRegion<Coordinate>& region,
+                                             const Ray<Coordinate>& ray);
+
+/// Checks whether @p region overlaps with @p frustum.
+/// @param region The bounding region to check. maliput::math::BoundingBox regions are culled against every plane of
+///        @p frustum, which is conservative. Any other type of region overlaps when its position is inside.
+/// @param frustum The convex volume to check @p region against.
+/// @returns True when @p region overlaps with @p frustum.
+template <typename Coordinate>
+bool OverlapsFrustum(const maliput::math::BoundingRegion<Coordinate>& region, const Frustum<Coordinate>& frustum);
+
+}  // namespace api
+}  // namespace object
+}  // namespace maliput
@@ -29,16 +29,24 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <maliput/common/maliput_copyable.h>
+#include <maliput/common/maliput_throw.h>
 #include <maliput/math/bounding_region.h>
 #include <maliput/math/overlapping_type.h>
 
+#include "maliput_object/api/frustum.h"
+#include "maliput_object/api/geometry.h"
 #include "maliput_object/api/object.h"
+#include "maliput_object/api/ray.h"
 
 namespace maliput {
 namespace object {
@@ -69,6 +77,26 @@ class ObjectBook {
     return DoFindByPredicate(predicate);
   }
 
+  /// Appends the Objects that make @p predicate true to @p result.
+  /// Implementations that override DoVisitByPredicate() do not allocate, so reusing @p result and @p predicate across
+  /// calls keeps steady-state queries free of heap allocations.
+  /// @param predicate Unary predicate for evaluating an object.
+  /// @param result Buffer the Objects are appended to. It is not cleared.
+  /// @throws maliput::common::assertion_error When @p result is nullptr.
+  void FindByPredicate(const std::function<bool(const Object<Coordinate>*)>& predicate,
+                       std::vector<Object<Coordinate>*>* result) const {
+    MALIPUT_THROW_UNLESS(result != nullptr);
+    DoVisitByPredicate(predicate, [result](Object<Coordinate>* object) { result->push_back(object); });
+  }
+
+  /// Calls @p visitor with every Object that makes @p predicate true.
+  /// @param predicate Unary predicate for evaluating an object.
+  /// @param visitor Function called once per Object found.
+  void VisitByPredicate(const std::function<bool(const Object<Coordinate>*)>& predicate,
+                        const std::function<void(Object<Coordinate>*)>& visitor) const {
+    DoVisitByPredicate(predicate, visitor);
+  }
+
   /// Finds the Objects that intersect with a @p region according to certain @p overlapping_type.
   /// @param region BoundaryRegion used for finding intersected Objects.
   /// @param overlapping_type Indicates type of overlapping. See #OverlappingType.
@@ -78,6 +106,113 @@ class ObjectBook {
     return DoFindOverlappingIn(region, overlapping_type);
   }
 
+  /// Appends the Objects that intersect with a @p region according to certain @p overlapping_type to @p result.
+  /// Implementations that override DoVisitOverlappingIn() do not allocate, so reusing @p result across calls keeps
+  /// steady-state queries free of heap allocations, other than the ones @p region may perform to compute overlaps.
+  /// @param region BoundaryRegion used for finding intersected Objects.
+  /// @param overlapping_type Indicates type of overlapping. See #OverlappingType.
+  /// @param result Buffer the Objects are appended to. It is not cleared.
+  /// @throws maliput::common::assertion_error When @p result is nullptr.
+  void FindOverlappingIn(const maliput::math::BoundingRegion<Coordinate>& region,
+                         const maliput::math::OverlappingType& overlapping_type,
+                         std::vector<Object<Coordinate>*>* result) const {
+    MALIPUT_THROW_UNLESS(result != nullptr);
+    DoVisitOverlappingIn(region, overlapping_type, [result](Object<Coordinate>* object) { result->push_back(object); });
+  }
+
+  /// Calls @p visitor with every Object that intersects with a @p region according to certain @p overlapping_type.
+  /// @param region BoundaryRegion used for finding intersected Objects.
+  /// @param overlapping_type Indicates type of overlapping. See #OverlappingType.
+  /// @param visitor Function called once per Object found.
+  void VisitOverlappingIn(const maliput::math::BoundingRegion<Coordinate>& region,
+                          const maliput::math::OverlappingType& overlapping_type,
+                          const std::function<void(Object<Coordinate>*)>& visitor) const {
+    DoVisitOverlappingIn(region, overlapping_type, visitor);
+  }
+
+  /// Finds the @p k Objects closest to @p position.
+  /// The distance to an Object is the distance from @p position to its bounding region, which is zero when the region
+  /// contains @p position. Implementations that cannot compute the distance to a type of region use the distance to
+  /// the region's position instead.
+  /// @param position Position to measure distances from.
+  /// @param k Maximum number of Objects to find.
+  /// @param predicate Optional unary predicate the Objects must make true. Every Object is considered when empty.
+  /// @returns Up to @p k Objects, sorted by increasing distance. Ties are sorted by id.
+  /// @throws maliput::common::assertion_error When @p k is negative.
+  std::vector<Object<Coordinate>*> FindNearest(const Coordinate& position, int k,
+                                               std::function<bool(const Object<Coordinate>*)> predicate = {}) const {
+    MALIPUT_THROW_UNLESS(k >= 0);
+    return DoFindNearest(position, k, predicate);
+  }
+
+  /// Finds the Objects within @p radius of @p position.
+  /// Distances are measured as in FindNearest().
+  /// @param position Position to measure distances from.
+  /// @param radius Non-negative maximum distance.
+  /// @returns The Objects whose distance to @p position is less than or equal to @p radius, sorted by increasing
+  ///          distance. Ties are sorted by id.
+  /// @throws maliput::common::assertion_error When @p radius is negative.
+  std::vector<Object<Coordinate>*> FindWithinDistance(const Coordinate& position, double radius) const {
+    MALIPUT_THROW_UNLESS(radius >= 0.);
+    return DoFindWithinDistance(position, radius);
+  }
+
+  /// Finds the first Object hit by a ray. Only the Objects whose bounding region is a maliput::math::BoundingBox can
+  /// be hit.
+  /// @param origin Position the ray starts at.
+  /// @param direction Non-zero direction of the ray.
+  /// @param max_range Non-negative length of the ray.
+  /// @returns The closest hit, or std::nullopt when the ray hits nothing. Ties are broken by id.
+  /// @throws maliput::common::assertion_error When @p direction is zero or @p max_range is negative.
+  std::optional<RayHit<Coordinate>> RayCast(const Coordinate& origin, const Coordinate& direction,
+                                            double max_range) const {
+    return RayCast(std::vector<Ray<Coordinate>>{{origin, direction, max_range}}).front();
+  }
+
+  /// Finds every Object hit by a ray. Only the Objects whose bounding region is a maliput::math::BoundingBox can be
+  /// hit.
+  /// @param origin Position the ray starts at.
+  /// @param direction Non-zero direction of the ray.
+  /// @param max_range Non-negative length of the ray.
+  /// @returns The hits, sorted by increasing distance. Ties are sorted by id.
+  /// @throws maliput::common::assertion_error When @p direction is zero or @p max_range is negative.
+  std::vector<RayHit<Coordinate>> RayCastAll(const Coordinate& origin, const Coordinate& direction,
+                                             double max_range) const {
+    return DoRayCastAll(Normalize({origin, direction, max_range}));
+  }
+
+  /// Finds the first Object hit by each ray of a packet. Casting many coherent rays at once, e.g. the beams of a lidar
+  /// sweep, lets implementations share the traversal of their spatial index among rays.
+  /// @param rays The rays to cast. See Ray.
+  /// @returns The closest hit of each ray, in the same order as @p rays. See RayCast().
+  /// @throws maliput::common::assertion_error When any ray has a zero direction or a negative range.
+  std::vector<std::optional<RayHit<Coordinate>>> RayCast(const std::vector<Ray<Coordinate>>& rays) const {
+    std::vector<Ray<Coordinate>> normalized_rays;
+    normalized_rays.reserve(rays.size());
+    for (const Ray<Coordinate>& ray : rays) {
+      normalized_rays.push_back(Normalize(ray));
+    }
+    std::vector<std::optional<RayHit<Coordinate>>> hits(rays.size());
+    DoRayCast(normalized_rays, &hits);
+    return hits;
+  }
+
+  /// Finds the Objects that overlap with a @p frustum. Objects whose bounding region is a maliput::math::BoundingBox
+  /// are culled against every plane of @p frustum, which is conservative: a box close to an edge of the frustum may
+  /// be reported even though it lies outside of it. Other Objects are reported when their position is inside.
+  /// @param frustum The convex volume to look Objects in.
+  /// @returns The Objects that overlap with @p frustum.
+  std::vector<Object<Coordinate>*> FindInFrustum(const Frustum<Coordinate>& frustum) const {
+    return DoFindInFrustum(frustum);
+  }
+
+  /// Finds every pair of Objects whose bounding regions overlap, i.e. are maliput::math::OverlappingType::kIntersected
+  /// with each other. It serves e.g. map validation and collision checks among the Objects of the book.
+  /// @returns The pairs, the Object with the smaller id first, sorted by the ids of their Objects.
+  std::vector<std::pair<Object<Coordinate>*, Object<Coordinate>*>> FindAllOverlappingPairs() const {
+    return DoFindAllOverlappingPairs();
+  }
+
  protected:
   ObjectBook() = default;
 
@@ -89,6 +224,126 @@ class ObjectBook {
   virtual std::vector<Object<Coordinate>*> DoFindOverlappingIn(
       const maliput::math::BoundingRegion<Coordinate>& region,
       const maliput::math::OverlappingType& overlapping_type) const = 0;
+  // By default, the distance, ray and frustum queries check every Object. Implementations are encouraged to override
+  // them with a spatial index.
+  virtual std::vector<Object<Coordinate>*> DoFindNearest(
+      const Coordinate& position, int k, const std::function<bool(const Object<Coordinate>*)>& predicate) const {
+    std::vector<Object<Coordinate>*> objects =
+        FindSortedByDistance(position, std::numeric_limits<double>::infinity(), predicate);
+    objects.resize(std::min(objects.size(), static_cast<std::size_t>(k)));
+    return objects;
+  }
+  virtual std::vector<Object<Coordinate>*> DoFindWithinDistance(const Coordinate& position, double radius) const {
+    return FindSortedByDistance(position, radius, {});
+  }
+  // Rays passed to DoRayCastAll() and DoRayCast() have a unit direction.
+  virtual std::vector<RayHit<Coordinate>> DoRayCastAll(const Ray<Coordinate>& ray) const {
+    std::vector<RayHit<Coordinate>> hits;
+    for (const auto& id_object : do_objects()) {
+      const std::optional<double> distance = ComputeRayIntersection(id_object.second->bounding_region(), ray);
+      if (distance.has_value()) {
+        hits.push_back({id_object.second, distance.value()});
+      }
+    }
+    std::sort(hits.begin(), hits.end(), IsCloserHit);
+    return hits;
+  }
+  // @p hits has as many elements as @p rays, all of them std::nullopt.
+  virtual void DoRayCast(const std::vector<Ray<Coordinate>>& rays,
+                         std::vector<std::optional<RayHit<Coordinate>>>* hits) const {
+    for (const auto& id_object : do_objects()) {
+      for (std::size_t i = 0; i < rays.size(); ++i) {
+        const std::optional<double> distance = ComputeRayIntersection(id_object.second->bounding_region(), rays[i]);
+        const RayHit<Coordinate> hit{id_object.second, distance.value_or(0.)};
+        if (distance.has_value() && (!(*hits)[i].has_value() || IsCloserHit(hit, (*hits)[i].value()))) {
+          (*hits)[i] = hit;
+        }
+      }
+    }
+  }
+  virtual std::vector<Object<Coordinate>*> DoFindInFrustum(const Frustum<Coordinate>& frustum) const {
+    std::vector<Object<Coordinate>*> objects;
+    for (const auto& id_object : do_objects()) {
+      if (OverlapsFrustum(id_object.second->bounding_region(), frustum)) {
+        objects.push_back(id_object.second);
+      }
+    }
+    return objects;
+  }
+
+  // @returns A copy of @p ray with a unit direction.
+  static Ray<Coordinate> Normalize(const Ray<Coordinate>& ray) {
+    const double norm = ray.direction.norm();
+    MALIPUT_THROW_UNLESS(norm > 0.);
+    MALIPUT_THROW_UNLESS(ray.max_range >= 0.);
+    return {ray.origin, ray.direction / norm, ray.max_range};
+  }
+  // @returns True when @p lhs is closer than @p rhs. Ties are broken by id.
+  static bool IsCloserHit(const RayHit<Coordinate>& lhs, const RayHit<Coordinate>& rhs) {
+    return lhs.distance != rhs.distance ? lhs.distance < rhs.distance
+                                        : lhs.object->id().string() < rhs.object->id().string();
+  }
+  // @returns The Objects within @p radius of @p position that make @p predicate true, or all of them when it is empty,
+  // sorted by increasing distance. Ties are sorted by id.
+  std::vector<Object<Coordinate>*> FindSortedByDistance(
+      const Coordinate& position, double radius,
+      const std::function<bool(const Object<Coordinate>*)>& predicate) const {
+    std::vector<std::pair<double, Object<Coordinate>*>> distance_objects;
+    for (const auto& id_object : do_objects()) {
+      if (predicate && !predicate(id_object.second)) {
+        continue;
+      }
+      const double distance = ComputeDistance(id_object.second->bounding_region(), position);
+      if (distance <= radius) {
+        distance_objects.emplace_back(distance, id_object.second);
+      }
+    }
+    std::sort(distance_objects.begin(), distance_objects.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.first != rhs.first ? lhs.first < rhs.first : lhs.second->id().string() < rhs.second->id().string();
+    });
+    std::vector<Object<Coordinate>*> objects;
+    objects.reserve(distance_objects.size());
+    for (const auto& distance_object : distance_objects) {
+      objects.push_back(distance_object.second);
+    }
+    return objects;
+  }
+  // Implementations are encouraged to override the visiting methods without allocating. By default they visit the
+  // results of DoFindByPredicate() and DoFindOverlappingIn().
+  virtual void DoVisitByPredicate(const std::function<bool(const Object<Coordinate>*)>& predicate,
+                                  const std::function<void(Object<Coordinate>*)>& visitor) const {
+    for (Object<Coordinate>* object : DoFindByPredicate(predicate)) {
+      visitor(object);
+    }
+  }
+  virtual void DoVisitOverlappingIn(const maliput::math::BoundingRegion<Coordinate>& region,
+                                    const maliput::math::OverlappingType& overlapping_type,
+                                    const std::function<void(Object<Coordinate>*)>& visitor) const {
+    for (Object<Coordinate>* object : DoFindOverlappingIn(region, overlapping_type)) {
+      visitor(object);
+    }
+  }
+  // By default, the Objects overlapping with every Object are looked up through DoVisitOverlappingIn(). Implementations
+  // are encouraged to override it with a broad phase that does not query once per Object.
+  virtual std::vector<std::pair<Object<Coordinate>*, Object<Coordinate>*>> DoFindAllOverlappingPairs() const {
+    std::vector<std::pair<Object<Coordinate>*, Object<Coordinate>*>> pairs;
+    for (const auto& id_object : do_objects()) {
+      Object<Coordinate>* object = id_object.second;
+      DoVisitOverlappingIn(object->bounding_region(), maliput::math::OverlappingType::kIntersected,
+                           [object, &pairs](Object<Coordinate>* other) {
+                             if (object->id().string() < other->id().string()) {
+                               pairs.emplace_back(object, other);
+                             }
+                           });
+    }
+    std::sort(pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) {
+      if (lhs.first->id() != rhs.first->id()) {
+        return lhs.first->id().string() < rhs.first->id().string();
+      }
+      return lhs.second->id().string() < rhs.second->id().string();
+    });
+    return pairs;
+  }
 };
 
 }  // namespace api
@@ -29,12 +29,20 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
 #include <maliput/api/road_network.h>
 #include <maliput/common/maliput_copyable.h>
+#include <maliput/common/maliput_throw.h>
 #include <maliput/math/overlapping_type.h>
 #include <maliput/math/vector.h>
 
@@ -45,6 +53,66 @@ namespace maliput {
 namespace object {
 namespace api {
 
+/// An Object found along a maliput::api::LaneSRoute. See ObjectQuery::FindObjectsAlongRoute().
+struct ObjectAlongRoute {
+  /// The Object.
+  const Object<maliput::math::Vector3>* object{};
+  /// Distance along the route, from its start, to the first point of the route the Object covers.
+  double route_s{};
+};
+
+/// The closest Object ahead of a position on one branch of the Lane graph. See ObjectQuery::FindNextObjectsAhead().
+struct ObjectAhead {
+  /// The Object.
+  const Object<maliput::math::Vector3>* object{};
+  /// Distance along the Lanes, from the position, to the first point of the branch the Object covers. It is zero when
+  /// the Object covers the position.
+  double gap{};
+  /// The Lane the Object was found on.
+  const maliput::api::Lane* lane{};
+};
+
+/// An Object near another one. See ObjectQuery::FindNearestNeighbors().
+struct ObjectDistance {
+  /// The Object.
+  const Object<maliput::math::Vector3>* object{};
+  /// Minimum distance between the bounding regions of both Objects. It is zero when they overlap.
+  double distance{};
+};
+
+/// Lateral clearance of an Object to a Lane near it. See ObjectQuery::FindLaneClearances().
+struct LaneClearance {
+  /// The Lane.
+  const maliput::api::Lane* lane{};
+  /// Distance from the Object to the left lane bound of #lane, along its r-coordinate. It is negative when the Object
+  /// crosses the bound.
+  double left{};
+  /// Distance from the Object to the right lane bound of #lane, along its r-coordinate. It is negative when the Object
+  /// crosses the bound.
+  double right{};
+};
+
+/// Objects for ObjectQuery::Route() to keep clear of, and how.
+struct RouteAvoidance {
+  /// How Route() treats the Lanes that blocking Objects overlap with.
+  enum class Mode {
+    /// Routes through a blocked Lane are discarded.
+    kExclude,
+    /// Routes through a blocked Lane are longer by #penalty per range on a blocked Lane.
+    kPenalize,
+  };
+
+  /// Unary predicate that makes true the blocking Objects, e.g. the ones whose "type" property is "barrier".
+  std::function<bool(const Object<maliput::math::Vector3>*)> predicate;
+  /// Identifies #predicate. Implementations may reuse the blocked Lanes found for a previous call with the same
+  /// non-empty key. When empty, the blocked Lanes are found on every call.
+  std::string cache_key;
+  /// How to treat the blocked Lanes.
+  Mode mode{Mode::kExclude};
+  /// Cost, in meters, of every range of a route on a blocked Lane when #mode is Mode::kPenalize.
+  double penalty{};
+};
+
 /// Interface to perform queries on top of Maliput's RoadNetwork about Objects.
 /// To match convention of underlying RoadNetwork, the query interface use maliput::math::Vector3
 /// as the specialization of the Coordinate template argument.
@@ -70,6 +138,31 @@ class ObjectQuery {
     return DoFindOverlappingLanesIn(object, overlapping_type);
   }
 
+  /// Appends the lanes overlapping according the @p overlapping_type with @p object to @p result.
+  /// Implementations that override DoVisitOverlappingLanesIn() may serve it without allocating, see their
+  /// documentation, so reusing @p result across calls keeps steady-state queries free of heap allocations.
+  /// @param object Object to find lanes overlapping with.
+  /// @param overlapping_type Type of overlapping to find.
+  /// @param result Buffer the lanes are appended to. It is not cleared.
+  /// @throws maliput::common::assertion_error When @p result is nullptr.
+  void FindOverlappingLanesIn(const Object<maliput::math::Vector3>* object,
+                              const maliput::math::OverlappingType& overlapping_type,
+                              std::vector<const maliput::api::Lane*>* result) const {
+    MALIPUT_THROW_UNLESS(result != nullptr);
+    DoVisitOverlappingLanesIn(object, overlapping_type,
+                              [result](const maliput::api::Lane* lane) { result->push_back(lane); });
+  }
+
+  /// Calls @p visitor with every lane overlapping according the @p overlapping_type with @p object.
+  /// @param object Object to find lanes overlapping with.
+  /// @param overlapping_type Type of overlapping to find.
+  /// @param visitor Function called once per lane found.
+  void VisitOverlappingLanesIn(const Object<maliput::math::Vector3>* object,
+                               const maliput::math::OverlappingType& overlapping_type,
+                               const std::function<void(const maliput::api::Lane*)>& visitor) const {
+    DoVisitOverlappingLanesIn(object, overlapping_type, visitor);
+  }
+
   /// Finds the route between @p origin and @p target objects.
   /// @param origin Object to find route from.
   /// @param target Object to find route to.
@@ -78,6 +171,140 @@ class ObjectQuery {
     return DoRoute(origin, target);
   }
 
+  /// Finds the route between @p origin and @p target objects that keeps clear of the Lanes blocked by Objects.
+  /// A Lane is blocked when an Object that makes RouteAvoidance::predicate true overlaps with it, see
+  /// FindOverlappingLanesIn(). The Lanes of @p origin and @p target are no exception.
+  /// @param origin Object to find route from.
+  /// @param target Object to find route to.
+  /// @param avoidance The blocking Objects and how to treat the Lanes they block.
+  /// @returns The shortest route that avoids the blocked Lanes, or the one with the lowest length plus penalties,
+  ///          depending on RouteAvoidance::mode. std::nullopt when there is none.
+  /// @throws maliput::common::assertion_error When RouteAvoidance::predicate is empty or RouteAvoidance::penalty is
+  ///         negative.
+  std::optional<const maliput::api::LaneSRoute> Route(const Object<maliput::math::Vector3>* origin,
+                                                      const Object<maliput::math::Vector3>* target,
+                                                      const RouteAvoidance& avoidance) const {
+    MALIPUT_THROW_UNLESS(avoidance.predicate != nullptr);
+    MALIPUT_THROW_UNLESS(avoidance.penalty >= 0.);
+    return DoRoute(origin, target, avoidance);
+  }
+
+  /// Finds the Objects on a Lane within a range of s-coordinates.
+  /// @param lane_id Id of the Lane.
+  /// @param s_range The range of s-coordinates, in either direction. It is closed.
+  /// @returns The Objects whose bounding region overlaps with the Lane within @p s_range, sorted by the minimum
+  ///          s-coordinate they cover on the Lane.
+  std::vector<const Object<maliput::math::Vector3>*> FindObjectsOnLane(const maliput::api::LaneId& lane_id,
+                                                                       const maliput::api::SRange& s_range) const {
+    return DoFindObjectsOnLane(lane_id, s_range);
+  }
+
+  /// Finds the free stretches of a Lane within a range of s-coordinates: the gaps between the Objects on it.
+  /// Objects block the Lane over the s-coordinates they cover, whatever their r-coordinates.
+  /// @param lane_id Id of the Lane.
+  /// @param s_range The range of s-coordinates, in either direction.
+  /// @param min_gap_length Minimum length of the gaps to find. It must not be negative.
+  /// @returns The gaps within @p s_range that are not shorter than @p min_gap_length and have a positive length, as
+  ///          ranges of increasing s-coordinates sorted by increasing s-coordinate.
+  /// @throws maliput::common::assertion_error When @p min_gap_length is negative.
+  std::vector<maliput::api::SRange> FindFreeGaps(const maliput::api::LaneId& lane_id,
+                                                 const maliput::api::SRange& s_range, double min_gap_length) const {
+    MALIPUT_THROW_UNLESS(min_gap_length >= 0.);
+    return DoFindFreeGaps(lane_id, s_range, min_gap_length);
+  }
+
+  /// Finds the Objects that overlap with the corridor of a route: its Lanes within their s-ranges, widened by
+  /// @p lateral_margin on both sides.
+  /// @param route The route, e.g. one returned by Route().
+  /// @param lateral_margin Distance the corridor extends beyond the bounds of the Lanes of @p route. It must not be
+  ///        negative.
+  /// @returns The Objects in the corridor, sorted by increasing ObjectAlongRoute::route_s. Every Object is reported
+  ///          once, at the first point of @p route it covers.
+  /// @throws maliput::common::assertion_error When @p lateral_margin is negative.
+  std::vector<ObjectAlongRoute> FindObjectsAlongRoute(const maliput::api::LaneSRoute& route,
+                                                      double lateral_margin) const {
+    MALIPUT_THROW_UNLESS(lateral_margin >= 0.);
+    return DoFindObjectsAlongRoute(route, lateral_margin);
+  }
+
+  /// Finds the closest Object ahead of @p road_position on every branch of the Lane graph within @p horizon.
+  /// The Lane graph is walked from @p road_position towards the increasing s-coordinate of its Lane, and on through the
+  /// ongoing branches of every maliput::api::BranchPoint it reaches. A branch ends at its closest Object or when
+  /// @p horizon is travelled.
+  /// @param road_position Position to look ahead from. Its Lane must not be nullptr.
+  /// @param horizon Maximum distance to travel along the Lanes. It must not be negative.
+  /// @param predicate Optional unary predicate the Objects must make true. Every Object is considered when empty. Use
+  ///        it to exclude e.g. the Object at @p road_position.
+  /// @returns The closest Objects, sorted by increasing ObjectAhead::gap. Ties are sorted by id. Branches that merge
+  ///          again report their Object once, with the smallest gap.
+  /// @throws maliput::common::assertion_error When the Lane of @p road_position is nullptr or @p horizon is negative.
+  std::vector<ObjectAhead> FindNextObjectsAhead(
+      const maliput::api::RoadPosition& road_position, double horizon,
+      std::function<bool(const Object<maliput::math::Vector3>*)> predicate = {}) const {
+    MALIPUT_THROW_UNLESS(road_position.lane != nullptr);
+    MALIPUT_THROW_UNLESS(horizon >= 0.);
+    return DoFindNextObjectsAhead(road_position, horizon, predicate);
+  }
+
+  /// Finds the Objects closest to @p object.
+  /// @param object The Object to measure from. It must not be nullptr.
+  /// @param k Maximum number of Objects to find. It must not be negative.
+  /// @param max_distance Maximum distance to the Objects to find. Implementations use it to prune their search, so
+  ///        tighter bounds make faster queries. It must not be negative.
+  /// @returns Up to @p k Objects, other than @p object, within @p max_distance of it, sorted by increasing
+  ///          ObjectDistance::distance. Ties are sorted by id.
+  /// @throws maliput::common::assertion_error When @p object is nullptr, @p k is negative or @p max_distance is
+  ///         negative.
+  std::vector<ObjectDistance> FindNearestNeighbors(const Object<maliput::math::Vector3>* object, int k,
+                                                   double max_distance) const {
+    return FindNearestNeighbors(std::vector<const Object<maliput::math::Vector3>*>{object}, k, max_distance).front();
+  }
+
+  /// Finds the Objects closest to each of @p objects. Implementations may share work among the Objects, so it is
+  /// cheaper than calling FindNearestNeighbors() once per Object.
+  /// @param objects The Objects to measure from. None of them must be nullptr.
+  /// @param k Maximum number of Objects to find for each Object. It must not be negative.
+  /// @param max_distance Maximum distance to the Objects to find. It must not be negative.
+  /// @returns The result of FindNearestNeighbors() for every Object of @p objects, in the same order.
+  /// @throws maliput::common::assertion_error When an Object is nullptr, @p k is negative or @p max_distance is
+  ///         negative.
+  std::vector<std::vector<ObjectDistance>> FindNearestNeighbors(
+      const std::vector<const Object<maliput::math::Vector3>*>& objects, int k, double max_distance) const {
+    for (const Object<maliput::math::Vector3>* object : objects) {
+      MALIPUT_THROW_UNLESS(object != nullptr);
+    }
+    MALIPUT_THROW_UNLESS(k >= 0);
+    MALIPUT_THROW_UNLESS(max_distance >= 0.);
+    return DoFindNearestNeighbors(objects, k, max_distance);
+  }
+
+  /// Finds the lateral clearance of @p object to the lane bounds of the Lanes within @p max_distance of it, whether it
+  /// overlaps with them or lies beside them.
+  /// @param object The Object to measure from. It must not be nullptr.
+  /// @param max_distance Maximum clearance to report. Lanes whose bounds are both farther than @p max_distance from
+  ///        @p object, and Lanes farther than @p max_distance from @p object, are skipped. It must not be negative.
+  /// @returns The clearances, sorted by the minimum of LaneClearance::left and LaneClearance::right. Ties are sorted
+  ///          by Lane id.
+  /// @throws maliput::common::assertion_error When @p object is nullptr or @p max_distance is negative.
+  std::vector<LaneClearance> FindLaneClearances(const Object<maliput::math::Vector3>* object,
+                                                double max_distance) const {
+    return FindLaneClearances(std::vector<const Object<maliput::math::Vector3>*>{object}, max_distance).front();
+  }
+
+  /// Finds the lateral clearances of each of @p objects. See FindLaneClearances().
+  /// @param objects The Objects to measure from. None of them must be nullptr.
+  /// @param max_distance Maximum clearance to report. It must not be negative.
+  /// @returns The result of FindLaneClearances() for every Object of @p objects, in the same order.
+  /// @throws maliput::common::assertion_error When an Object is nullptr or @p max_distance is negative.
+  std::vector<std::vector<LaneClearance>> FindLaneClearances(
+      const std::vector<const Object<maliput::math::Vector3>*>& objects, double max_distance) const {
+    for (const Object<maliput::math::Vector3>* object : objects) {
+      MALIPUT_THROW_UNLESS(object != nullptr);
+    }
+    MALIPUT_THROW_UNLESS(max_distance >= 0.);
+    return DoFindLaneClearances(objects, max_distance);
+  }
+
   /// @returns The ObjectBook.
   const ObjectBook<maliput::math::Vector3>* object_book() const { return do_object_book(); }
   /// @returns The maliput::api::RoadNetwork.
@@ -86,13 +313,83 @@ class ObjectQuery {
  protected:
   ObjectQuery() = default;
 
+  /// Finds the route between @p origin and @p target with the lowest cost that keeps clear of @p blocked_lanes.
+  /// The Lane graph is searched from @p origin in both directions of travel of its Lane, and on through the ongoing
+  /// branches of every maliput::api::BranchPoint it reaches, cheapest first. Blocked Lanes are pruned from the search
+  /// when RouteAvoidance::mode is RouteAvoidance::Mode::kExclude, so routes through them are never enumerated.
+  /// @param origin Position to route from. Its Lane must not be nullptr.
+  /// @param target Position to route to. Its Lane must not be nullptr.
+  /// @param blocked_lanes Ids of the Lanes to keep clear of.
+  /// @param avoidance How to treat @p blocked_lanes. RouteAvoidance::predicate is not used.
+  /// @returns The shortest route that avoids @p blocked_lanes, or the one with the lowest length plus penalties,
+  ///          depending on RouteAvoidance::mode. std::nullopt when there is none.
+  /// @throws maliput::common::assertion_error When the Lane of @p origin or @p target is nullptr.
+  static std::optional<const maliput::api::LaneSRoute> FindRouteAvoiding(
+      const maliput::api::RoadPosition& origin, const maliput::api::RoadPosition& target,
+      const std::unordered_set<maliput::api::LaneId>& blocked_lanes, const RouteAvoidance& avoidance);
+
+  /// Computes the lateral clearance of an Object to the lane bounds of @p lane. See FindLaneClearances().
+  /// @param lane The Lane the clearance is reported for.
+  /// @param samples The r-coordinate on @p lane of every vertex of the Object's maliput::math::BoundingBox, or of its
+  ///        position for other bounding region types, together with the lane bounds at its s-coordinate. It must not
+  ///        be empty.
+  /// @param max_distance Maximum clearance to report.
+  /// @returns The clearance, or std::nullopt when both lane bounds are farther than @p max_distance from an Object
+  ///          within @p lane, or when an Object beside @p lane is farther than @p max_distance from it.
+  /// @throws maliput::common::assertion_error When @p samples is empty.
+  static std::optional<LaneClearance> ComputeLaneClearance(
+      const maliput::api::Lane* lane, const std::vector<std::pair<double, maliput::api::RBounds>>& samples,
+      double max_distance);
+
+  /// Finds the lateral clearances of @p object to the Lanes of road_network() within @p max_distance of it, sorted as
+  /// FindLaneClearances() does. The Lanes are looked up with maliput::api::RoadGeometry::FindRoadPositions() from the
+  /// position of @p object, within @p max_distance plus half the diagonal of its maliput::math::BoundingBox, so Lanes
+  /// @p object lies beside are measured too. See ComputeLaneClearance().
+  /// @param object The Object to measure from. It must not be nullptr.
+  /// @param max_distance Maximum clearance to report.
+  /// @param num_lanes When it is not nullptr, it is set to the number of Lanes measured.
+  /// @returns The clearances.
+  std::vector<LaneClearance> FindLaneClearancesNear(const Object<maliput::math::Vector3>* object, double max_distance,
+                                                    std::size_t* num_lanes) const;
+
  private:
   virtual std::vector<const maliput::api::Lane*> DoFindOverlappingLanesIn(
       const Object<maliput::math::Vector3>* object) const = 0;
   virtual std::vector<const maliput::api::Lane*> DoFindOverlappingLanesIn(
       const Object<maliput::math::Vector3>* object, const maliput::math::OverlappingType& overlapping_type) const = 0;
+  // By default, visits the results of DoFindOverlappingLanesIn().
+  virtual void DoVisitOverlappingLanesIn(const Object<maliput::math::Vector3>* object,
+                                         const maliput::math::OverlappingType& overlapping_type,
+                                         const std::function<void(const maliput::api::Lane*)>& visitor) const {
+    for (const maliput::api::Lane* lane : DoFindOverlappingLanesIn(object, overlapping_type)) {
+      visitor(lane);
+    }
+  }
   virtual std::optional<const maliput::api::LaneSRoute> DoRoute(const Object<maliput::math::Vector3>* origin,
                                                                 const Object<maliput::math::Vector3>* target) const = 0;
+  // By default, the blocked Lanes are found with FindOverlappingLanesIn() on every call and the route is searched with
+  // FindRouteAvoiding().
+  virtual std::optional<const maliput::api::LaneSRoute> DoRoute(const Object<maliput::math::Vector3>* origin,
+                                                                const Object<maliput::math::Vector3>* target,
+                                                                const RouteAvoidance& avoidance) const;
+  // By default, the Lane queries check every Object of object_book() against the Lane with FindOverlappingLanesIn().
+  // Implementations are encouraged to override them with an index of the Objects per Lane.
+  virtual std::vector<const Object<maliput::math::Vector3>*> DoFindObjectsOnLane(
+      const maliput::api::LaneId& lane_id, const maliput::api::SRange& s_range) const;
+  virtual std::vector<maliput::api::SRange> DoFindFreeGaps(const maliput::api::LaneId& lane_id,
+                                                           const maliput::api::SRange& s_range,
+                                                           double min_gap_length) const;
+  virtual std::vector<ObjectAlongRoute> DoFindObjectsAlongRoute(const maliput::api::LaneSRoute& route,
+                                                                double lateral_margin) const;
+  virtual std::vector<ObjectAhead> DoFindNextObjectsAhead(
+      const maliput::api::RoadPosition& road_position, double horizon,
+      const std::function<bool(const Object<maliput::math::Vector3>*)>& predicate) const;
+  // By default, the neighbors of every Object are found with ObjectBook::FindWithinDistance() and the clearances with
+  // FindLaneClearancesNear(), one Object at a time.
+  virtual std::vector<std::vector<ObjectDistance>> DoFindNearestNeighbors(
+      const std::vector<const Object<maliput::math::Vector3>*>& objects, int k, double max_distance) const;
+  virtual std::vector<std::vector<LaneClearance>> DoFindLaneClearances(
+      const std::vector<const Object<maliput::math::Vector3>*>& objects, double max_distance) const;
   virtual const ObjectBook<maliput::math::Vector3>* do_object_book() const = 0;
   virtual const maliput::api::RoadNetwork* do_road_network() const = 0;
 };
@@ -0,0 +1,61 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include "maliput_object/api/object.h"
+
+namespace maliput {
+namespace object {
+namespace api {
+
+/// A ray segment in a given @p Coordinate system: the points `origin + t * direction` with `t` in `[0, max_range]`.
+template <typename Coordinate>
+struct Ray {
+  /// Position the ray starts at.
+  Coordinate origin;
+  /// Direction of the ray. It must not be zero. ObjectBook normalizes it, so `t` is a distance.
+  Coordinate direction;
+  /// Non-negative length of the ray.
+  double max_range{};
+};
+
+/// An Object hit by a Ray.
+template <typename Coordinate>
+struct RayHit {
+  /// The Object that was hit.
+  Object<Coordinate>* object{};
+  /// Distance from the origin of the ray to the point it enters the Object's bounding region. It is zero when the
+  /// origin is inside the region.
+  double distance{};
+};
+
+}  // namespace api
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,77 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace object {
+
+/// Copy of the parameters that define a bounding region: its position and, for maliput::math::BoundingBox regions,
+/// their box size and orientation. Other types of region are described by their position only.
+///
+/// Caches keep a snapshot of the region of the api::Objects they computed an entry for and check it against the
+/// Objects they are queried with. Unlike the address or the id of an Object, which a new Object may reuse, it tells
+/// whether the entry still describes the Object.
+class BoundingRegionSnapshot {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BoundingRegionSnapshot)
+
+  /// Takes a snapshot of @p region.
+  explicit BoundingRegionSnapshot(const maliput::math::BoundingRegion<maliput::math::Vector3>& region);
+
+  ~BoundingRegionSnapshot() = default;
+
+  /// @returns True when @p region has the same type of region and parameters as the snapshot.
+  bool Matches(const maliput::math::BoundingRegion<maliput::math::Vector3>& region) const;
+
+  /// @returns True when the region is a maliput::math::BoundingBox.
+  bool is_box() const { return is_box_; }
+
+  /// @returns The position, followed by the box size and the roll, pitch and yaw angles of boxes. The last six are zero
+  ///          for other types of region.
+  const std::array<double, 9>& parameters() const { return parameters_; }
+
+  bool operator==(const BoundingRegionSnapshot& other) const;
+  bool operator!=(const BoundingRegionSnapshot& other) const { return !(*this == other); }
+
+ private:
+  // Whether the region is a maliput::math::BoundingBox.
+  bool is_box_{};
+  // The position, followed by the box size and the roll, pitch and yaw angles of boxes.
+  std::array<double, 9> parameters_{};
+};
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,258 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/bounding_region.h>
+
+#include "maliput_object/api/frustum.h"
+#include "maliput_object/api/geometry.h"
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/ray.h"
+#include "maliput_object/base/memory_usage.h"
+
+namespace maliput {
+namespace object {
+
+/// Axis-aligned box in a given @p Coordinate system.
+/// @tparam Coordinate Coordinate providing three components through `operator[]`.
+template <typename Coordinate>
+struct AxisAlignedBox {
+  /// @returns True when this box and @p other share at least one point.
+  bool Overlaps(const AxisAlignedBox<Coordinate>& other) const;
+
+  /// @returns The smallest box that contains both this box and @p other.
+  AxisAlignedBox<Coordinate> Merge(const AxisAlignedBox<Coordinate>& other) const;
+
+  /// @returns A copy of this box inflated by @p distance on every side.
+  AxisAlignedBox<Coordinate> Inflate(double distance) const;
+
+  /// @returns The center of the box.
+  Coordinate center() const;
+
+  /// @returns The squared distance from @p point to the box. It is zero when the box contains @p point.
+  double SquaredDistanceTo(const Coordinate& point) const;
+
+  /// Intersects the box with the ray segment `origin + t * direction`, `t` in `[0, max_range]`.
+  /// @param origin Position the ray starts at.
+  /// @param inverse_direction Component-wise inverse of the ray's direction. Components of directions parallel to an
+  ///        axis are infinite.
+  /// @param max_range Length of the ray.
+  /// @returns The smallest `t` at which the ray is inside the box, or std::nullopt when it misses the box.
+  std::optional<double> IntersectRay(const Coordinate& origin, const Coordinate& inverse_direction,
+                                     double max_range) const;
+
+  /// @returns True when the box lies completely outside of any plane of @p frustum.
+  bool IsOutside(const api::Frustum<Coordinate>& frustum) const;
+
+  Coordinate min_corner;
+  Coordinate max_corner;
+};
+
+/// Computes the axis-aligned box that encloses @p region.
+/// @param region The bounding region to enclose. Only maliput::math::BoundingBox is supported.
+/// @param tolerance Non-negative distance the resulting box is inflated by on every side.
+/// @returns The enclosing box, or std::nullopt when @p region's type is not supported.
+template <typename Coordinate>
+std::optional<AxisAlignedBox<Coordinate>> ComputeAxisAlignedBox(const maliput::math::BoundingRegion<Coordinate>& region,
+                                                                double tolerance);
+
+/// @returns The component-wise inverse of @p direction. Zero components become infinite.
+template <typename Coordinate>
+Coordinate ComputeInverseDirection(const Coordinate& direction);
+
+/// Keeps the up to `k` closest api::Objects it is offered. Ties are broken by id, so the result is deterministic.
+/// @tparam Coordinate Coordinate of the objects.
+template <typename Coordinate>
+class NearestObjects {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(NearestObjects)
+
+  /// Constructs a NearestObjects.
+  /// @param k Maximum number of objects to keep.
+  /// @throws maliput::common::assertion_error When @p k is negative.
+  explicit NearestObjects(int k);
+
+  ~NearestObjects() = default;
+
+  /// Offers @p object at @p distance. It is kept when fewer than `k` objects are kept or it is closer than the
+  /// farthest of them, which is then discarded.
+  void Offer(api::Object<Coordinate>* object, double distance);
+
+  /// @returns The distance of the farthest object kept once `k` objects are kept, infinity otherwise. Objects farther
+  ///          than it are not kept.
+  double max_distance() const;
+
+  /// @returns The objects kept, sorted by increasing distance.
+  std::vector<api::Object<Coordinate>*> Sorted() const;
+
+  /// @returns The objects kept and their distances, sorted by increasing distance.
+  std::vector<std::pair<double, api::Object<Coordinate>*>> SortedWithDistances() const;
+
+ private:
+  std::size_t k_{};
+  // Max-heap on distance and id.
+  std::vector<std::pair<double, api::Object<Coordinate>*>> heap_;
+};
+
+/// Static bounding volume hierarchy (a packed R-tree) of api::Objects.
+///
+/// The hierarchy is bulk loaded with Sort-Tile-Recursive packing: boxes are sorted by their center along each axis in
+/// turn and tiled into nodes of up to kNodeCapacity children, level by level. That yields fully packed nodes with
+/// little overlap in O(N log N). Nodes and entries are stored in contiguous arrays and refer to each other by index.
+///
+/// Objects whose bounding region is not supported by ComputeAxisAlignedBox() are kept aside and are reported as
+/// candidates of every query.
+///
+/// The hierarchy does not own the objects.
+template <typename Coordinate>
+class BoundingVolumeHierarchy {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(BoundingVolumeHierarchy)
+
+  /// Maximum number of children of a node.
+  static constexpr int kNodeCapacity{8};
+
+  /// Number of rays traversed together by VisitRayPacketCandidates().
+  static constexpr std::size_t kRayPacketSize{64};
+
+  /// An indexed object. `object` is nullptr once removed.
+  struct Entry {
+    AxisAlignedBox<Coordinate> box;
+    api::Object<Coordinate>* object{};
+  };
+
+  /// A node of the tree. Children of inner nodes are `nodes()[first, first + count)` whereas children of leaves are
+  /// `entries()[first, first + count)`.
+  struct Node {
+    AxisAlignedBox<Coordinate> box;
+    int first{};
+    int count{};
+    bool is_leaf{};
+  };
+
+  /// Constructs a BoundingVolumeHierarchy.
+  /// @param objects Objects to index.
+  /// @param tolerance Non-negative distance every object's axis-aligned box is inflated by.
+  /// @throws maliput::common::assertion_error When any of @p objects is nullptr or @p tolerance is negative.
+  BoundingVolumeHierarchy(const std::vector<api::Object<Coordinate>*>& objects, double tolerance);
+
+  ~BoundingVolumeHierarchy() = default;
+
+  /// Calls @p visitor with every object whose axis-aligned box overlaps @p box, and with every object that could not
+  /// be bounded. Candidates are not checked against their actual bounding region.
+  /// @param box The axis-aligned box to look candidates in.
+  /// @param visitor Function called once per candidate.
+  void VisitCandidates(const AxisAlignedBox<Coordinate>& box,
+                       const std::function<void(api::Object<Coordinate>*)>& visitor) const;
+
+  /// Calls @p visitor with the objects in increasing order of the distance from @p position to their axis-aligned box,
+  /// which is a lower bound of the distance to their bounding region. Objects that could not be bounded are visited
+  /// first with a zero lower bound. Nodes are expanded best-first, so the traversal stops as soon as @p visitor
+  /// returns false without visiting the rest of the tree.
+  /// @param position The position to measure distances from.
+  /// @param visitor Function called with a candidate and the lower bound of its distance. It returns whether the
+  ///        traversal should continue.
+  void VisitNearest(const Coordinate& position,
+                    const std::function<bool(api::Object<Coordinate>*, double)>& visitor) const;
+
+  /// Calls @p visitor with the objects whose axis-aligned box @p ray hits, in increasing order of the distance the ray
+  /// enters their box at, which is a lower bound of the distance it enters their bounding region at. Objects that
+  /// could not be bounded are visited first with a zero lower bound. The traversal stops as soon as @p visitor returns
+  /// false.
+  /// @param ray The ray to cast. Its direction must be a unit vector.
+  /// @param visitor Function called with a candidate and the lower bound of its distance. It returns whether the
+  ///        traversal should continue.
+  void VisitRayCandidates(const api::Ray<Coordinate>& ray,
+                          const std::function<bool(api::Object<Coordinate>*, double)>& visitor) const;
+
+  /// Calls @p visitor with every pair of ray and object whose axis-aligned box the ray hits within its range. Rays are
+  /// traversed in packets of kRayPacketSize: a node is tested once against every ray of the packet that reached it,
+  /// and is skipped when none of them hit it.
+  /// @param rays The rays to cast. Their directions must be unit vectors.
+  /// @param ranges Ranges of @p rays, which override their `max_range`. @p visitor may shrink them, e.g. to the
+  ///        distance of the closest hit found so far, so that farther candidates are pruned.
+  /// @param visitor Function called with the index of a ray and a candidate.
+  /// @throws maliput::common::assertion_error When @p ranges is nullptr or its size differs from the one of @p rays.
+  void VisitRayPacketCandidates(const std::vector<api::Ray<Coordinate>>& rays, std::vector<double>* ranges,
+                                const std::function<void(std::size_t, api::Object<Coordinate>*)>& visitor) const;
+
+  /// Calls @p visitor with every object whose axis-aligned box is not outside of @p frustum, and with every object that
+  /// could not be bounded.
+  /// @param frustum The convex volume to look candidates in.
+  /// @param visitor Function called once per candidate.
+  void VisitFrustumCandidates(const api::Frustum<Coordinate>& frustum,
+                              const std::function<void(api::Object<Coordinate>*)>& visitor) const;
+
+  /// Removes an object from the hierarchy. Node boxes are not shrunk.
+  /// @param object_id Id of the object to be removed.
+  /// @returns True when the object was in the hierarchy.
+  bool Remove(const typename api::Object<Coordinate>::Id& object_id);
+
+  /// @returns The number of objects in the hierarchy.
+  int size() const { return static_cast<int>(entry_indices_.size() + unbounded_.size()); }
+
+  /// @returns The number of removed objects whose entries are still in the hierarchy.
+  int num_removed() const { return static_cast<int>(entries_.size() - entry_indices_.size()); }
+
+  /// @returns The distance every object's axis-aligned box is inflated by.
+  double tolerance() const { return tolerance_; }
+
+  /// @returns The nodes of the tree. The root is the last node. Together with entries() they describe the packed
+  ///          layout of the hierarchy, e.g. to serialize it.
+  const std::vector<Node>& nodes() const { return nodes_; }
+
+  /// @returns The indexed objects in leaf order. Removed objects are kept with a nullptr object.
+  const std::vector<Entry>& entries() const { return entries_; }
+
+  /// @returns The objects that could not be bounded.
+  const std::vector<api::Object<Coordinate>*>& unbounded() const { return unbounded_; }
+
+  /// @returns The memory used by the hierarchy, accounted as MemoryUsageReport::index. Indexed objects are not
+  ///          included.
+  MemoryUsageReport MemoryUsage() const;
+
+ private:
+  double tolerance_{};
+  std::vector<Entry> entries_;
+  // The root is the last node.
+  std::vector<Node> nodes_;
+  std::vector<api::Object<Coordinate>*> unbounded_;
+  std::unordered_map<typename api::Object<Coordinate>::Id, int> entry_indices_;
+};
+
+}  // namespace object
+}  // namespace maliput
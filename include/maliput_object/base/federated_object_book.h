@@ -0,0 +1,136 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/overlapping_type.h>
+
+#include "maliput_object/api/frustum.h"
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_book.h"
+#include "maliput_object/api/ray.h"
+
+namespace maliput {
+namespace object {
+
+/// Composes several api::ObjectBooks, its layers, into one, e.g. to keep static infrastructure, semi-static work zones
+/// and per-step actors in books with different indices and update rates while querying them all through a single
+/// api::ObjectQuery.
+///
+/// Every query is fanned out to the books of the layers and their results are merged: FindById() returns the Object
+/// of the first layer that has it, and the queries that sort their results sort the merged ones the same way. Object
+/// ids are expected to be unique across layers. Overlapping pairs are found within every layer by the layer's book and
+/// across layers with SpatialJoin().
+///
+/// Layers are routed by their properties. SelectLayers() returns a book federating only the layers whose properties
+/// match a selector, so queries on it skip the other layers entirely.
+///
+/// The book does not own the books of its layers, which must outlive it. It holds no state of its own, so it reflects
+/// their changes right away.
+template <typename Coordinate>
+class FederatedObjectBook : public api::ObjectBook<Coordinate> {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(FederatedObjectBook)
+
+  /// A book composed into a FederatedObjectBook.
+  struct Layer {
+    /// Name of the layer, e.g. "infrastructure". It must be unique within the FederatedObjectBook.
+    std::string name;
+    /// The book. It must not be nullptr.
+    const api::ObjectBook<Coordinate>* book{};
+    /// Properties shared by every Object of the layer, e.g. {{"kind", "static"}}. They route the layer, see
+    /// SelectLayers().
+    std::map<std::string, std::string> properties;
+  };
+
+  /// Constructs a FederatedObjectBook.
+  /// @param layers The layers, in the order they are queried in.
+  /// @throws maliput::common::assertion_error When the book of a layer is nullptr or two layers share a name.
+  explicit FederatedObjectBook(std::vector<Layer> layers);
+
+  virtual ~FederatedObjectBook() = default;
+
+  /// @returns The layers, in the order they are queried in.
+  const std::vector<Layer>& layers() const { return layers_; }
+
+  /// Finds the layer named @p name.
+  /// @returns The layer, or nullptr when there is none.
+  const Layer* FindLayer(const std::string& name) const;
+
+  /// Selects the layers that may hold Objects with @p properties. A layer is selected unless one of its
+  /// Layer::properties has the key of one of @p properties and a different value. Layers that do not declare a
+  /// property may hold Objects with any value of it, so they are selected.
+  /// @param properties The properties of the Objects of interest, e.g. {{"kind", "dynamic"}}.
+  /// @returns A book federating the selected layers in the same order. It refers to the books of the layers, which
+  ///          must outlive it.
+  std::unique_ptr<FederatedObjectBook<Coordinate>> SelectLayers(
+      const std::map<std::string, std::string>& properties) const;
+
+ private:
+  virtual std::unordered_map<typename api::Object<Coordinate>::Id, api::Object<Coordinate>*> do_objects()
+      const override;
+  virtual api::Object<Coordinate>* DoFindById(const typename api::Object<Coordinate>::Id& object_id) const override;
+  virtual std::vector<api::Object<Coordinate>*> DoFindByPredicate(
+      std::function<bool(const api::Object<Coordinate>*)> predicate) const override;
+  virtual std::vector<api::Object<Coordinate>*> DoFindOverlappingIn(
+      const maliput::math::BoundingRegion<Coordinate>& region,
+      const maliput::math::OverlappingType& overlapping_type) const override;
+  virtual void DoVisitByPredicate(const std::function<bool(const api::Object<Coordinate>*)>& predicate,
+                                  const std::function<void(api::Object<Coordinate>*)>& visitor) const override;
+  virtual void DoVisitOverlappingIn(const maliput::math::BoundingRegion<Coordinate>& region,
+                                    const maliput::math::OverlappingType& overlapping_type,
+                                    const std::function<void(api::Object<Coordinate>*)>& visitor) const override;
+  virtual std::vector<api::Object<Coordinate>*> DoFindNearest(
+      const Coordinate& position, int k,
+      const std::function<bool(const api::Object<Coordinate>*)>& predicate) const override;
+  virtual std::vector<api::Object<Coordinate>*> DoFindWithinDistance(const Coordinate& position,
+                                                                     double radius) const override;
+  virtual std::vector<api::RayHit<Coordinate>> DoRayCastAll(const api::Ray<Coordinate>& ray) const override;
+  virtual void DoRayCast(const std::vector<api::Ray<Coordinate>>& rays,
+                         std::vector<std::optional<api::RayHit<Coordinate>>>* hits) const override;
+  virtual std::vector<api::Object<Coordinate>*> DoFindInFrustum(const api::Frustum<Coordinate>& frustum) const override;
+  virtual std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> DoFindAllOverlappingPairs()
+      const override;
+
+  const std::vector<Layer> layers_;
+};
+
+}  // namespace object
+}  // namespace maliput
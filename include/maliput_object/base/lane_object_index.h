@@ -0,0 +1,157 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_book.h"
+#include "maliput_object/api/object_query.h"
+#include "maliput_object/base/memory_usage.h"
+#include "maliput_object/base/object_lane_associations.h"
+
+namespace maliput {
+namespace object {
+
+/// Interval an api::Object covers along a Lane it overlaps with.
+struct LaneObjectInterval {
+  /// The Object.
+  const api::Object<maliput::math::Vector3>* object{};
+  /// Minimum s-coordinate covered by the Object's bounding region.
+  double s_min{};
+  /// Maximum s-coordinate covered by the Object's bounding region.
+  double s_max{};
+  /// Minimum r-coordinate covered by the Object's bounding region.
+  double r_min{};
+  /// Maximum r-coordinate covered by the Object's bounding region.
+  double r_max{};
+};
+
+/// Reverse index from Lanes to the api::Objects that overlap with them, answering which Objects lie on a Lane within
+/// a range of s-coordinates.
+///
+/// The intervals of every Lane are sorted by LaneObjectInterval::s_min and laid out as an implicit balanced binary
+/// search tree: the root of a range of the array is its middle element. Every node stores the maximum s_max of its
+/// subtree, so lookups prune the subtrees whose intervals all end before the range and stop at the first node that
+/// starts after it. A lookup takes O(log n + k) for a Lane with n intervals and k results, when intervals are much
+/// shorter than the Lane as Objects usually are.
+///
+/// The index is maintained alongside the api::ObjectBook: call Update() when an Object is added or moves, and
+/// Remove() when it is removed. They rebuild the trees of the affected Lanes, in time linear in their number of
+/// intervals. The index does not own the Objects.
+class LaneObjectIndex {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(LaneObjectIndex)
+
+  /// Constructs an empty index.
+  LaneObjectIndex() = default;
+
+  /// Constructs an index with the footprints of @p lane_associations.
+  /// @param object_book The book to resolve the Objects of @p lane_associations with. It must not be nullptr.
+  /// @param lane_associations The footprints to index. See ComputeObjectLaneAssociations(). Footprints of Objects that
+  ///        are not in @p object_book, or that changed since the footprints were computed, are ignored. See
+  ///        AreFootprintsCurrent().
+  /// @throws maliput::common::assertion_error When @p object_book is nullptr.
+  LaneObjectIndex(const api::ObjectBook<maliput::math::Vector3>* object_book,
+                  const ObjectLaneAssociations& lane_associations);
+
+  /// Constructs an index with every Object of the api::ObjectBook of @p object_query.
+  /// @param object_query The query to compute the footprints of the Objects with. See ComputeObjectLaneAssociations().
+  explicit LaneObjectIndex(const api::ObjectQuery& object_query);
+
+  ~LaneObjectIndex() = default;
+
+  /// Replaces the footprints of @p object with @p footprints.
+  /// @param object The Object to update. It must not be nullptr.
+  /// @param footprints Footprints of @p object on every Lane it overlaps with. See ComputeLaneFootprint().
+  /// @throws maliput::common::assertion_error When @p object is nullptr.
+  void Update(const api::Object<maliput::math::Vector3>* object, const std::vector<LaneFootprint>& footprints);
+
+  /// Replaces the footprints of @p object with the ones on the Lanes @p object_query finds it overlapping with.
+  /// @param object_query The query to find the Lanes @p object overlaps with.
+  /// @param object The Object to update. It must not be nullptr.
+  /// @throws maliput::common::assertion_error When @p object is nullptr.
+  void Update(const api::ObjectQuery& object_query, const api::Object<maliput::math::Vector3>* object);
+
+  /// Removes the footprints of the Object identified by @p id.
+  /// @returns True when the Object was indexed.
+  bool Remove(const api::Object<maliput::math::Vector3>::Id& id);
+
+  /// Finds the Objects on a Lane that overlap with a range of s-coordinates.
+  /// @param lane_id Id of the Lane.
+  /// @param s_range The range of s-coordinates, in either direction. It is closed.
+  /// @returns The Objects whose interval on the Lane overlaps with @p s_range, sorted by increasing
+  ///          LaneObjectInterval::s_min. It is empty when no Object overlaps with the Lane.
+  std::vector<const api::Object<maliput::math::Vector3>*> FindObjectsOnLane(const maliput::api::LaneId& lane_id,
+                                                                          const maliput::api::SRange& s_range) const;
+
+  /// Calls @p visitor with the intervals on a Lane that overlap with a range of s-coordinates, in increasing order of
+  /// LaneObjectInterval::s_min.
+  /// @param lane_id Id of the Lane.
+  /// @param s_range The range of s-coordinates, in either direction. It is closed.
+  /// @param visitor Function called once per interval found.
+  void VisitIntervalsOnLane(const maliput::api::LaneId& lane_id, const maliput::api::SRange& s_range,
+                            const std::function<void(const LaneObjectInterval&)>& visitor) const;
+
+  /// @returns The intervals on the Lane identified by @p lane_id, sorted by increasing LaneObjectInterval::s_min, or
+  ///          nullptr when no Object overlaps with the Lane.
+  const std::vector<LaneObjectInterval>* GetIntervalsOnLane(const maliput::api::LaneId& lane_id) const;
+
+  /// @returns The number of indexed Objects.
+  int num_objects() const { return static_cast<int>(object_lanes_.size()); }
+
+  /// @returns The memory used by the intervals and lookup tables, accounted as MemoryUsageReport::index.
+  MemoryUsageReport MemoryUsage() const;
+
+ private:
+  // Intervals of one Lane and the maximum s_max of the subtree rooted at each of them.
+  struct LaneIntervals {
+    std::vector<LaneObjectInterval> intervals;
+    std::vector<double> max_s_max;
+  };
+
+  // Sorts the intervals of @p lane_intervals and recomputes their subtree maxima.
+  static void Rebuild(LaneIntervals* lane_intervals);
+
+  std::unordered_map<maliput::api::LaneId, LaneIntervals> lanes_;
+  // Lanes every indexed Object overlaps with.
+  std::unordered_map<api::Object<maliput::math::Vector3>::Id, std::vector<maliput::api::LaneId>> object_lanes_;
+};
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,213 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_query.h"
+#include "maliput_object/base/lane_object_index.h"
+#include "maliput_object/base/memory_usage.h"
+#include "maliput_object/base/object_lane_associations.h"
+
+namespace maliput {
+namespace object {
+
+/// Occupancy of one Lane by api::Objects, rasterized in the (s, r) plane of its Lane-Frame.
+///
+/// The grid spans s in [0, length] and r in [r_min, r_max] with cells of a fixed size. A cell is occupied when the
+/// s and r ranges of an Object's interval overlap with it, so the grid over-approximates the Objects. Occupancy is
+/// stored as one bit per cell, each row of cells along r starting at a new 64-bit word, which makes a lookup a couple
+/// of multiplications and a bit test.
+///
+/// The grid keeps the interval of every Object it holds. Update() and Remove() clear the cells of the previous
+/// interval of an Object and rasterize again the intervals of the other Objects that share any of them, so they take
+/// time linear in the number of Objects on the Lane plus the number of cells involved.
+class LaneOccupancyGrid {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(LaneOccupancyGrid)
+
+  /// Constructs an empty grid.
+  /// @param length Length of the Lane. It must not be negative.
+  /// @param r_min Minimum r-coordinate the grid spans.
+  /// @param r_max Maximum r-coordinate the grid spans. It must not be less than @p r_min.
+  /// @param s_resolution Size of the cells along s. It must be positive.
+  /// @param r_resolution Size of the cells along r. It must be positive.
+  /// @throws maliput::common::assertion_error When any of the constraints above is not met.
+  LaneOccupancyGrid(double length, double r_min, double r_max, double s_resolution, double r_resolution);
+
+  ~LaneOccupancyGrid() = default;
+
+  /// Replaces the interval of LaneObjectInterval::object with @p interval. Parts of @p interval outside of the grid
+  /// are ignored.
+  /// @throws maliput::common::assertion_error When the Object of @p interval is nullptr.
+  void Update(const LaneObjectInterval& interval);
+
+  /// Removes the interval of the Object identified by @p id.
+  /// @returns True when the Object was in the grid.
+  bool Remove(const api::Object<maliput::math::Vector3>::Id& id);
+
+  /// @returns Whether the cell that contains (@p s, @p r) is occupied. Positions outside of the grid are not.
+  bool IsOccupied(double s, double r) const {
+    if (!(s >= 0. && s <= length_ && r >= r_min_ && r <= r_max_)) {
+      return false;
+    }
+    const int s_cell = ToCell(s / s_resolution_, num_s_cells_);
+    const int r_cell = ToCell((r - r_min_) / r_resolution_, num_r_cells_);
+    return (bits_[s_cell * words_per_row_ + r_cell / 64] >> (r_cell % 64)) & 1u;
+  }
+
+  /// @returns The number of cells along s.
+  int num_s_cells() const { return num_s_cells_; }
+
+  /// @returns The number of cells along r.
+  int num_r_cells() const { return num_r_cells_; }
+
+  /// @returns The number of Objects in the grid.
+  int num_objects() const { return static_cast<int>(intervals_.size()); }
+
+  /// @returns The memory used by the cells and intervals, accounted as MemoryUsageReport::index.
+  MemoryUsageReport MemoryUsage() const;
+
+ private:
+  // @returns The cell @p coordinate, expressed in cells, falls in, clamped to [0, @p num_cells).
+  static int ToCell(double coordinate, int num_cells) {
+    return coordinate <= 0. ? 0 : coordinate >= num_cells ? num_cells - 1 : static_cast<int>(coordinate);
+  }
+
+  // Range of cells, inclusive.
+  struct CellRange {
+    int s_first;
+    int s_last;
+    int r_first;
+    int r_last;
+  };
+
+  // @returns The cells @p interval overlaps with, or std::nullopt when it lies outside of the grid.
+  std::optional<CellRange> ToCellRange(const LaneObjectInterval& interval) const;
+
+  // Sets, or clears when @p occupied is false, the cells of @p cells.
+  void Rasterize(const CellRange& cells, bool occupied);
+
+  // Clears the cells of @p interval and sets again the cells of the other intervals that share any of them.
+  void Erase(const LaneObjectInterval& interval);
+
+  double length_{};
+  double r_min_{};
+  double r_max_{};
+  double s_resolution_{};
+  double r_resolution_{};
+  int num_s_cells_{};
+  int num_r_cells_{};
+  int words_per_row_{};
+  std::vector<std::uint64_t> bits_;
+  std::unordered_map<api::Object<maliput::math::Vector3>::Id, LaneObjectInterval> intervals_;
+};
+
+/// Builds and maintains a LaneOccupancyGrid for every Lane the api::Objects of an api::ObjectQuery overlap with.
+///
+/// Grids are created for the Lanes as Objects reach them. They span the Lane's length and the r-coordinates of its
+/// lane bounds at both ends and in the middle. Grids are keyed by Lane, so lookups take a hash of a pointer and a bit
+/// test. Call Update() when an Object is added or moves and Remove() when it is removed.
+class LaneOccupancyGrids {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(LaneOccupancyGrids)
+
+  /// Constructs the grids of every Object of the api::ObjectBook of @p object_query.
+  /// @param object_query The query to find the Lanes the Objects overlap with, e.g. a SimpleObjectQuery. It must not
+  ///        be nullptr and must outlive the grids.
+  /// @param s_resolution Size of the cells along s. It must be positive.
+  /// @param r_resolution Size of the cells along r. It must be positive.
+  /// @throws maliput::common::assertion_error When @p object_query is nullptr or a resolution is not positive.
+  LaneOccupancyGrids(const api::ObjectQuery* object_query, double s_resolution, double r_resolution);
+
+  ~LaneOccupancyGrids() = default;
+
+  /// Replaces the occupancy of @p object with the one of @p footprints.
+  /// @param object The Object to update. It must not be nullptr.
+  /// @param footprints Footprints of @p object on every Lane it overlaps with. See ComputeLaneFootprint().
+  /// @throws maliput::common::assertion_error When @p object is nullptr or a footprint refers to an unknown Lane.
+  void Update(const api::Object<maliput::math::Vector3>* object, const std::vector<LaneFootprint>& footprints);
+
+  /// Replaces the occupancy of @p object with its footprints on the Lanes the query finds it overlapping with.
+  /// @param object The Object to update. It must not be nullptr.
+  /// @throws maliput::common::assertion_error When @p object is nullptr.
+  void Update(const api::Object<maliput::math::Vector3>* object);
+
+  /// Removes the occupancy of the Object identified by @p id.
+  /// @returns True when the Object was in the grids.
+  bool Remove(const api::Object<maliput::math::Vector3>::Id& id);
+
+  /// @returns Whether the cell of the grid of @p lane that contains (@p s, @p r) is occupied. Lanes without a grid
+  ///          are not occupied.
+  bool IsOccupied(const maliput::api::Lane* lane, double s, double r) const {
+    const auto it = grids_.find(lane);
+    return it != grids_.end() && it->second.IsOccupied(s, r);
+  }
+
+  /// Checks the samples of a trajectory.
+  /// @param trajectory The samples. Consecutive samples on the same Lane share the lookup of its grid.
+  /// @returns Whether the cell of every sample of @p trajectory is occupied, in the same order.
+  std::vector<bool> IsOccupied(const std::vector<maliput::api::RoadPosition>& trajectory) const;
+
+  /// Finds the first sample of a trajectory in an occupied cell.
+  /// @param trajectory The samples.
+  /// @returns The index of the first occupied sample of @p trajectory, or std::nullopt when there is none.
+  std::optional<std::size_t> FindFirstOccupied(const std::vector<maliput::api::RoadPosition>& trajectory) const;
+
+  /// @returns The grid of @p lane, or nullptr when no Object reached it.
+  const LaneOccupancyGrid* GetGrid(const maliput::api::Lane* lane) const;
+
+  /// @returns The memory used by the grids and lookup tables, accounted as MemoryUsageReport::index.
+  MemoryUsageReport MemoryUsage() const;
+
+ private:
+  // Calls @p visitor with the sample index and whether it is occupied, until it returns false.
+  template <typename Visitor>
+  void VisitSamples(const std::vector<maliput::api::RoadPosition>& trajectory, Visitor visitor) const;
+
+  const api::ObjectQuery* object_query_{};
+  double s_resolution_{};
+  double r_resolution_{};
+  std::unordered_map<const maliput::api::Lane*, LaneOccupancyGrid> grids_;
+  // Lanes every Object in the grids overlaps with.
+  std::unordered_map<api::Object<maliput::math::Vector3>::Id, std::vector<const maliput::api::Lane*>> object_lanes_;
+};
+
+}  // namespace object
+}  // namespace maliput
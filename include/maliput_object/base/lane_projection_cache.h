@@ -0,0 +1,137 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_query.h"
+#include "maliput_object/base/bounding_region_snapshot.h"
+#include "maliput_object/base/memory_usage.h"
+
+namespace maliput {
+namespace object {
+
+/// Lane-Frame coordinates of an api::Object on a Lane it overlaps with.
+struct LaneProjection {
+  /// The Lane.
+  const maliput::api::Lane* lane{};
+  /// Position of the Object expressed in the Lane-Frame of #lane.
+  maliput::api::LanePosition lane_position;
+};
+
+/// Cache of the Lane-Frame coordinates of api::Objects on the Lanes they overlap with.
+///
+/// maliput::api::Lane::ToLanePosition() is expensive on some backends, e.g. the ones built on OpenDRIVE, so the
+/// position of every Object is projected once onto each Lane maliput::math::OverlappingType::kIntersected by its
+/// bounding region. Projections hold a pointer to their Lane rather than its id, which keeps them at four words.
+///
+/// Entries are keyed by api::Object::Id and keep a BoundingRegionSnapshot of the Object they were computed for.
+/// Objects are immutable, so books change an Object by replacing it with a new one with the same id: a lookup with a
+/// new Object whose region differs misses and Get() projects it again, even when the new Object reuses the address
+/// of the old one. Invalidate() drops an entry explicitly, e.g. when the Object is removed.
+///
+/// Find() does not modify the cache and may run concurrently with other Find() calls. The other methods must not run
+/// concurrently with any call.
+class LaneProjectionCache {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(LaneProjectionCache)
+
+  /// Constructs an empty cache.
+  /// @param object_query The query to find the Lanes an Object overlaps with. It must not be nullptr and must outlive
+  ///        the cache.
+  /// @throws maliput::common::assertion_error When @p object_query is nullptr.
+  explicit LaneProjectionCache(const api::ObjectQuery* object_query);
+
+  ~LaneProjectionCache() = default;
+
+  /// Projects the Objects of @p objects that are not cached yet, or whose region differs from the one of the Object
+  /// their entry was computed for. The projections are computed in parallel, the calling thread being one of the
+  /// workers.
+  /// @param objects The Objects to project. None of them must be nullptr.
+  /// @param num_threads Maximum number of threads to compute with. When zero, std::thread::hardware_concurrency() is
+  ///        used. It must not be negative.
+  /// @throws maliput::common::assertion_error When an Object is nullptr or @p num_threads is negative.
+  void Compute(const std::vector<const api::Object<maliput::math::Vector3>*>& objects, int num_threads = 0);
+
+  /// Projects every Object of the api::ObjectBook of the query that is not cached yet. See Compute().
+  /// @param num_threads Maximum number of threads to compute with. When zero, std::thread::hardware_concurrency() is
+  ///        used. It must not be negative.
+  /// @throws maliput::common::assertion_error When @p num_threads is negative.
+  void ComputeAll(int num_threads = 0);
+
+  /// Finds the cached projections of @p object.
+  /// @param object The Object. It must not be nullptr.
+  /// @returns The projections of @p object, in the order the query found its Lanes, or nullptr when @p object is not
+  ///          cached. The pointer is valid until the entry is recomputed or invalidated.
+  /// @throws maliput::common::assertion_error When @p object is nullptr.
+  const std::vector<LaneProjection>* Find(const api::Object<maliput::math::Vector3>* object) const;
+
+  /// Gets the projections of @p object, computing them when they are not cached.
+  /// @param object The Object. It must not be nullptr.
+  /// @returns The projections of @p object. The reference is valid until the entry is recomputed or invalidated.
+  /// @throws maliput::common::assertion_error When @p object is nullptr.
+  const std::vector<LaneProjection>& Get(const api::Object<maliput::math::Vector3>* object);
+
+  /// Drops the entry of the Object identified by @p id.
+  /// @returns True when the Object was cached.
+  bool Invalidate(const api::Object<maliput::math::Vector3>::Id& id);
+
+  /// Drops every entry.
+  void Clear() { entries_.clear(); }
+
+  /// @returns The number of cached Objects.
+  int size() const { return static_cast<int>(entries_.size()); }
+
+  /// @returns The memory used by the entries, accounted as MemoryUsageReport::caches.
+  MemoryUsageReport MemoryUsage() const;
+
+ private:
+  // Projections of one Object and the region they were computed for.
+  struct Entry {
+    BoundingRegionSnapshot region;
+    std::vector<LaneProjection> projections;
+  };
+
+  // Projects @p object onto the Lanes it overlaps with.
+  std::vector<LaneProjection> Project(const api::Object<maliput::math::Vector3>* object) const;
+
+  const api::ObjectQuery* object_query_{};
+  std::unordered_map<api::Object<maliput::math::Vector3>::Id, Entry> entries_;
+};
+
+}  // namespace object
+}  // namespace maliput
@@ -30,9 +30,12 @@
 #pragma once
 
 #include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <maliput/common/maliput_copyable.h>
 #include <maliput/math/bounding_region.h>
@@ -40,26 +43,84 @@
 
 #include "maliput_object/api/object.h"
 #include "maliput_object/api/object_book.h"
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+#include "maliput_object/base/memory_usage.h"
+#include "maliput_object/base/sweep_and_prune.h"
 
 namespace maliput {
 namespace object {
 
 /// Implements api::ObjectBook for loading objects manually.
+///
+/// Objects added through AddObjects() are bulk loaded into a BoundingVolumeHierarchy which is used to prune
+/// FindOverlappingIn() and FindWithinDistance() queries, and to answer FindNearest() queries best-first, expanding only
+/// the nodes that may hold objects closer than the farthest one found so far. Objects added one at a time through
+/// AddObject() after that are checked linearly until the next call to AddObjects(), which rebuilds the hierarchy with
+/// every object in the book.
+///
+/// The hierarchy also accelerates ray casts and frustum queries. RayCast() with a packet of rays traverses it once per
+/// BoundingVolumeHierarchy::kRayPacketSize rays. FindAllOverlappingPairs() sweeps a SweepAndPrune instead, which the
+/// book keeps sorted as objects are added and removed.
+///
+/// AddObjectsAsync() builds the hierarchy on a background thread instead. Queries are answered by linear search until
+/// the hierarchy is ready, at which point it is swapped in atomically. Queries may run concurrently with the background
+/// build, whereas the methods that modify the book wait for it to finish.
 template <typename Coordinate>
 class ManualObjectBook : public api::ObjectBook<Coordinate> {
  public:
   MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ManualObjectBook)
-  ManualObjectBook() = default;
-  virtual ~ManualObjectBook() = default;
+
+  /// Default tolerance used to inflate the objects' boxes in the spatial index.
+  static constexpr double kDefaultIndexTolerance{1e-3};
+
+  /// Constructs a ManualObjectBook.
+  /// @param index_tolerance Non-negative distance the objects' boxes are inflated by in the spatial index. It should
+  ///        not be smaller than the tolerance of the objects' bounding regions.
+  /// @throws maliput::common::assertion_error When @p index_tolerance is negative.
+  explicit ManualObjectBook(double index_tolerance = kDefaultIndexTolerance);
+
+  /// Waits for any pending background index build before destroying the book.
+  virtual ~ManualObjectBook();
 
   /// Adds an object to the book.
   /// @param object The object to be added.
   void AddObject(std::unique_ptr<api::Object<Coordinate>> object);
 
+  /// Adds objects to the book and bulk loads the spatial index with every object in the book.
+  /// Prefer it over successive AddObject() calls when all the objects are available up front.
+  /// @param objects The objects to be added.
+  /// @throws maliput::common::assertion_error When any of @p objects is nullptr.
+  void AddObjects(std::vector<std::unique_ptr<api::Object<Coordinate>>> objects);
+
+  /// Adds objects to the book and bulk loads the spatial index with every object in the book on a background thread.
+  /// The book answers queries by linear search until the index is ready.
+  /// @param objects The objects to be added.
+  /// @param on_index_ready Optional function called from the background thread once the index is in use.
+  /// @returns A future that becomes ready once the index is in use.
+  /// @throws maliput::common::assertion_error When any of @p objects is nullptr.
+  std::shared_future<void> AddObjectsAsync(std::vector<std::unique_ptr<api::Object<Coordinate>>> objects,
+                                           std::function<void()> on_index_ready = nullptr);
+
+  /// @returns A future that becomes ready once the last spatial index build started by AddObjectsAsync() is in use.
+  ///          It is ready right away when no build is pending.
+  std::shared_future<void> index_ready() const { return index_ready_; }
+
   /// Removes an object from the book.
   /// @param object The object to be removed.
   void RemoveObject(const typename api::Object<Coordinate>::Id& object);
 
+  /// @returns The spatial index when it holds every object in the book, nullptr otherwise, e.g. while it is built in
+  ///          the background or after AddObject() calls. It must not be used once the book is modified.
+  std::shared_ptr<const BoundingVolumeHierarchy<Coordinate>> index() const;
+
+  /// @returns The number of objects the spatial index is out of date by: the objects added through AddObject() after it
+  ///          was built, which queries check linearly, plus the removed objects it still holds. AddObjects() resets it
+  ///          to zero by rebuilding the index.
+  int num_stale_index_entries() const;
+
+  /// @returns The memory used by the book: its objects, what they own and the spatial index.
+  MemoryUsageReport MemoryUsage() const;
+
  private:
   virtual std::unordered_map<typename api::Object<Coordinate>::Id, api::Object<Coordinate>*> do_objects()
       const override;
@@ -69,8 +130,37 @@ class ManualObjectBook : public api::ObjectBook<Coordinate> {
   virtual std::vector<api::Object<Coordinate>*> DoFindOverlappingIn(
       const maliput::math::BoundingRegion<Coordinate>& region,
       const maliput::math::OverlappingType& overlapping_type) const override;
+  virtual void DoVisitByPredicate(const std::function<bool(const api::Object<Coordinate>*)>& predicate,
+                                  const std::function<void(api::Object<Coordinate>*)>& visitor) const override;
+  virtual void DoVisitOverlappingIn(const maliput::math::BoundingRegion<Coordinate>& region,
+                                    const maliput::math::OverlappingType& overlapping_type,
+                                    const std::function<void(api::Object<Coordinate>*)>& visitor) const override;
+  virtual std::vector<api::Object<Coordinate>*> DoFindNearest(
+      const Coordinate& position, int k,
+      const std::function<bool(const api::Object<Coordinate>*)>& predicate) const override;
+  virtual std::vector<api::Object<Coordinate>*> DoFindWithinDistance(const Coordinate& position,
+                                                                     double radius) const override;
+  virtual std::vector<api::RayHit<Coordinate>> DoRayCastAll(const api::Ray<Coordinate>& ray) const override;
+  virtual void DoRayCast(const std::vector<api::Ray<Coordinate>>& rays,
+                         std::vector<std::optional<api::RayHit<Coordinate>>>* hits) const override;
+  virtual std::vector<api::Object<Coordinate>*> DoFindInFrustum(const api::Frustum<Coordinate>& frustum) const override;
+  virtual std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> DoFindAllOverlappingPairs()
+      const override;
+
+  // Inserts @p objects into objects_ and returns every object in the book.
+  std::vector<api::Object<Coordinate>*> InsertObjects(std::vector<std::unique_ptr<api::Object<Coordinate>>> objects);
 
   std::unordered_map<typename api::Object<Coordinate>::Id, std::unique_ptr<api::Object<Coordinate>>> objects_;
+  const double index_tolerance_{};
+  // Spatial index, built by AddObjects() or AddObjectsAsync(). It is loaded and stored atomically because
+  // AddObjectsAsync() swaps it in from a background thread.
+  std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index_;
+  // Becomes ready once the last index build is done.
+  std::shared_future<void> index_ready_;
+  // Objects added after index_ was built.
+  std::vector<api::Object<Coordinate>*> unindexed_objects_;
+  // Every object in the book, for FindAllOverlappingPairs().
+  SweepAndPrune<Coordinate> sweep_and_prune_;
 };
 
 }  // namespace object
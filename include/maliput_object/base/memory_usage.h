@@ -0,0 +1,88 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "maliput_object/api/object.h"
+
+namespace maliput {
+namespace object {
+
+/// Bytes of memory used by the object layer, broken down by what they hold.
+///
+/// Figures are estimates computed in-process: heap allocations are derived from container sizes and capacities
+/// assuming a typical standard library implementation, and allocator overhead is not accounted for. They are meant for
+/// capacity planning and regression checks rather than for exact accounting.
+struct MemoryUsageReport {
+  /// @returns The sum of every category.
+  std::size_t total() const {
+    return objects + bounding_regions + properties + ids + index + caches + containers + mapped;
+  }
+
+  /// Adds @p other to this report, category by category.
+  MemoryUsageReport& operator+=(const MemoryUsageReport& other);
+
+  /// api::Object instances, excluding what they own.
+  std::size_t objects{0};
+  /// Bounding regions owned by the api::Objects.
+  std::size_t bounding_regions{0};
+  /// Property maps of the api::Objects: their nodes and heap-allocated keys and values.
+  std::size_t properties{0};
+  /// Heap-allocated api::Object::Id strings, including the copies used as keys.
+  std::size_t ids{0};
+  /// Spatial index nodes, entries and lookup tables.
+  std::size_t index{0};
+  /// Query caches, e.g. precomputed lanes.
+  std::size_t caches{0};
+  /// Containers holding the above, e.g. hash tables of objects.
+  std::size_t containers{0};
+  /// Memory-mapped files. Their pages are shared by every process that maps the same file.
+  std::size_t mapped{0};
+};
+
+/// Estimates the heap memory owned by @p value. Strings that fit in the small string buffer own none.
+std::size_t EstimateHeapSize(const std::string& value);
+
+/// Estimates the heap memory of a node-based hash table, e.g. std::unordered_map, excluding what its values own.
+/// @param bucket_count Number of buckets of the table.
+/// @param size Number of elements of the table.
+/// @param value_size Size of the table's value type.
+std::size_t EstimateHashTableSize(std::size_t bucket_count, std::size_t size, std::size_t value_size);
+
+/// Estimates the memory used by @p object and everything it owns.
+/// Bounding regions are accounted with the size of their concrete type when it is maliput::math::BoundingBox, and
+/// with the size of the maliput::math::BoundingRegion base otherwise.
+template <typename Coordinate>
+MemoryUsageReport EstimateMemoryUsage(const api::Object<Coordinate>& object);
+
+}  // namespace object
+}  // namespace maliput
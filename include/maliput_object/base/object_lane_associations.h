@@ -0,0 +1,120 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_query.h"
+
+namespace maliput {
+namespace object {
+
+/// Describes where an Object lies on a Lane it overlaps with, in the Lane-Frame.
+struct LaneFootprint {
+  /// Id of the Lane.
+  maliput::api::LaneId lane_id;
+  /// Position of the Object expressed in the Lane-Frame.
+  maliput::api::LanePosition lane_position;
+  /// Minimum s-coordinate covered by the Object's bounding region.
+  double s_min{};
+  /// Maximum s-coordinate covered by the Object's bounding region.
+  double s_max{};
+  /// Minimum r-coordinate covered by the Object's bounding region.
+  double r_min{};
+  /// Maximum r-coordinate covered by the Object's bounding region.
+  double r_max{};
+};
+
+/// Lanes overlapping with every Object of an api::ObjectBook, together with the Road Network they were computed for.
+struct ObjectLaneAssociations {
+  /// Hash of the Road Network the associations were computed for. See ComputeRoadNetworkHash().
+  std::string road_network_hash;
+  /// Footprints of the Objects on every Lane they overlap with. Objects that overlap with no Lane are mapped to an
+  /// empty collection.
+  std::unordered_map<api::Object<maliput::math::Vector3>::Id, std::vector<LaneFootprint>> footprints;
+  /// Hashes of the Objects the footprints were computed for. See ComputeObjectHash(). The footprints of an Object go
+  /// stale when the Object with the same id is changed afterwards, e.g. by loader::Reload(). See
+  /// AreFootprintsCurrent().
+  std::unordered_map<api::Object<maliput::math::Vector3>::Id, std::string> object_hashes;
+};
+
+/// Computes a hash that identifies the geometry of @p road_geometry.
+/// Lanes are sampled along their centerline and their lane bounds every kRoadNetworkHashSamplingStep linear tolerances
+/// of @p road_geometry and at their end. Sampled values are quantized with the linear tolerance so the hash is stable
+/// across runs.
+/// @param road_geometry The RoadGeometry to hash. It must not be nullptr.
+/// @returns A hexadecimal string.
+/// @throws maliput::common::assertion_error When @p road_geometry is nullptr.
+std::string ComputeRoadNetworkHash(const maliput::api::RoadGeometry* road_geometry);
+
+/// Distance between the samples of ComputeRoadNetworkHash(), in linear tolerances of the RoadGeometry.
+constexpr double kRoadNetworkHashSamplingStep{1000.};
+
+/// Computes a hash that identifies the bounding region of @p object. See BoundingRegionSnapshot.
+/// @param object The Object to hash. It must not be nullptr.
+/// @returns A hexadecimal string.
+/// @throws maliput::common::assertion_error When @p object is nullptr.
+std::string ComputeObjectHash(const api::Object<maliput::math::Vector3>* object);
+
+/// Checks whether the footprints of @p object in @p lane_associations were computed for its current bounding region.
+/// Objects without a hash in @p lane_associations, as in associations written by previous versions, are assumed to be
+/// current.
+/// @param lane_associations The associations.
+/// @param object The Object. It must not be nullptr.
+/// @returns False when the hash of @p object differs from the one in @p lane_associations.
+/// @throws maliput::common::assertion_error When @p object is nullptr.
+bool AreFootprintsCurrent(const ObjectLaneAssociations& lane_associations,
+                          const api::Object<maliput::math::Vector3>* object);
+
+/// Computes the footprint of @p object on @p lane.
+/// The s and r ranges are obtained by projecting the vertices of the Object's maliput::math::BoundingBox onto the
+/// Lane. For other bounding region types, only the Object's position is projected.
+/// @param lane The Lane. It must not be nullptr.
+/// @param object The Object. It must not be nullptr.
+/// @returns The LaneFootprint of @p object on @p lane.
+/// @throws maliput::common::assertion_error When any of the arguments is nullptr.
+LaneFootprint ComputeLaneFootprint(const maliput::api::Lane* lane, const api::Object<maliput::math::Vector3>* object);
+
+/// Computes the ObjectLaneAssociations of every Object in the ObjectBook of @p object_query.
+/// Overlapping lanes are obtained via api::ObjectQuery::FindOverlappingLanesIn().
+/// @param object_query The query to compute associations with.
+/// @returns The ObjectLaneAssociations.
+ObjectLaneAssociations ComputeObjectLaneAssociations(const api::ObjectQuery& object_query);
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,196 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_book.h"
+#include "maliput_object/api/object_query.h"
+
+namespace maliput {
+namespace object {
+
+/// A recorded call to an api::ObjectBook or an api::ObjectQuery, with its arguments, its results and its latency.
+/// See RecordingObjectBook and RecordingObjectQuery.
+struct QueryRecord {
+  /// The method that was called.
+  enum class Method : std::uint8_t {
+    kObjects = 0,
+    kFindById,
+    kFindByPredicate,
+    kFindOverlappingIn,
+    kFindOverlappingLanesIn,
+    kRoute,
+    kFindNearest,
+    kFindWithinDistance,
+    kRayCast,
+    kFindInFrustum,
+    kFindObjectsOnLane,
+    kFindObjectsAlongRoute,
+    kFindNextObjectsAhead,
+    kFindFreeGaps,
+    kRouteAvoiding,
+    kFindAllOverlappingPairs,
+    kFindNearestNeighbors,
+    kFindLaneClearances,
+    kRayCastAll,
+  };
+
+  /// A maliput::math::BoundingBox argument.
+  struct Box {
+    maliput::math::Vector3 position;
+    maliput::math::Vector3 box_size;
+    maliput::math::RollPitchYaw rotation;
+    double tolerance{};
+  };
+
+  Method method{Method::kObjects};
+  /// Time the call started at, relative to the beginning of the recording.
+  std::chrono::nanoseconds start{};
+  /// Time the call took.
+  std::chrono::nanoseconds duration{};
+  /// Object arguments: the id looked up by FindById(), the object of FindOverlappingLanesIn(), the origin and target of
+  /// both Route() overloads, the lane of FindObjectsOnLane() and FindFreeGaps(), the lanes of the route of
+  /// FindObjectsAlongRoute(), the lane of the road position of FindNextObjectsAhead() or the objects of
+  /// FindNearestNeighbors() and FindLaneClearances(). The Route() overload with a RouteAvoidance appends its cache key.
+  std::vector<std::string> object_ids;
+  /// Region argument of FindOverlappingIn(). It is std::nullopt when the region is not a maliput::math::BoundingBox,
+  /// in which case the call cannot be replayed.
+  std::optional<Box> region;
+  /// Overlapping type argument, when the method takes one.
+  std::optional<maliput::math::OverlappingType> overlapping_type;
+  /// Numeric arguments, in the order the method takes them. Vectors take three values.
+  std::vector<double> parameters;
+  /// Whether the call took a non-empty predicate.
+  bool has_predicate{false};
+  /// Ids of the objects the predicate argument made true when the call was recorded. Replay() replays the predicate as
+  /// a lookup in them.
+  std::vector<std::string> predicate_ids;
+  /// Results: ids of the objects returned by ObjectBook methods, FindObjectsOnLane(), FindObjectsAlongRoute() and
+  /// FindNextObjectsAhead(), or ids of the lanes returned by the other ObjectQuery methods. FindFreeGaps() records
+  /// none, FindAllOverlappingPairs() records the ids of both objects of every pair in turn, and FindNearestNeighbors()
+  /// and FindLaneClearances() record the ids of the neighbors or lanes of every object in turn.
+  std::vector<std::string> result_ids;
+};
+
+/// Writes QueryRecords to a compact binary file. Records are appended as they are received, so a recording of a
+/// process that crashes is still readable up to its last complete record. ReadQueryRecording() also reads the
+/// recordings of previous versions, whose records have no QueryRecord::parameters nor QueryRecord::predicate_ids.
+///
+/// It is thread safe.
+class QueryRecorder {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(QueryRecorder)
+
+  /// Constructs a QueryRecorder.
+  /// @param filename Path of the file to record to. It is truncated.
+  /// @throws maliput::common::assertion_error When @p filename cannot be opened.
+  explicit QueryRecorder(const std::string& filename);
+
+  ~QueryRecorder() = default;
+
+  /// Appends @p record to the recording.
+  void Record(const QueryRecord& record);
+
+  /// @returns The time elapsed since the recorder was constructed, to stamp QueryRecord::start.
+  std::chrono::nanoseconds Now() const;
+
+  /// Flushes the recorded calls to the file.
+  void Flush();
+
+ private:
+  const std::chrono::steady_clock::time_point start_;
+  std::mutex mutex_;
+  std::ofstream file_;
+};
+
+/// Reads a recording written by a QueryRecorder.
+/// @param filename Path of the recording.
+/// @throws maliput::common::assertion_error When @p filename cannot be opened or is not a recording. A truncated last
+///         record is ignored.
+/// @returns The records, in the order they were recorded.
+std::vector<QueryRecord> ReadQueryRecording(const std::string& filename);
+
+/// Results of Replay().
+struct ReplayReport {
+  /// Latencies and mismatches of one QueryRecord::Method.
+  struct MethodReport {
+    /// Number of replayed calls.
+    int num_calls{0};
+    /// Number of replayed calls whose results differ from the recorded ones.
+    int num_mismatches{0};
+    /// Percentiles of the recorded latencies, keyed by percentile.
+    std::map<int, std::chrono::nanoseconds> recorded_latencies;
+    /// Percentiles of the replayed latencies, keyed by percentile.
+    std::map<int, std::chrono::nanoseconds> replayed_latencies;
+  };
+
+  /// Percentiles reported in MethodReport.
+  static constexpr int kPercentiles[]{50, 90, 99, 100};
+
+  /// Reports of the replayed methods.
+  std::map<QueryRecord::Method, MethodReport> methods;
+  /// Indices of the records whose results differ from the recorded ones.
+  std::vector<std::size_t> mismatched_records;
+  /// Number of records that could not be replayed: calls recorded by a previous version, whose arguments are not
+  /// recorded, regions that are not boxes, unknown objects or Lanes, or ObjectQuery calls without an @p object_query.
+  int num_skipped{0};
+};
+
+/// Replays @p records against @p object_book and @p object_query, and compares their results and latencies with the
+/// recorded ones. Results are compared regardless of their order.
+/// @param records The calls to replay, as returned by ReadQueryRecording().
+/// @param object_book The book to replay ObjectBook calls against. It also resolves object arguments.
+/// @param object_query The query to replay ObjectQuery calls against. It may be nullptr to skip them.
+/// @param repetitions Number of times every call is replayed. Latencies of every repetition are reported, and
+///        results are compared on the first one.
+/// @throws maliput::common::assertion_error When @p object_book is nullptr or @p repetitions is not positive.
+/// @returns The report.
+ReplayReport Replay(const std::vector<QueryRecord>& records, const api::ObjectBook<maliput::math::Vector3>* object_book,
+                    const api::ObjectQuery* object_query, int repetitions = 1);
+
+/// @returns The name of @p method, e.g. "FindOverlappingIn".
+std::string to_string(QueryRecord::Method method);
+
+}  // namespace object
+}  // namespace maliput
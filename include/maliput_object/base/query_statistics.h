@@ -0,0 +1,139 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+#include <maliput/common/maliput_copyable.h>
+
+#include "maliput_object/base/query_recording.h"
+
+namespace maliput {
+namespace object {
+
+/// Statistics of the api::ObjectBook and api::ObjectQuery calls served by the implementations in this package.
+///
+/// Collection is opt-in, see EnableQueryStatistics(). Counters are kept per thread and only written by their own
+/// thread, so collecting them takes no lock. GetQueryStatistics() aggregates the counters of every thread, including
+/// the ones that already exited.
+struct QueryStatistics {
+  /// Number of buckets of MethodStatistics::latency_histogram. Bucket `i` counts the calls whose latency lies in
+  /// [2^i, 2^(i+1)) nanoseconds, the first bucket also counts the calls under a nanosecond and the last one all the
+  /// calls above its lower bound.
+  static constexpr std::size_t kNumLatencyBuckets{32};
+
+  /// Statistics of one QueryRecord::Method.
+  struct MethodStatistics {
+    /// @returns The ratio of cache hits to cache lookups, or 0 when there was no lookup.
+    double cache_hit_ratio() const;
+
+    /// Estimates a latency percentile from the histogram.
+    /// @param percentile The percentile, in [0, 100].
+    /// @returns The upper bound of the bucket the percentile falls in, or zero when there was no call.
+    /// @throws maliput::common::assertion_error When @p percentile is not in [0, 100].
+    std::chrono::nanoseconds latency_percentile(double percentile) const;
+
+    /// Number of calls.
+    std::uint64_t num_calls{0};
+    /// Sum of the latencies of the calls.
+    std::chrono::nanoseconds total_latency{0};
+    /// Number of calls per latency bucket.
+    std::array<std::uint64_t, kNumLatencyBuckets> latency_histogram{};
+    /// Number of Objects, or Lanes, that were checked to serve the calls.
+    std::uint64_t candidates_examined{0};
+    /// Number of Objects, or Lanes, that were returned.
+    std::uint64_t results_returned{0};
+    /// Number of lookups served from a cache: precomputed lanes or already materialized Objects.
+    std::uint64_t cache_hits{0};
+    /// Number of lookups a cache could not serve.
+    std::uint64_t cache_misses{0};
+  };
+
+  /// Statistics of the methods that were called at least once.
+  std::map<QueryRecord::Method, MethodStatistics> methods;
+};
+
+/// Enables or disables the collection of QueryStatistics. It is disabled by default.
+/// While disabled, instrumented calls only pay for checking this flag.
+void EnableQueryStatistics(bool enable);
+
+/// @returns Whether QueryStatistics are collected.
+bool QueryStatisticsEnabled();
+
+/// @returns The statistics collected since the last ResetQueryStatistics() call, or since the start of the process.
+QueryStatistics GetQueryStatistics();
+
+/// Resets the collected statistics.
+void ResetQueryStatistics();
+
+/// Collects the statistics of one call.
+/// Construct it at the beginning of the call and let it go out of scope when the call returns. Its methods do nothing
+/// when collection was disabled at construction.
+class QueryStatisticsScope {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(QueryStatisticsScope)
+
+  /// Constructs a QueryStatisticsScope.
+  /// @param method The method being called.
+  explicit QueryStatisticsScope(QueryRecord::Method method);
+
+  /// Records the call.
+  ~QueryStatisticsScope();
+
+  /// Adds @p count candidates to the examined ones.
+  void AddCandidates(std::size_t count) { candidates_ += enabled_ ? count : 0; }
+
+  /// Sets the number of results returned to @p count.
+  void SetResults(std::size_t count) { results_ = enabled_ ? count : 0; }
+
+  /// Records a cache lookup.
+  /// @param hit Whether the cache served the lookup.
+  void AddCacheLookup(bool hit) {
+    if (enabled_) {
+      ++(hit ? cache_hits_ : cache_misses_);
+    }
+  }
+
+ private:
+  const QueryRecord::Method method_;
+  const bool enabled_;
+  std::chrono::steady_clock::time_point start_;
+  std::size_t candidates_{0};
+  std::size_t results_{0};
+  std::size_t cache_hits_{0};
+  std::size_t cache_misses_{0};
+};
+
+}  // namespace object
+}  // namespace maliput
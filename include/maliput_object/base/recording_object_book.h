@@ -0,0 +1,113 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_book.h"
+#include "maliput_object/base/query_recording.h"
+
+namespace maliput {
+namespace object {
+
+/// Decorates an api::ObjectBook to record every call to it, with its arguments, results and latency, through a
+/// QueryRecorder. Calls are forwarded to the decorated book. The buffer and visitor overloads are forwarded to the
+/// buffer overloads of the decorated book and recorded as the calls that return a vector. See Replay() to re-run a
+/// recording.
+class RecordingObjectBook : public api::ObjectBook<maliput::math::Vector3> {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(RecordingObjectBook)
+
+  /// Default tolerance recorded regions are replayed with.
+  static constexpr double kDefaultRegionTolerance{1e-3};
+
+  /// Constructs a RecordingObjectBook.
+  /// @param object_book The book to decorate. It must outlive this book.
+  /// @param recorder The recorder to record calls to. It must outlive this book.
+  /// @param region_tolerance Non-negative tolerance recorded with the regions of FindOverlappingIn(), which they are
+  ///        replayed with. It should match the tolerance of the queried regions.
+  /// @throws maliput::common::assertion_error When @p object_book or @p recorder are nullptr, or @p region_tolerance
+  ///         is negative.
+  RecordingObjectBook(const api::ObjectBook<maliput::math::Vector3>* object_book, QueryRecorder* recorder,
+                      double region_tolerance = kDefaultRegionTolerance);
+
+  ~RecordingObjectBook() = default;
+
+ private:
+  virtual std::unordered_map<api::Object<maliput::math::Vector3>::Id, api::Object<maliput::math::Vector3>*>
+  do_objects() const override;
+  virtual api::Object<maliput::math::Vector3>* DoFindById(
+      const api::Object<maliput::math::Vector3>::Id& object_id) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindByPredicate(
+      std::function<bool(const api::Object<maliput::math::Vector3>*)> predicate) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindOverlappingIn(
+      const maliput::math::BoundingRegion<maliput::math::Vector3>& region,
+      const maliput::math::OverlappingType& overlapping_type) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindNearest(
+      const maliput::math::Vector3& position, int k,
+      const std::function<bool(const api::Object<maliput::math::Vector3>*)>& predicate) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindWithinDistance(const maliput::math::Vector3& position,
+                                                                                 double radius) const override;
+  virtual std::vector<api::RayHit<maliput::math::Vector3>> DoRayCastAll(
+      const api::Ray<maliput::math::Vector3>& ray) const override;
+  virtual void DoRayCast(const std::vector<api::Ray<maliput::math::Vector3>>& rays,
+                         std::vector<std::optional<api::RayHit<maliput::math::Vector3>>>* hits) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindInFrustum(
+      const api::Frustum<maliput::math::Vector3>& frustum) const override;
+  virtual std::vector<std::pair<api::Object<maliput::math::Vector3>*, api::Object<maliput::math::Vector3>*>>
+  DoFindAllOverlappingPairs() const override;
+  virtual void DoVisitByPredicate(
+      const std::function<bool(const api::Object<maliput::math::Vector3>*)>& predicate,
+      const std::function<void(api::Object<maliput::math::Vector3>*)>& visitor) const override;
+  virtual void DoVisitOverlappingIn(
+      const maliput::math::BoundingRegion<maliput::math::Vector3>& region,
+      const maliput::math::OverlappingType& overlapping_type,
+      const std::function<void(api::Object<maliput::math::Vector3>*)>& visitor) const override;
+
+  // @returns A record of a call to FindOverlappingIn() with @p region and @p overlapping_type.
+  QueryRecord MakeFindOverlappingInRecord(const maliput::math::BoundingRegion<maliput::math::Vector3>& region,
+                                          const maliput::math::OverlappingType& overlapping_type) const;
+
+  const api::ObjectBook<maliput::math::Vector3>* object_book_{};
+  QueryRecorder* recorder_{};
+  const double region_tolerance_{};
+};
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,110 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_book.h"
+#include "maliput_object/api/object_query.h"
+#include "maliput_object/base/query_recording.h"
+
+namespace maliput {
+namespace object {
+
+/// Decorates an api::ObjectQuery to record every call to it, with its arguments, results and latency, through a
+/// QueryRecorder. Calls are forwarded to the decorated query. The buffer and visitor overloads of
+/// FindOverlappingLanesIn() are forwarded to the buffer overload of the decorated query and recorded as the call that
+/// returns a vector. See Replay() to re-run a recording.
+///
+/// Wrap the query's book with a RecordingObjectBook to record the calls to it too.
+class RecordingObjectQuery : public api::ObjectQuery {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RecordingObjectQuery)
+
+  /// Constructs a RecordingObjectQuery.
+  /// @param object_query The query to decorate. It must outlive this query.
+  /// @param recorder The recorder to record calls to. It must outlive this query.
+  /// @throws maliput::common::assertion_error When @p object_query or @p recorder are nullptr.
+  RecordingObjectQuery(const api::ObjectQuery* object_query, QueryRecorder* recorder);
+
+  ~RecordingObjectQuery() = default;
+
+ private:
+  std::vector<const maliput::api::Lane*> DoFindOverlappingLanesIn(
+      const api::Object<maliput::math::Vector3>* object) const override;
+  std::vector<const maliput::api::Lane*> DoFindOverlappingLanesIn(
+      const api::Object<maliput::math::Vector3>* object,
+      const maliput::math::OverlappingType& overlapping_type) const override;
+  void DoVisitOverlappingLanesIn(const api::Object<maliput::math::Vector3>* object,
+                                 const maliput::math::OverlappingType& overlapping_type,
+                                 const std::function<void(const maliput::api::Lane*)>& visitor) const override;
+  std::optional<const maliput::api::LaneSRoute> DoRoute(
+      const api::Object<maliput::math::Vector3>* origin,
+      const api::Object<maliput::math::Vector3>* target) const override;
+  std::optional<const maliput::api::LaneSRoute> DoRoute(const api::Object<maliput::math::Vector3>* origin,
+                                                        const api::Object<maliput::math::Vector3>* target,
+                                                        const api::RouteAvoidance& avoidance) const override;
+  std::vector<const api::Object<maliput::math::Vector3>*> DoFindObjectsOnLane(
+      const maliput::api::LaneId& lane_id, const maliput::api::SRange& s_range) const override;
+  std::vector<maliput::api::SRange> DoFindFreeGaps(const maliput::api::LaneId& lane_id,
+                                                   const maliput::api::SRange& s_range,
+                                                   double min_gap_length) const override;
+  std::vector<api::ObjectAlongRoute> DoFindObjectsAlongRoute(const maliput::api::LaneSRoute& route,
+                                                             double lateral_margin) const override;
+  std::vector<api::ObjectAhead> DoFindNextObjectsAhead(
+      const maliput::api::RoadPosition& road_position, double horizon,
+      const std::function<bool(const api::Object<maliput::math::Vector3>*)>& predicate) const override;
+  std::vector<std::vector<api::ObjectDistance>> DoFindNearestNeighbors(
+      const std::vector<const api::Object<maliput::math::Vector3>*>& objects, int k,
+      double max_distance) const override;
+  std::vector<std::vector<api::LaneClearance>> DoFindLaneClearances(
+      const std::vector<const api::Object<maliput::math::Vector3>*>& objects, double max_distance) const override;
+  const api::ObjectBook<maliput::math::Vector3>* do_object_book() const override {
+    return object_query_->object_book();
+  }
+  const maliput::api::RoadNetwork* do_road_network() const override { return object_query_->road_network(); }
+
+  const api::ObjectQuery* object_query_{};
+  QueryRecorder* recorder_{};
+};
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,143 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_book.h"
+#include "maliput_object/base/memory_usage.h"
+#include "maliput_object/base/query_statistics.h"
+
+namespace maliput {
+namespace object {
+
+/// Implements a read-only api::ObjectBook backed by a memory-mapped file that many processes can attach to at once.
+///
+/// The file is written once by Write() and holds flat records with the objects' bounding boxes, their properties as
+/// interned strings and a packed BoundingVolumeHierarchy of them. Records refer to each other by offsets relative to
+/// the beginning of the file, so every process may map it at a different address. When the file lives in a tmpfs such
+/// as `/dev/shm` it is a POSIX shared-memory segment, and every attached process shares the same physical pages.
+///
+/// api::Object instances are materialized lazily, the first time a query returns them, and are owned by the attached
+/// book. FindOverlappingIn() only materializes the candidates the packed hierarchy cannot prune, and FindNearest() only
+/// the objects that may be among the nearest ones. Ray casts and frustum queries test the candidates against the
+/// records too, and only materialize the objects they return. The rays of a packet are cast one after the other.
+///
+/// Only maliput::math::BoundingBox regions are supported.
+class SharedMemoryObjectBook : public api::ObjectBook<maliput::math::Vector3> {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(SharedMemoryObjectBook)
+
+  /// Default tolerance of the objects' bounding boxes.
+  static constexpr double kDefaultTolerance{1e-3};
+
+  /// Writes every object of @p object_book to @p filename. The file is replaced atomically, so books that are
+  /// attached to a previous version of it keep using that version.
+  /// @param filename Path of the file to write, e.g. `/dev/shm/objects.bin`.
+  /// @param object_book The book to write.
+  /// @param tolerance Non-negative tolerance of the objects' bounding boxes. It is also the distance the objects'
+  ///        boxes are inflated by in the spatial index.
+  /// @throws maliput::common::assertion_error When @p tolerance is negative or any object's bounding region is not a
+  ///         maliput::math::BoundingBox.
+  /// @throws maliput::common::assertion_error When @p filename cannot be written.
+  static void Write(const std::string& filename, const api::ObjectBook<maliput::math::Vector3>& object_book,
+                    double tolerance = kDefaultTolerance);
+
+  /// Attaches to the book stored in @p filename.
+  /// @param filename Path of a file written by Write().
+  /// @throws maliput::common::assertion_error When @p filename cannot be mapped or is not a valid book.
+  explicit SharedMemoryObjectBook(const std::string& filename);
+
+  /// Unmaps the file. Objects returned by this book are destroyed.
+  virtual ~SharedMemoryObjectBook();
+
+  /// @returns The size in bytes of the mapped file.
+  std::size_t mapped_size() const { return size_; }
+
+  /// @returns The memory used by the book: the mapped file, accounted as MemoryUsageReport::mapped, and the objects
+  ///          materialized so far.
+  MemoryUsageReport MemoryUsage() const;
+
+ private:
+  virtual std::unordered_map<api::Object<maliput::math::Vector3>::Id, api::Object<maliput::math::Vector3>*>
+  do_objects() const override;
+  virtual api::Object<maliput::math::Vector3>* DoFindById(
+      const api::Object<maliput::math::Vector3>::Id& object_id) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindByPredicate(
+      std::function<bool(const api::Object<maliput::math::Vector3>*)> predicate) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindOverlappingIn(
+      const maliput::math::BoundingRegion<maliput::math::Vector3>& region,
+      const maliput::math::OverlappingType& overlapping_type) const override;
+  virtual void DoVisitByPredicate(
+      const std::function<bool(const api::Object<maliput::math::Vector3>*)>& predicate,
+      const std::function<void(api::Object<maliput::math::Vector3>*)>& visitor) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindNearest(
+      const maliput::math::Vector3& position, int k,
+      const std::function<bool(const api::Object<maliput::math::Vector3>*)>& predicate) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindWithinDistance(const maliput::math::Vector3& position,
+                                                                                 double radius) const override;
+  virtual std::vector<api::RayHit<maliput::math::Vector3>> DoRayCastAll(
+      const api::Ray<maliput::math::Vector3>& ray) const override;
+  virtual void DoRayCast(const std::vector<api::Ray<maliput::math::Vector3>>& rays,
+                         std::vector<std::optional<api::RayHit<maliput::math::Vector3>>>* hits) const override;
+  virtual std::vector<api::Object<maliput::math::Vector3>*> DoFindInFrustum(
+      const api::Frustum<maliput::math::Vector3>& frustum) const override;
+  virtual void DoVisitOverlappingIn(
+      const maliput::math::BoundingRegion<maliput::math::Vector3>& region,
+      const maliput::math::OverlappingType& overlapping_type,
+      const std::function<void(api::Object<maliput::math::Vector3>*)>& visitor) const override;
+
+  // @returns The object stored at @p index of the file, materializing it on first use. The lookup is recorded as a
+  //          cache hit in @p statistics when the object was already materialized.
+  api::Object<maliput::math::Vector3>* GetObject(std::size_t index, QueryStatisticsScope* statistics) const;
+
+  void* data_{};
+  std::size_t size_{};
+  std::size_t num_objects_{};
+  // Guards materialized_objects_.
+  mutable std::mutex mutex_;
+  // Objects materialized so far, indexed as they are stored in the file.
+  mutable std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> materialized_objects_;
+};
+
+}  // namespace object
+}  // namespace maliput
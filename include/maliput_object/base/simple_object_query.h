@@ -29,7 +29,13 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <maliput/api/road_network.h>
@@ -40,6 +46,11 @@
 #include "maliput_object/api/object.h"
 #include "maliput_object/api/object_book.h"
 #include "maliput_object/api/object_query.h"
+#include "maliput_object/base/bounding_region_snapshot.h"
+#include "maliput_object/base/lane_object_index.h"
+#include "maliput_object/base/memory_usage.h"
+#include "maliput_object/base/object_lane_associations.h"
+#include "maliput_object/base/query_statistics.h"
 
 namespace maliput {
 namespace object {
@@ -47,25 +58,137 @@ namespace object {
 /// api::ObjectQuery Implementation.
 /// The implementation uses maliput's api for finding the lanes.
 /// Methods like ToRoadPosition or FindRoadPositions are extensively used.
+///
+/// Optionally, it can be constructed with precomputed ObjectLaneAssociations. The overlapping lanes of the Objects
+/// they cover are then served without any geometric computation, and without any heap allocation when
+/// maliput::math::OverlappingType::kIntersected lanes are appended to a reused buffer or visited.
+///
+/// FindObjectsOnLane() and FindFreeGaps() are served by a LaneObjectIndex, either built from the precomputed
+/// ObjectLaneAssociations or provided by the caller, who maintains it as the ObjectBook changes. Without one, every
+/// Object of the ObjectBook is checked against the Lane. FindObjectsAlongRoute() looks Objects up the same way on the
+/// Lanes of the route, and on as many adjacent Lanes as its lateral margin reaches, within the s-coordinates the ends
+/// of each range map to on them. Objects on adjacent Lanes are projected onto the Lane of the range and checked against
+/// its lane bounds over the s-coordinates they cover. FindNextObjectsAhead() looks them up on the Lanes it walks
+/// through, and stops walking a branch at its first Object.
+///
+/// Route() with a api::RouteAvoidance finds the blocked Lanes as FindOverlappingLanesIn() does, so they come from the
+/// precomputed lanes when available, and caches them per api::RouteAvoidance::cache_key together with a snapshot of
+/// the blocking Objects. A cached entry is reused only while the predicate keeps making true the same Objects, with
+/// the same bounding regions, so it follows the changes of the ObjectBook. The route is then searched with
+/// api::ObjectQuery::FindRouteAvoiding(), which prunes or penalizes the blocked Lanes as it walks the Lane graph.
+///
+/// FindNearestNeighbors() looks the candidates up with api::ObjectBook::FindWithinDistance() from the position of the
+/// Object, widening the maximum distance by half the diagonal of its box, and keeps the ones whose exact distance, see
+/// ComputeDistance(), is within it. FindLaneClearances() measures every Object with
+/// api::ObjectQuery::FindLaneClearancesNear().
 class SimpleObjectQuery : public api::ObjectQuery {
  public:
   MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SimpleObjectQuery)
   SimpleObjectQuery(const maliput::api::RoadNetwork* road_network,
                     const api::ObjectBook<maliput::math::Vector3>* object_book);
+
+  /// Constructs a SimpleObjectQuery that serves FindOverlappingLanesIn() from @p lane_associations for the Objects
+  /// they cover. The lanes of Objects that changed since the associations were computed are computed again, see
+  /// AreFootprintsCurrent(). Associations are checked on construction only, so the query must be constructed again
+  /// when Objects change afterwards.
+  /// @param road_network The RoadNetwork. It must not be nullptr.
+  /// @param object_book The ObjectBook. It must not be nullptr.
+  /// @param lane_associations Precomputed associations. See ComputeObjectLaneAssociations().
+  /// @throws maliput::common::assertion_error When @p road_network or @p object_book are nullptr, when
+  ///         @p lane_associations were computed for a different Road Network or when they refer to unknown lanes.
+  SimpleObjectQuery(const maliput::api::RoadNetwork* road_network,
+                    const api::ObjectBook<maliput::math::Vector3>* object_book,
+                    const ObjectLaneAssociations& lane_associations);
+
+  /// Constructs a SimpleObjectQuery that serves FindObjectsOnLane() from @p lane_object_index.
+  /// @param road_network The RoadNetwork. It must not be nullptr.
+  /// @param object_book The ObjectBook. It must not be nullptr.
+  /// @param lane_object_index Index of the Objects of @p object_book. It must not be nullptr. It may be updated between
+  ///        queries, but not while a query runs.
+  /// @throws maliput::common::assertion_error When any of the arguments is nullptr.
+  SimpleObjectQuery(const maliput::api::RoadNetwork* road_network,
+                    const api::ObjectBook<maliput::math::Vector3>* object_book,
+                    std::shared_ptr<const LaneObjectIndex> lane_object_index);
+
   ~SimpleObjectQuery() = default;
 
+  /// @returns The memory used by the precomputed lanes, accounted as MemoryUsageReport::caches, and by the
+  ///          LaneObjectIndex, accounted as MemoryUsageReport::index. The ObjectBook and the RoadNetwork are not
+  ///          included.
+  MemoryUsageReport MemoryUsage() const;
+
+  /// Drops the blocked Lanes cached by Route() calls with a api::RouteAvoidance, e.g. to free their memory. Entries
+  /// are checked against the blocking Objects on every call, so it is not needed when the ObjectBook changes. The
+  /// cache is shared by the copies of this query.
+  void ClearBlockedLanesCache() const;
+
  private:
+  // Lanes blocked by the Objects a api::RouteAvoidance::predicate makes true, and a snapshot of those Objects.
+  struct BlockedLanes {
+    std::unordered_map<api::Object<maliput::math::Vector3>::Id, BoundingRegionSnapshot> objects;
+    std::unordered_set<maliput::api::LaneId> lanes;
+  };
+
+  // Blocked Lanes found by Route() calls with a api::RouteAvoidance, per api::RouteAvoidance::cache_key.
+  struct BlockedLanesCache {
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<const BlockedLanes>> blocked_lanes;
+  };
+
   std::vector<const maliput::api::Lane*> DoFindOverlappingLanesIn(
       const api::Object<maliput::math::Vector3>* object) const;
   std::vector<const maliput::api::Lane*> DoFindOverlappingLanesIn(
       const api::Object<maliput::math::Vector3>* object, const maliput::math::OverlappingType& overlapping_type) const;
+  void DoVisitOverlappingLanesIn(const api::Object<maliput::math::Vector3>* object,
+                                 const maliput::math::OverlappingType& overlapping_type,
+                                 const std::function<void(const maliput::api::Lane*)>& visitor) const;
   std::optional<const maliput::api::LaneSRoute> DoRoute(const api::Object<maliput::math::Vector3>* origin,
                                                         const api::Object<maliput::math::Vector3>* target) const;
+  std::optional<const maliput::api::LaneSRoute> DoRoute(const api::Object<maliput::math::Vector3>* origin,
+                                                        const api::Object<maliput::math::Vector3>* target,
+                                                        const api::RouteAvoidance& avoidance) const;
+  // Derives the routes between @p origin and @p target.
+  std::vector<maliput::api::LaneSRoute> DeriveRoutes(const api::Object<maliput::math::Vector3>* origin,
+                                                     const api::Object<maliput::math::Vector3>* target) const;
+  // Finds the Lanes the Objects @p avoidance blocks overlap with, from the cache when its entry is up to date. The
+  // cache lookup is recorded in @p statistics.
+  std::shared_ptr<const BlockedLanes> FindBlockedLanes(const api::RouteAvoidance& avoidance,
+                                                       QueryStatisticsScope* statistics) const;
+  std::vector<const api::Object<maliput::math::Vector3>*> DoFindObjectsOnLane(const maliput::api::LaneId& lane_id,
+                                                                            const maliput::api::SRange& s_range) const;
+  std::vector<maliput::api::SRange> DoFindFreeGaps(const maliput::api::LaneId& lane_id,
+                                                   const maliput::api::SRange& s_range, double min_gap_length) const;
+  std::vector<api::ObjectAlongRoute> DoFindObjectsAlongRoute(const maliput::api::LaneSRoute& route,
+                                                             double lateral_margin) const;
+  std::vector<api::ObjectAhead> DoFindNextObjectsAhead(
+      const maliput::api::RoadPosition& road_position, double horizon,
+      const std::function<bool(const api::Object<maliput::math::Vector3>*)>& predicate) const;
+  std::vector<std::vector<api::ObjectDistance>> DoFindNearestNeighbors(
+      const std::vector<const api::Object<maliput::math::Vector3>*>& objects, int k, double max_distance) const;
+  std::vector<std::vector<api::LaneClearance>> DoFindLaneClearances(
+      const std::vector<const api::Object<maliput::math::Vector3>*>& objects, double max_distance) const;
   const api::ObjectBook<maliput::math::Vector3>* do_object_book() const;
+  // Finds the lanes intersected by @p object, from the precomputed lanes when available. The lookup of the precomputed
+  // lanes and the lanes examined are recorded in @p statistics.
+  std::vector<const maliput::api::Lane*> FindIntersectedLanes(const api::Object<maliput::math::Vector3>* object,
+                                                              QueryStatisticsScope* statistics) const;
   const maliput::api::RoadNetwork* do_road_network() const;
+  // Calls @p visitor with the intervals of the Objects on the Lane identified by @p lane_id within
+  // [@p s_min, @p s_max], in increasing order of their s_min. They come from the LaneObjectIndex when available, or
+  // from checking every Object otherwise, in which case the examined Objects are recorded in @p statistics.
+  void VisitIntervalsOnLane(const maliput::api::LaneId& lane_id, double s_min, double s_max,
+                            QueryStatisticsScope* statistics,
+                            const std::function<void(const LaneObjectInterval&)>& visitor) const;
 
   const maliput::api::RoadNetwork* road_network_;
   const api::ObjectBook<maliput::math::Vector3>* object_book_;
+  // Overlapping lanes obtained from precomputed ObjectLaneAssociations.
+  std::shared_ptr<
+      const std::unordered_map<api::Object<maliput::math::Vector3>::Id, std::vector<const maliput::api::Lane*>>>
+      precomputed_lanes_;
+  // Reverse index serving FindObjectsOnLane().
+  std::shared_ptr<const LaneObjectIndex> lane_object_index_;
+  std::shared_ptr<BlockedLanesCache> blocked_lanes_cache_{std::make_shared<BlockedLanesCache>()};
 };
 
 }  // namespace object
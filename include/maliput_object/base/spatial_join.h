@@ -0,0 +1,87 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <maliput/math/overlapping_type.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_book.h"
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+#include "maliput_object/base/manual_object_book.h"
+
+namespace maliput {
+namespace object {
+
+/// Finds every pair of api::Objects of two BoundingVolumeHierarchy instances that overlap.
+///
+/// Both hierarchies are traversed at once: pairs of nodes whose boxes overlap are expanded by descending into the
+/// children of the larger node, so subtrees that are far apart are pruned together instead of once per object. The
+/// top of the traversal is split into pairs of subtrees that are joined in parallel. Candidate pairs are confirmed
+/// with maliput::math::BoundingRegion::Overlaps(). Objects that could not be bounded are confirmed against every object
+/// of the other hierarchy.
+///
+/// @param lhs The left hierarchy, e.g. the one of the dynamic actors.
+/// @param rhs The right hierarchy, e.g. the one of the static map objects.
+/// @param overlapping_type Indicates type of overlapping. A pair is found when the region of its right object overlaps
+///        with the region of its left object with @p overlapping_type, i.e. the result matches calling
+///        api::ObjectBook::FindOverlappingIn() on the right objects with the region of every left object.
+/// @param num_threads Maximum number of threads to join with. When zero, std::thread::hardware_concurrency() is used.
+///        It must not be negative.
+/// @returns The pairs, the left object first, sorted by the ids of their left and then right objects.
+/// @throws maliput::common::assertion_error When @p num_threads is negative.
+template <typename Coordinate>
+std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> SpatialJoin(
+    const BoundingVolumeHierarchy<Coordinate>& lhs, const BoundingVolumeHierarchy<Coordinate>& rhs,
+    const maliput::math::OverlappingType& overlapping_type, int num_threads = 0);
+
+/// Finds every pair of api::Objects of two books that overlap. See the overload for hierarchies.
+///
+/// The spatial index of a ManualObjectBook is used when it holds every object of the book. A hierarchy is built for
+/// the call from the objects of any other book.
+///
+/// @param lhs The left book.
+/// @param rhs The right book.
+/// @param overlapping_type Indicates type of overlapping. See the overload for hierarchies.
+/// @param num_threads Maximum number of threads to join with. When zero, std::thread::hardware_concurrency() is used.
+///        It must not be negative.
+/// @param tolerance Non-negative distance the objects' boxes are inflated by in the hierarchies built for the call.
+/// @returns The pairs. See the overload for hierarchies.
+/// @throws maliput::common::assertion_error When @p num_threads or @p tolerance are negative.
+template <typename Coordinate>
+std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> SpatialJoin(
+    const api::ObjectBook<Coordinate>& lhs, const api::ObjectBook<Coordinate>& rhs,
+    const maliput::math::OverlappingType& overlapping_type, int num_threads = 0,
+    double tolerance = ManualObjectBook<Coordinate>::kDefaultIndexTolerance);
+
+}  // namespace object
+}  // namespace maliput
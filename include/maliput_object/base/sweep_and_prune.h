@@ -0,0 +1,136 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+#include "maliput_object/base/memory_usage.h"
+
+namespace maliput {
+namespace object {
+
+/// Sweep-and-prune broad phase that finds the pairs of api::Objects whose bounding regions overlap.
+///
+/// The axis-aligned boxes of the objects are kept sorted by their minimum corner along one axis, so a sweep only
+/// compares boxes whose extents along that axis overlap. The order is kept between calls to Update(): boxes are
+/// refreshed in place and re-sorted with an insertion sort, which takes close to linear time when objects barely move
+/// between steps, as in mostly static scenes. The order is built from scratch, along the axis the boxes' centers spread
+/// the most along, when many objects are added at once.
+///
+/// Objects whose bounding region is not supported by ComputeAxisAlignedBox() are paired with every other object.
+///
+/// It does not own the objects.
+template <typename Coordinate>
+class SweepAndPrune {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SweepAndPrune)
+
+  /// Constructs an empty SweepAndPrune.
+  /// @param tolerance Non-negative distance every object's axis-aligned box is inflated by.
+  /// @throws maliput::common::assertion_error When @p tolerance is negative.
+  explicit SweepAndPrune(double tolerance);
+
+  ~SweepAndPrune() = default;
+
+  /// Replaces the objects of the broad phase. Objects are matched to the previous ones by id, so that they keep their
+  /// place in the sorted order even when they were replaced by a new Object with the same id. The previous objects
+  /// need not be alive anymore.
+  /// @param objects The objects. They must not be nullptr and their ids must be unique.
+  /// @throws maliput::common::assertion_error When any of @p objects is nullptr.
+  void Update(const std::vector<api::Object<Coordinate>*>& objects);
+
+  /// Adds @p object to the broad phase, at its place in the sorted order.
+  /// @param object The object. Its id must not be in the broad phase already.
+  /// @throws maliput::common::assertion_error When @p object is nullptr.
+  void Insert(api::Object<Coordinate>* object);
+
+  /// Removes the object whose id is @p id from the broad phase, keeping the order of the others.
+  /// @param id The id of the object.
+  /// @returns Whether the object was in the broad phase.
+  bool Remove(const typename api::Object<Coordinate>::Id& id);
+
+  /// Calls @p visitor with every pair of objects whose axis-aligned boxes overlap, and with every pair that involves
+  /// an object that could not be bounded. Candidates are not checked against their actual bounding regions.
+  /// @param visitor Function called once per candidate pair.
+  void VisitCandidatePairs(
+      const std::function<void(api::Object<Coordinate>*, api::Object<Coordinate>*)>& visitor) const;
+
+  /// Finds every pair of objects whose bounding regions overlap. Candidate pairs are confirmed with
+  /// maliput::math::BoundingRegion::Overlaps(), which is exact for pairs of maliput::math::BoundingBox.
+  /// @param num_candidates When not nullptr, it is set to the number of candidate pairs that were confirmed.
+  /// @returns The pairs, the object with the smaller id first, sorted by the ids of their objects.
+  std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> FindOverlappingPairs(
+      std::size_t* num_candidates = nullptr) const;
+
+  /// @returns The number of objects.
+  int size() const { return static_cast<int>(entries_.size() + unbounded_.size()); }
+
+  /// @returns The axis the boxes are sorted along.
+  int axis() const { return axis_; }
+
+  /// @returns The memory used by the sorted boxes, accounted as MemoryUsageReport::index. Objects are not included.
+  MemoryUsageReport MemoryUsage() const;
+
+ private:
+  // An object and its box. The id is kept so that Update() does not need the previous object.
+  struct Entry {
+    AxisAlignedBox<Coordinate> box;
+    api::Object<Coordinate>* object{};
+    typename api::Object<Coordinate>::Id id;
+  };
+
+  // Sorts entries_ from scratch along the axis their centers spread the most along.
+  void Sort();
+
+  double tolerance_{};
+  int axis_{0};
+  // Sorted by the minimum corner of their box along axis_.
+  std::vector<Entry> entries_;
+  std::vector<api::Object<Coordinate>*> unbounded_;
+};
+
+/// Finds every pair of @p objects whose bounding regions overlap with a one-shot SweepAndPrune.
+/// @param objects The objects. They must not be nullptr and their ids must be unique.
+/// @param tolerance Non-negative distance every object's axis-aligned box is inflated by.
+/// @returns The pairs. See SweepAndPrune::FindOverlappingPairs().
+/// @throws maliput::common::assertion_error When any of @p objects is nullptr or @p tolerance is negative.
+template <typename Coordinate>
+std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> FindOverlappingPairs(
+    const std::vector<api::Object<Coordinate>*>& objects, double tolerance);
+
+}  // namespace object
+}  // namespace maliput
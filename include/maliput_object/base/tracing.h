@@ -0,0 +1,97 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include <maliput/common/maliput_copyable.h>
+
+/// @file tracing.h
+///
+/// Scoped trace spans of the query phases and loader stages, written in the Chrome trace event format so they can be
+/// opened with Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+///
+/// Spans are compiled in only when the package is built with `-DMALIPUT_OBJECT_TRACING=On`. Otherwise
+/// MALIPUT_OBJECT_TRACE_SPAN expands to nothing and StartTracing() and StopTracing() write a trace with no events.
+///
+/// @code{.cpp}
+/// maliput::object::StartTracing("/tmp/maliput_object.json");
+/// object_query.FindOverlappingLanesIn(object);
+/// maliput::object::StopTracing();
+/// @endcode
+
+#define MALIPUT_OBJECT_TRACE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define MALIPUT_OBJECT_TRACE_CONCAT(lhs, rhs) MALIPUT_OBJECT_TRACE_CONCAT_IMPL(lhs, rhs)
+
+#ifdef MALIPUT_OBJECT_TRACING
+/// Emits a span named @p name that lasts until the end of the enclosing scope. @p name must be a string literal.
+#define MALIPUT_OBJECT_TRACE_SPAN(name) \
+  const ::maliput::object::TraceSpan MALIPUT_OBJECT_TRACE_CONCAT(maliput_object_trace_span_, __LINE__)(name)
+#else
+#define MALIPUT_OBJECT_TRACE_SPAN(name)
+#endif
+
+namespace maliput {
+namespace object {
+
+/// Starts collecting trace spans.
+/// @param filename Path of the file StopTracing() writes the trace to. It is truncated.
+/// @throws maliput::common::assertion_error When tracing already started or when @p filename cannot be opened.
+void StartTracing(const std::string& filename);
+
+/// Stops collecting trace spans and writes the ones collected since StartTracing() was called.
+/// Spans that are still open are dropped.
+/// @throws maliput::common::assertion_error When tracing did not start.
+void StopTracing();
+
+/// @returns Whether trace spans are being collected.
+bool TracingActive();
+
+/// Records a complete event covering its lifetime, when tracing is active at construction and destruction.
+/// Prefer MALIPUT_OBJECT_TRACE_SPAN, which compiles out when tracing is disabled.
+class TraceSpan {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(TraceSpan)
+
+  /// Constructs a TraceSpan.
+  /// @param name Name of the span. It must outlive the trace, e.g. a string literal.
+  explicit TraceSpan(const char* name);
+
+  ~TraceSpan();
+
+ private:
+  const char* name_;
+  const bool active_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,109 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <maliput/api/road_geometry.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+
+namespace maliput {
+namespace object {
+namespace generator {
+
+/// How the positions of the generated objects are distributed.
+enum class SpatialDistribution {
+  /// Uniformly over the box spanned by GeneratorConfig::region_min and GeneratorConfig::region_max.
+  kUniform,
+  /// Around GeneratorConfig::num_clusters centers that are uniformly distributed over the region. Positions follow a
+  /// normal distribution of GeneratorConfig::cluster_radius standard deviation around their center and are clamped
+  /// to the region.
+  kClustered,
+  /// Over the lanes of GeneratorConfig::road_geometry. Lanes are picked with a probability proportional to their
+  /// length, and objects are placed uniformly within the lane bounds, resting on the road and heading along the lane.
+  kAlongLanes,
+};
+
+/// Parameters of GenerateObjects(). Every random quantity is drawn from uniform distributions unless stated otherwise.
+struct GeneratorConfig {
+  /// Number of objects to generate.
+  int num_objects{1000};
+  /// Seed of the random number generator. The same configuration always generates the same objects.
+  unsigned int seed{0};
+
+  /// How object positions are distributed.
+  SpatialDistribution spatial_distribution{SpatialDistribution::kUniform};
+  /// Corners of the region objects are placed in, for SpatialDistribution::kUniform and
+  /// SpatialDistribution::kClustered.
+  maliput::math::Vector3 region_min{0., 0., 0.};
+  maliput::math::Vector3 region_max{1000., 1000., 0.};
+  /// Number of clusters, for SpatialDistribution::kClustered.
+  int num_clusters{10};
+  /// Standard deviation of the positions around their cluster center, for SpatialDistribution::kClustered.
+  double cluster_radius{20.};
+  /// Road geometry, for SpatialDistribution::kAlongLanes. It must outlive the call to GenerateObjects().
+  const maliput::api::RoadGeometry* road_geometry{nullptr};
+
+  /// Range of the box sizes, per axis.
+  maliput::math::Vector3 min_box_size{1., 1., 1.};
+  maliput::math::Vector3 max_box_size{3., 3., 3.};
+  /// Yaw angles are drawn from [-max_yaw, max_yaw]. For SpatialDistribution::kAlongLanes, relative to the lane heading.
+  double max_yaw{M_PI};
+  /// Tolerance of the objects' bounding boxes.
+  double tolerance{1e-3};
+
+  /// Number of properties per object. Keys are `property_<k>` with k in [0, num_properties).
+  int num_properties{1};
+  /// Number of distinct values every property takes. Values are `value_<v>` with v in [0, property_cardinality).
+  int property_cardinality{4};
+};
+
+/// Generates objects with bounding boxes as described by @p config. Ids are `object_<i>` with i in
+/// [0, config.num_objects).
+/// @param config The generator parameters.
+/// @throws maliput::common::assertion_error When @p config is not valid: negative counts or distances, inverted ranges,
+///         or no road geometry with lanes for SpatialDistribution::kAlongLanes.
+/// @returns The generated objects.
+std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> GenerateObjects(const GeneratorConfig& config);
+
+/// Serializes @p objects as a `maliput_objects` YAML document. See @ref maliput_object_yaml_spec.
+/// @param objects The objects to serialize. Their bounding regions must be maliput::math::BoundingBox.
+/// @throws maliput::common::assertion_error When any of @p objects is nullptr or is not bounded by a box.
+/// @returns The YAML document.
+std::string ToYamlDocument(const std::vector<const api::Object<maliput::math::Vector3>*>& objects);
+
+}  // namespace generator
+}  // namespace object
+}  // namespace maliput
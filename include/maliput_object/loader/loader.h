@@ -29,12 +29,18 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <maliput/math/vector.h>
 
+#include "maliput_object/api/object.h"
+
 #include "maliput_object/api/object_book.h"
+#include "maliput_object/base/object_lane_associations.h"
 
 /// @file loader.h
 /// @page maliput_object_yaml_spec Maliput Object YAML specification
@@ -50,6 +56,13 @@
 /// - @ref maliput::object::loader::LoadFile() for YAML files.
 /// - @ref maliput::object::loader::Load() for string serialized YAML descriptions.
 ///
+/// Both have an overload taking maliput::object::loader::LoadOptions, which allows
+/// building the book's spatial index on a background thread.
+///
+/// A loaded ObjectBook can be updated in place after the document is edited with
+/// @ref maliput::object::loader::Reload() or @ref maliput::object::loader::ReloadFile().
+/// Only the objects that were added, removed or changed are touched.
+///
 /// The only supported type of coordinate is maliput::math::Vector3 , meaning
 /// that concrete @ref maliput::math::BoundingRegion "BoundingRegions"
 /// are limited to @ref maliput::math::BoundingBox "BoundingBox".
@@ -136,10 +149,68 @@
 ///
 /// - `user_defined_prop_1` and `user_defined_prop_n` are examples of keys.
 /// - `my_value_1` and `my_value_n` are examples of values.
+///
+/// @subsection maliput_object_yaml_lane_associations Precomputed lane associations
+///
+/// Optionally, a document may carry the lanes every object overlaps with for a given Road Network,
+/// as computed by maliput::object::ComputeObjectLaneAssociations(). The `maliput_object_bake_lanes`
+/// application adds this section to an existing document. See:
+/// - @ref maliput::object::loader::LoadLaneAssociations() for string serialized YAML descriptions.
+/// - @ref maliput::object::loader::LoadLaneAssociationsFile() for YAML files.
+///
+/// @code{.yml}
+/// maliput_objects_lane_associations:
+///   road_network_hash: 0123456789abcdef
+///   objects:
+///     my_awesome_object:
+///       - lane_id: lane_1
+///         lane_position: [S, R, H]
+///         s_range: [S_MIN, S_MAX]
+///         r_range: [R_MIN, R_MAX]
+///       ...
+///     my_lonely_object: []
+///   ...
+///   object_hashes:
+///     my_awesome_object: 0123456789abcdef
+///   ...
+/// @endcode
+///
+/// Where:
+///
+/// - `road_network_hash`: is the hash of the Road Network the associations were computed for.
+///   See maliput::object::ComputeRoadNetworkHash().
+/// - `objects`: is a dictionary whose keys are object ids and whose values are the listings of
+///   lanes each object overlaps with. Objects overlapping with no lane have an empty listing.
+/// - `lane_id`: is the id of the lane.
+/// - `lane_position`: is the object's position in the Lane Frame.
+/// - `s_range` and `r_range`: are the ranges of Lane Frame coordinates covered by the object.
+/// - `object_hashes`: is an optional dictionary whose keys are object ids and whose values are the hashes of the
+///   objects the lanes were computed for. See maliput::object::ComputeObjectHash(). The lanes of objects whose hash
+///   no longer matches, e.g. after maliput::object::loader::Reload(), are computed again.
 namespace maliput {
 namespace object {
 namespace loader {
 
+/// Options to tune how the ObjectBook is built.
+struct LoadOptions {
+  /// When true, the spatial index of the ObjectBook is built on a background thread and the loading functions return
+  /// right after parsing. The book answers queries by linear search until the index is ready.
+  bool build_index_in_background{false};
+  /// Optional function called once the spatial index is in use. When @ref build_index_in_background is true it is
+  /// called from the background thread.
+  std::function<void()> on_index_ready{nullptr};
+};
+
+/// Changes applied to an ObjectBook by Reload() or ReloadFile().
+struct ReloadResult {
+  /// Ids of the objects that were not in the book, sorted.
+  std::vector<api::Object<maliput::math::Vector3>::Id> added;
+  /// Ids of the objects that are no longer in the document, sorted.
+  std::vector<api::Object<maliput::math::Vector3>::Id> removed;
+  /// Ids of the objects whose bounding region or properties changed, sorted.
+  std::vector<api::Object<maliput::math::Vector3>::Id> changed;
+};
+
 /// Loads the @p input string as a `maliput_object` YAML document.
 /// See @ref loader.h documentation for further details.
 ///
@@ -148,6 +219,16 @@ namespace loader {
 /// @return A maliput::object::api::ObjectBook<maliput::math::Vector3> representing the @p input.
 std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> Load(const std::string& input);
 
+/// Loads the @p input string as a `maliput_object` YAML document.
+/// See @ref loader.h documentation for further details.
+///
+/// @param input A YAML document as a string that must contain a node as described in @ref loader.h
+/// @param options Options to build the ObjectBook with.
+/// @throws maliput::common::assertion_error When @p input fails to be parsed.
+/// @return A maliput::object::api::ObjectBook<maliput::math::Vector3> representing the @p input.
+std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> Load(const std::string& input,
+                                                                               const LoadOptions& options);
+
 /// Loads the @p filename file as a `maliput_object` YAML document.
 /// See @ref loader.h documentation for further details.
 ///
@@ -156,6 +237,66 @@ std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> Load(c
 /// @return A maliput::object::api::ObjectBook<maliput::math::Vector3> representing the contents of @p filename.
 std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> LoadFile(const std::string& filename);
 
+/// Loads the @p filename file as a `maliput_object` YAML document.
+/// See @ref loader.h documentation for further details.
+///
+/// @param filename The path to the YAML document.
+/// @param options Options to build the ObjectBook with.
+/// @throws maliput::common::assertion_error When @p input fails to be parsed.
+/// @return A maliput::object::api::ObjectBook<maliput::math::Vector3> representing the contents of @p filename.
+std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> LoadFile(const std::string& filename,
+                                                                                   const LoadOptions& options);
+
+/// Updates @p object_book so that it represents the @p input string, a `maliput_object` YAML document.
+///
+/// Objects are matched by id and compared by their bounding regions and properties. Only the objects that were added,
+/// removed or changed are updated, so unchanged objects keep their address. Changed objects are replaced by new ones.
+/// The book's spatial index is rebuilt only once the objects it is out of date by exceed a quarter of the book, see
+/// ManualObjectBook::num_stale_index_entries().
+///
+/// @param input A YAML document as a string that must contain a node as described in @ref loader.h
+/// @param object_book The book to update. It must have been created by Load() or LoadFile().
+/// @throws maliput::common::assertion_error When @p object_book is nullptr or was not created by this loader.
+/// @throws maliput::common::assertion_error When @p input fails to be parsed. @p object_book is left untouched.
+/// @return The changes applied to @p object_book.
+ReloadResult Reload(const std::string& input, maliput::object::api::ObjectBook<maliput::math::Vector3>* object_book);
+
+/// Updates @p object_book so that it represents the contents of @p filename, a `maliput_object` YAML document.
+/// See Reload() for further details.
+///
+/// @param filename The path to the YAML document.
+/// @param object_book The book to update. It must have been created by Load() or LoadFile().
+/// @throws maliput::common::assertion_error When @p object_book is nullptr or was not created by this loader.
+/// @throws maliput::common::assertion_error When @p filename fails to be parsed. @p object_book is left untouched.
+/// @return The changes applied to @p object_book.
+ReloadResult ReloadFile(const std::string& filename,
+                        maliput::object::api::ObjectBook<maliput::math::Vector3>* object_book);
+
+/// Loads the precomputed lane associations of the @p input string.
+/// See @ref maliput_object_yaml_lane_associations for further details.
+///
+/// @param input A YAML document as a string.
+/// @throws maliput::common::assertion_error When the lane associations section fails to be parsed.
+/// @return The lane associations, or std::nullopt when @p input has no lane associations section.
+std::optional<ObjectLaneAssociations> LoadLaneAssociations(const std::string& input);
+
+/// Loads the precomputed lane associations of the @p filename file.
+/// See @ref maliput_object_yaml_lane_associations for further details.
+///
+/// @param filename The path to the YAML document.
+/// @throws maliput::common::assertion_error When the lane associations section fails to be parsed.
+/// @return The lane associations, or std::nullopt when @p filename has no lane associations section.
+std::optional<ObjectLaneAssociations> LoadLaneAssociationsFile(const std::string& filename);
+
+/// Adds @p lane_associations to the @p input string, replacing any existing lane associations section.
+/// See @ref maliput_object_yaml_lane_associations for further details.
+///
+/// @param input A YAML document as a string.
+/// @param lane_associations The lane associations to add.
+/// @throws maliput::common::assertion_error When @p input is not a mapping.
+/// @return The resulting YAML document as a string.
+std::string AddLaneAssociations(const std::string& input, const ObjectLaneAssociations& lane_associations);
+
 }  // namespace loader
 }  // namespace object
 }  // namespace maliput
@@ -27,7 +27,9 @@
 // CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <functional>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -59,6 +61,16 @@ class MockObjectBook : public api::ObjectBook<Coordinate> {
   MOCK_METHOD((std::vector<api::Object<Coordinate>*>), DoFindOverlappingIn,
               (const maliput::math::BoundingRegion<Coordinate>&, const maliput::math::OverlappingType&),
               (const, override));
+  MOCK_METHOD((std::vector<api::Object<Coordinate>*>), DoFindNearest,
+              (const Coordinate&, int, const std::function<bool(const api::Object<Coordinate>*)>&), (const, override));
+  MOCK_METHOD((std::vector<api::Object<Coordinate>*>), DoFindWithinDistance, (const Coordinate&, double),
+              (const, override));
+  MOCK_METHOD((std::vector<api::RayHit<Coordinate>>), DoRayCastAll, (const api::Ray<Coordinate>&), (const, override));
+  MOCK_METHOD((void), DoRayCast,
+              (const std::vector<api::Ray<Coordinate>>&, std::vector<std::optional<api::RayHit<Coordinate>>>*),
+              (const, override));
+  MOCK_METHOD((std::vector<api::Object<Coordinate>*>), DoFindInFrustum, (const api::Frustum<Coordinate>&),
+              (const, override));
 };
 
 class MockObjectQuery : public api::ObjectQuery {
@@ -70,6 +82,24 @@ class MockObjectQuery : public api::ObjectQuery {
   MOCK_METHOD((std::optional<const maliput::api::LaneSRoute>), DoRoute,
               (const api::Object<maliput::math::Vector3>*, const api::Object<maliput::math::Vector3>*),
               (const, override));
+  MOCK_METHOD((std::optional<const maliput::api::LaneSRoute>), DoRoute,
+              (const api::Object<maliput::math::Vector3>*, const api::Object<maliput::math::Vector3>*,
+               const api::RouteAvoidance&),
+              (const, override));
+  MOCK_METHOD((std::vector<const api::Object<maliput::math::Vector3>*>), DoFindObjectsOnLane,
+              (const maliput::api::LaneId&, const maliput::api::SRange&), (const, override));
+  MOCK_METHOD((std::vector<maliput::api::SRange>), DoFindFreeGaps,
+              (const maliput::api::LaneId&, const maliput::api::SRange&, double), (const, override));
+  MOCK_METHOD((std::vector<api::ObjectAlongRoute>), DoFindObjectsAlongRoute, (const maliput::api::LaneSRoute&, double),
+              (const, override));
+  MOCK_METHOD((std::vector<api::ObjectAhead>), DoFindNextObjectsAhead,
+              (const maliput::api::RoadPosition&, double,
+               const std::function<bool(const api::Object<maliput::math::Vector3>*)>&),
+              (const, override));
+  MOCK_METHOD((std::vector<std::vector<api::ObjectDistance>>), DoFindNearestNeighbors,
+              (const std::vector<const api::Object<maliput::math::Vector3>*>&, int, double), (const, override));
+  MOCK_METHOD((std::vector<std::vector<api::LaneClearance>>), DoFindLaneClearances,
+              (const std::vector<const api::Object<maliput::math::Vector3>*>&, double), (const, override));
   MOCK_METHOD((const api::ObjectBook<maliput::math::Vector3>*), do_object_book, (), (const, override));
   MOCK_METHOD((const maliput::api::RoadNetwork*), do_road_network, (), (const, override));
 };
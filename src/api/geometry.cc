@@ -0,0 +1,244 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/api/geometry.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/matrix.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace object {
+namespace api {
+namespace {
+
+constexpr std::size_t kDimensions{3};
+
+// Slab test of the ray defined by @p origin and @p direction against the axis-aligned box centered at the origin
+// with half size @p half_size.
+template <typename Coordinate>
+std::optional<double> IntersectCenteredBox(const Coordinate& half_size, const Coordinate& origin,
+                                           const Coordinate& direction, double max_range) {
+  double t_min{0.};
+  double t_max{max_range};
+  for (std::size_t i = 0; i < kDimensions; ++i) {
+    if (direction[i] == 0.) {
+      // The ray is parallel to the slab.
+      if (std::abs(origin[i]) > half_size[i]) {
+        return std::nullopt;
+      }
+      continue;
+    }
+    const double inverse_direction = 1. / direction[i];
+    const double t_a = (-half_size[i] - origin[i]) * inverse_direction;
+    const double t_b = (half_size[i] - origin[i]) * inverse_direction;
+    t_min = std::max(t_min, std::min(t_a, t_b));
+    t_max = std::min(t_max, std::max(t_a, t_b));
+    if (t_min > t_max) {
+      return std::nullopt;
+    }
+  }
+  return t_min;
+}
+
+// @returns The squared distance between the segments [p0, p1] and [q0, q1]. See "Real-Time Collision Detection",
+// C. Ericson, section 5.1.9.
+double ComputeSquaredSegmentDistance(const maliput::math::Vector3& p0, const maliput::math::Vector3& p1,
+                                     const maliput::math::Vector3& q0, const maliput::math::Vector3& q1) {
+  constexpr double kEpsilon{1e-12};
+  const maliput::math::Vector3 d1 = p1 - p0;
+  const maliput::math::Vector3 d2 = q1 - q0;
+  const maliput::math::Vector3 r = p0 - q0;
+  const double a = d1.dot(d1);
+  const double e = d2.dot(d2);
+  const double f = d2.dot(r);
+  double s{0.};
+  double t{0.};
+  if (a <= kEpsilon && e <= kEpsilon) {
+    return r.dot(r);
+  }
+  if (a <= kEpsilon) {
+    t = std::clamp(f / e, 0., 1.);
+  } else {
+    const double c = d1.dot(r);
+    if (e <= kEpsilon) {
+      s = std::clamp(-c / a, 0., 1.);
+    } else {
+      const double b = d1.dot(d2);
+      const double denominator = a * e - b * b;
+      // Parallel segments take any s, e.g. zero.
+      s = denominator > kEpsilon ? std::clamp((b * f - c * e) / denominator, 0., 1.) : 0.;
+      t = (b * s + f) / e;
+      if (t < 0.) {
+        t = 0.;
+        s = std::clamp(-c / a, 0., 1.);
+      } else if (t > 1.) {
+        t = 1.;
+        s = std::clamp((b - c) / a, 0., 1.);
+      }
+    }
+  }
+  const maliput::math::Vector3 difference = (p0 + d1 * s) - (q0 + d2 * t);
+  return difference.dot(difference);
+}
+
+// @returns The twelve edges of @p box.
+std::array<std::pair<maliput::math::Vector3, maliput::math::Vector3>, 12> ComputeEdges(
+    const maliput::math::BoundingBox& box) {
+  const maliput::math::Matrix3 rotation = box.get_orientation().ToMatrix();
+  const maliput::math::Vector3 half_size = box.box_size() / 2.;
+  std::array<std::pair<maliput::math::Vector3, maliput::math::Vector3>, 12> edges;
+  std::size_t edge{0};
+  // Every edge runs along one axis of the box, at one of the four corners of the other two.
+  for (std::size_t axis = 0; axis < kDimensions; ++axis) {
+    for (const double first_sign : {-1., 1.}) {
+      for (const double second_sign : {-1., 1.}) {
+        maliput::math::Vector3 start{0., 0., 0.};
+        start[(axis + 1) % kDimensions] = first_sign * half_size[(axis + 1) % kDimensions];
+        start[(axis + 2) % kDimensions] = second_sign * half_size[(axis + 2) % kDimensions];
+        maliput::math::Vector3 end{start};
+        start[axis] = -half_size[axis];
+        end[axis] = half_size[axis];
+        edges[edge++] = {rotation * start + box.position(), rotation * end + box.position()};
+      }
+    }
+  }
+  return edges;
+}
+
+}  // namespace
+
+template <typename Coordinate>
+double ComputeDistance(const maliput::math::BoundingRegion<Coordinate>& region, const Coordinate& position) {
+  const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&region);
+  if (bounding_box == nullptr) {
+    return (position - region.position()).norm();
+  }
+  // The position in the box frame, where the box is centered at the origin and aligned with the axes.
+  const Coordinate local_position =
+      bounding_box->get_orientation().ToMatrix().transpose() * (position - bounding_box->position());
+  double squared_distance{0.};
+  for (std::size_t i = 0; i < kDimensions; ++i) {
+    const double excess = std::max(std::abs(local_position[i]) - bounding_box->box_size()[i] / 2., 0.);
+    squared_distance += excess * excess;
+  }
+  return std::sqrt(squared_distance);
+}
+
+template <typename Coordinate>
+double ComputeDistance(const maliput::math::BoundingRegion<Coordinate>& lhs,
+                       const maliput::math::BoundingRegion<Coordinate>& rhs) {
+  const auto* lhs_box = dynamic_cast<const maliput::math::BoundingBox*>(&lhs);
+  const auto* rhs_box = dynamic_cast<const maliput::math::BoundingBox*>(&rhs);
+  if (lhs_box == nullptr) {
+    return ComputeDistance(rhs, lhs.position());
+  }
+  if (rhs_box == nullptr) {
+    return ComputeDistance(lhs, rhs.position());
+  }
+  if (lhs_box->Overlaps(*rhs_box) != maliput::math::OverlappingType::kDisjointed) {
+    return 0.;
+  }
+  // The closest points of two disjoint convex polyhedra lie either at a vertex of one of them or on an edge of both.
+  double distance = std::numeric_limits<double>::infinity();
+  for (const auto& vertex : lhs_box->get_vertices()) {
+    distance = std::min(distance, ComputeDistance(rhs, vertex));
+  }
+  for (const auto& vertex : rhs_box->get_vertices()) {
+    distance = std::min(distance, ComputeDistance(lhs, vertex));
+  }
+  const auto lhs_edges = ComputeEdges(*lhs_box);
+  const auto rhs_edges = ComputeEdges(*rhs_box);
+  double squared_distance = distance * distance;
+  for (const auto& lhs_edge : lhs_edges) {
+    for (const auto& rhs_edge : rhs_edges) {
+      squared_distance = std::min(squared_distance, ComputeSquaredSegmentDistance(lhs_edge.first, lhs_edge.second,
+                                                                                  rhs_edge.first, rhs_edge.second));
+    }
+  }
+  return std::sqrt(squared_distance);
+}
+
+template <typename Coordinate>
+std::optional<double> ComputeRayIntersection(const maliput::math::BoundingRegion<Coordinate>& region,
+                                             const Ray<Coordinate>& ray) {
+  const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&region);
+  if (bounding_box == nullptr) {
+    return std::nullopt;
+  }
+  // The ray in the box frame, where the box is centered at the origin and aligned with the axes.
+  const auto to_box_frame = bounding_box->get_orientation().ToMatrix().transpose();
+  const Coordinate origin = to_box_frame * (ray.origin - bounding_box->position());
+  const Coordinate direction = to_box_frame * ray.direction;
+  return IntersectCenteredBox<Coordinate>(bounding_box->box_size() / 2., origin, direction, ray.max_range);
+}
+
+template <typename Coordinate>
+bool OverlapsFrustum(const maliput::math::BoundingRegion<Coordinate>& region, const Frustum<Coordinate>& frustum) {
+  const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&region);
+  if (bounding_box == nullptr) {
+    return std::all_of(frustum.planes.begin(), frustum.planes.end(), [&region](const auto& plane) {
+      return plane.normal.dot(region.position()) + plane.offset >= 0.;
+    });
+  }
+  const auto to_box_frame = bounding_box->get_orientation().ToMatrix().transpose();
+  for (const auto& plane : frustum.planes) {
+    // Projection of the box's half size on the normal of the plane.
+    const Coordinate normal = to_box_frame * plane.normal;
+    double radius{0.};
+    for (std::size_t i = 0; i < kDimensions; ++i) {
+      radius += bounding_box->box_size()[i] / 2. * std::abs(normal[i]);
+    }
+    if (plane.normal.dot(bounding_box->position()) + plane.offset < -radius) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template double ComputeDistance(const maliput::math::BoundingRegion<maliput::math::Vector3>&,
+                                const maliput::math::Vector3&);
+template double ComputeDistance(const maliput::math::BoundingRegion<maliput::math::Vector3>&,
+                                const maliput::math::BoundingRegion<maliput::math::Vector3>&);
+template std::optional<double> ComputeRayIntersection(const maliput::math::BoundingRegion<maliput::math::Vector3>&,
+                                                      const Ray<maliput::math::Vector3>&);
+template bool OverlapsFrustum(const maliput::math::BoundingRegion<maliput::math::Vector3>&,
+                              const Frustum<maliput::math::Vector3>&);
+
+}  // namespace api
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,535 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/api/object_query.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+#include <maliput/api/branch_point.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_box.h>
+
+#include "maliput_object/api/geometry.h"
+
+namespace maliput {
+namespace object {
+namespace api {
+namespace {
+
+// The s- and r-coordinates an Object covers on a Lane.
+struct LaneInterval {
+  const Object<maliput::math::Vector3>* object;
+  double s_min;
+  double s_max;
+  double r_min;
+  double r_max;
+};
+
+// Projects the position of @p object onto @p lane, and the vertices of its box when its bounding region is a
+// maliput::math::BoundingBox.
+LaneInterval ProjectOntoLane(const maliput::api::Lane* lane, const Object<maliput::math::Vector3>* object) {
+  const maliput::api::LanePosition lane_position =
+      lane->ToLanePosition(maliput::api::InertialPosition::FromXyz(object->position())).lane_position;
+  LaneInterval interval{object, lane_position.s(), lane_position.s(), lane_position.r(), lane_position.r()};
+  const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&object->bounding_region());
+  if (bounding_box != nullptr) {
+    for (const maliput::math::Vector3& vertex : bounding_box->get_vertices()) {
+      const maliput::api::LanePosition vertex_lane_position =
+          lane->ToLanePosition(maliput::api::InertialPosition::FromXyz(vertex)).lane_position;
+      interval.s_min = std::min(interval.s_min, vertex_lane_position.s());
+      interval.s_max = std::max(interval.s_max, vertex_lane_position.s());
+      interval.r_min = std::min(interval.r_min, vertex_lane_position.r());
+      interval.r_max = std::max(interval.r_max, vertex_lane_position.r());
+    }
+  }
+  return interval;
+}
+
+// Finds the intervals of the Objects of @p object_query that intersect the Lane identified by @p lane_id within
+// [@p s_min, @p s_max], checking every Object.
+// @returns The intervals, sorted by their s_min. Ties are sorted by id.
+std::vector<LaneInterval> FindIntervalsOnLane(const ObjectQuery& object_query, const maliput::api::LaneId& lane_id,
+                                              double s_min, double s_max) {
+  std::vector<LaneInterval> intervals;
+  for (const auto& id_object : object_query.object_book()->objects()) {
+    object_query.VisitOverlappingLanesIn(
+        id_object.second, maliput::math::OverlappingType::kIntersected,
+        [&intervals, &id_object, &lane_id, s_min, s_max](const maliput::api::Lane* lane) {
+          if (lane->id() != lane_id) {
+            return;
+          }
+          const LaneInterval interval = ProjectOntoLane(lane, id_object.second);
+          if (interval.s_min <= s_max && interval.s_max >= s_min) {
+            intervals.push_back(interval);
+          }
+        });
+  }
+  std::sort(intervals.begin(), intervals.end(), [](const LaneInterval& lhs, const LaneInterval& rhs) {
+    return lhs.s_min != rhs.s_min ? lhs.s_min < rhs.s_min : lhs.object->id().string() < rhs.object->id().string();
+  });
+  return intervals;
+}
+
+// @returns The Objects of @p object_query per Lane they intersect, checking every Object.
+std::unordered_map<maliput::api::LaneId, std::vector<const Object<maliput::math::Vector3>*>> FindObjectsPerLane(
+    const ObjectQuery& object_query) {
+  std::unordered_map<maliput::api::LaneId, std::vector<const Object<maliput::math::Vector3>*>> lane_objects;
+  for (const auto& id_object : object_query.object_book()->objects()) {
+    object_query.VisitOverlappingLanesIn(id_object.second, maliput::math::OverlappingType::kIntersected,
+                                         [&lane_objects, &id_object](const maliput::api::Lane* lane) {
+                                           lane_objects[lane->id()].push_back(id_object.second);
+                                         });
+  }
+  return lane_objects;
+}
+
+}  // namespace
+
+std::optional<const maliput::api::LaneSRoute> ObjectQuery::DoRoute(const Object<maliput::math::Vector3>* origin,
+                                                                   const Object<maliput::math::Vector3>* target,
+                                                                   const RouteAvoidance& avoidance) const {
+  std::unordered_set<maliput::api::LaneId> blocked_lanes;
+  object_book()->VisitByPredicate(avoidance.predicate, [this, &blocked_lanes](const Object<maliput::math::Vector3>*
+                                                                                  object) {
+    VisitOverlappingLanesIn(object, maliput::math::OverlappingType::kIntersected,
+                            [&blocked_lanes](const maliput::api::Lane* lane) { blocked_lanes.insert(lane->id()); });
+  });
+  const maliput::api::RoadGeometry* road_geometry = road_network()->road_geometry();
+  return FindRouteAvoiding(
+      road_geometry->ToRoadPosition(maliput::api::InertialPosition::FromXyz(origin->position())).road_position,
+      road_geometry->ToRoadPosition(maliput::api::InertialPosition::FromXyz(target->position())).road_position,
+      blocked_lanes, avoidance);
+}
+
+std::vector<const Object<maliput::math::Vector3>*> ObjectQuery::DoFindObjectsOnLane(
+    const maliput::api::LaneId& lane_id, const maliput::api::SRange& s_range) const {
+  std::vector<const Object<maliput::math::Vector3>*> objects;
+  for (const LaneInterval& interval : FindIntervalsOnLane(*this, lane_id, std::min(s_range.s0(), s_range.s1()),
+                                                          std::max(s_range.s0(), s_range.s1()))) {
+    objects.push_back(interval.object);
+  }
+  return objects;
+}
+
+std::vector<maliput::api::SRange> ObjectQuery::DoFindFreeGaps(const maliput::api::LaneId& lane_id,
+                                                              const maliput::api::SRange& s_range,
+                                                              double min_gap_length) const {
+  const double s_min = std::min(s_range.s0(), s_range.s1());
+  const double s_max = std::max(s_range.s0(), s_range.s1());
+  std::vector<maliput::api::SRange> gaps;
+  // Intervals are sorted by their s_min, so the Lane is blocked up to gap_start by the intervals visited so far.
+  double gap_start = s_min;
+  const auto add_gap = [&gaps, &gap_start, min_gap_length](double gap_end) {
+    if (gap_end > gap_start && gap_end - gap_start >= min_gap_length) {
+      gaps.emplace_back(gap_start, gap_end);
+    }
+  };
+  for (const LaneInterval& interval : FindIntervalsOnLane(*this, lane_id, s_min, s_max)) {
+    add_gap(interval.s_min);
+    gap_start = std::max(gap_start, interval.s_max);
+  }
+  add_gap(s_max);
+  return gaps;
+}
+
+std::vector<ObjectAlongRoute> ObjectQuery::DoFindObjectsAlongRoute(const maliput::api::LaneSRoute& route,
+                                                                  double lateral_margin) const {
+  const auto lane_objects = FindObjectsPerLane(*this);
+  const auto find_objects = [&lane_objects](const maliput::api::LaneId& lane_id) {
+    const auto it = lane_objects.find(lane_id);
+    return it != lane_objects.end() ? it->second : std::vector<const Object<maliput::math::Vector3>*>{};
+  };
+  // Smallest route s of every Object found so far.
+  std::unordered_map<const Object<maliput::math::Vector3>*, double> route_s;
+  double range_start_s{0.};
+  for (const maliput::api::LaneSRange& range : route.ranges()) {
+    const double s0 = range.s_range().s0();
+    const double s1 = range.s_range().s1();
+    const double s_min = std::min(s0, s1);
+    const double s_max = std::max(s0, s1);
+    const maliput::api::Lane* lane = road_network()->road_geometry()->ById().GetLane(range.lane_id());
+    // Offers @p object when it covers the range within @p lateral_distance of the lane bounds of @p lane, at the
+    // first point of the range it covers. The range is travelled from s0 to s1.
+    const auto offer = [&route_s, lane, range_start_s, s0, s1, s_min, s_max](
+                           const Object<maliput::math::Vector3>* object, double lateral_distance) {
+      const LaneInterval interval = ProjectOntoLane(lane, object);
+      if (interval.s_min > s_max || interval.s_max < s_min) {
+        return;
+      }
+      const double interval_s_min = std::max(interval.s_min, s_min);
+      const double interval_s_max = std::min(interval.s_max, s_max);
+      const maliput::api::RBounds start_bounds = lane->lane_bounds(interval_s_min);
+      const maliput::api::RBounds end_bounds = lane->lane_bounds(interval_s_max);
+      if (interval.r_min > std::max(start_bounds.max(), end_bounds.max()) + lateral_distance ||
+          interval.r_max < std::min(start_bounds.min(), end_bounds.min()) - lateral_distance) {
+        return;
+      }
+      const double s = range_start_s + (s0 <= s1 ? interval_s_min - s0 : s0 - interval_s_max);
+      const auto it = route_s.emplace(object, s).first;
+      it->second = std::min(it->second, s);
+    };
+    if (lane != nullptr) {
+      for (const Object<maliput::math::Vector3>* object : find_objects(range.lane_id())) {
+        offer(object, std::numeric_limits<double>::infinity());
+      }
+      // Objects on the adjacent Lanes the margin reaches are projected onto the Lane of the range.
+      const maliput::api::InertialPosition range_middle = lane->ToInertialPosition({(s_min + s_max) / 2., 0., 0.});
+      for (const bool to_left : {true, false}) {
+        double width{0.};
+        for (const maliput::api::Lane* adjacent = to_left ? lane->to_left() : lane->to_right();
+             adjacent != nullptr && width < lateral_margin;
+             adjacent = to_left ? adjacent->to_left() : adjacent->to_right()) {
+          for (const Object<maliput::math::Vector3>* object : find_objects(adjacent->id())) {
+            offer(object, lateral_margin);
+          }
+          const maliput::api::RBounds adjacent_bounds =
+              adjacent->lane_bounds(adjacent->ToLanePosition(range_middle).lane_position.s());
+          width += adjacent_bounds.max() - adjacent_bounds.min();
+        }
+      }
+    }
+    range_start_s += s_max - s_min;
+  }
+  std::vector<ObjectAlongRoute> objects;
+  objects.reserve(route_s.size());
+  for (const auto& object_s : route_s) {
+    objects.push_back({object_s.first, object_s.second});
+  }
+  std::sort(objects.begin(), objects.end(), [](const ObjectAlongRoute& lhs, const ObjectAlongRoute& rhs) {
+    return lhs.route_s != rhs.route_s ? lhs.route_s < rhs.route_s
+                                      : lhs.object->id().string() < rhs.object->id().string();
+  });
+  return objects;
+}
+
+std::vector<ObjectAhead> ObjectQuery::DoFindNextObjectsAhead(
+    const maliput::api::RoadPosition& road_position, double horizon,
+    const std::function<bool(const Object<maliput::math::Vector3>*)>& predicate) const {
+  const auto lane_objects = FindObjectsPerLane(*this);
+  // A Lane to look ahead on: the s-coordinate it is entered at, whether it is travelled towards increasing s and the
+  // distance travelled before entering it.
+  struct Step {
+    const maliput::api::Lane* lane;
+    double s;
+    bool increasing;
+    double distance;
+  };
+  std::vector<Step> pending{{road_position.lane,
+                             std::clamp(road_position.pos.s(), 0., road_position.lane->length()), true, 0.}};
+  // Shortest distance every Lane was entered at one of its ends, per direction of travel. See
+  // FindNextObjectsAhead() for how branches end.
+  std::map<std::pair<const maliput::api::Lane*, bool>, double> entered;
+  std::unordered_map<const Object<maliput::math::Vector3>*, ObjectAhead> closest;
+  for (bool first_step = true; !pending.empty(); first_step = false) {
+    const Step step = pending.back();
+    pending.pop_back();
+    const auto [it, inserted] = first_step ? std::make_pair(entered.end(), true)
+                                           : entered.emplace(std::make_pair(step.lane, step.increasing), step.distance);
+    if (!inserted) {
+      if (it->second <= step.distance) {
+        continue;
+      }
+      it->second = step.distance;
+    }
+    const double remaining = horizon - step.distance;
+    const double length = step.lane->length();
+    const double s_min = step.increasing ? step.s : std::max(step.s - remaining, 0.);
+    const double s_max = step.increasing ? std::min(step.s + remaining, length) : step.s;
+    std::optional<ObjectAhead> found;
+    const auto lane_objects_it = lane_objects.find(step.lane->id());
+    if (lane_objects_it != lane_objects.end()) {
+      for (const Object<maliput::math::Vector3>* object : lane_objects_it->second) {
+        if (predicate && !predicate(object)) {
+          continue;
+        }
+        const LaneInterval interval = ProjectOntoLane(step.lane, object);
+        if (interval.s_min > s_max || interval.s_max < s_min) {
+          continue;
+        }
+        const double gap =
+            step.distance + std::max(0., step.increasing ? interval.s_min - step.s : step.s - interval.s_max);
+        if (!found.has_value() || gap < found->gap ||
+            (gap == found->gap && object->id().string() < found->object->id().string())) {
+          found = ObjectAhead{object, gap, step.lane};
+        }
+      }
+    }
+    if (found.has_value()) {
+      const auto closest_it = closest.emplace(found->object, *found).first;
+      if (found->gap < closest_it->second.gap) {
+        closest_it->second = *found;
+      }
+      continue;
+    }
+    const double distance_to_end = step.increasing ? length - step.s : step.s;
+    if (step.distance + distance_to_end > horizon) {
+      continue;
+    }
+    const maliput::api::LaneEndSet* ongoing_branches = step.lane->GetOngoingBranches(
+        step.increasing ? maliput::api::LaneEnd::kFinish : maliput::api::LaneEnd::kStart);
+    if (ongoing_branches == nullptr) {
+      continue;
+    }
+    for (int i = 0; i < ongoing_branches->size(); ++i) {
+      const maliput::api::LaneEnd& lane_end = ongoing_branches->get(i);
+      const bool increasing = lane_end.end == maliput::api::LaneEnd::kStart;
+      pending.push_back(
+          {lane_end.lane, increasing ? 0. : lane_end.lane->length(), increasing, step.distance + distance_to_end});
+    }
+  }
+  std::vector<ObjectAhead> objects;
+  objects.reserve(closest.size());
+  for (const auto& object_ahead : closest) {
+    objects.push_back(object_ahead.second);
+  }
+  std::sort(objects.begin(), objects.end(), [](const ObjectAhead& lhs, const ObjectAhead& rhs) {
+    return lhs.gap != rhs.gap ? lhs.gap < rhs.gap : lhs.object->id().string() < rhs.object->id().string();
+  });
+  return objects;
+}
+
+std::vector<std::vector<ObjectDistance>> ObjectQuery::DoFindNearestNeighbors(
+    const std::vector<const Object<maliput::math::Vector3>*>& objects, int k, double max_distance) const {
+  std::vector<std::vector<ObjectDistance>> neighbors;
+  neighbors.reserve(objects.size());
+  for (const Object<maliput::math::Vector3>* object : objects) {
+    // Every point of the region of a box is within half its diagonal of its position, so the Objects within
+    // max_distance of the region are within max_distance plus half the diagonal of the position.
+    const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&object->bounding_region());
+    const double radius = bounding_box != nullptr ? bounding_box->box_size().norm() / 2. : 0.;
+    std::vector<ObjectDistance>& object_neighbors = neighbors.emplace_back();
+    for (const Object<maliput::math::Vector3>* candidate :
+         object_book()->FindWithinDistance(object->position(), max_distance + radius)) {
+      if (candidate->id() == object->id()) {
+        continue;
+      }
+      const double distance = ComputeDistance(object->bounding_region(), candidate->bounding_region());
+      if (distance <= max_distance) {
+        object_neighbors.push_back({candidate, distance});
+      }
+    }
+    std::sort(object_neighbors.begin(), object_neighbors.end(),
+              [](const ObjectDistance& lhs, const ObjectDistance& rhs) {
+                return lhs.distance != rhs.distance ? lhs.distance < rhs.distance
+                                                    : lhs.object->id().string() < rhs.object->id().string();
+              });
+    object_neighbors.resize(std::min(object_neighbors.size(), static_cast<std::size_t>(k)));
+  }
+  return neighbors;
+}
+
+std::vector<std::vector<LaneClearance>> ObjectQuery::DoFindLaneClearances(
+    const std::vector<const Object<maliput::math::Vector3>*>& objects, double max_distance) const {
+  std::vector<std::vector<LaneClearance>> clearances;
+  clearances.reserve(objects.size());
+  for (const Object<maliput::math::Vector3>* object : objects) {
+    clearances.push_back(FindLaneClearancesNear(object, max_distance, nullptr));
+  }
+  return clearances;
+}
+
+std::optional<const maliput::api::LaneSRoute> ObjectQuery::FindRouteAvoiding(
+    const maliput::api::RoadPosition& origin, const maliput::api::RoadPosition& target,
+    const std::unordered_set<maliput::api::LaneId>& blocked_lanes, const RouteAvoidance& avoidance) {
+  MALIPUT_THROW_UNLESS(origin.lane != nullptr);
+  MALIPUT_THROW_UNLESS(target.lane != nullptr);
+  const auto is_blocked = [&blocked_lanes](const maliput::api::Lane* lane) {
+    return blocked_lanes.count(lane->id()) != 0;
+  };
+  const bool exclude = avoidance.mode == RouteAvoidance::Mode::kExclude;
+  if (exclude && (is_blocked(origin.lane) || is_blocked(target.lane))) {
+    return std::nullopt;
+  }
+  // Cost of a range of @p length on @p lane.
+  const auto range_cost = [&is_blocked, &avoidance](const maliput::api::Lane* lane, double length) {
+    return length + (is_blocked(lane) ? avoidance.penalty : 0.);
+  };
+  const double origin_s = std::clamp(origin.pos.s(), 0., origin.lane->length());
+  const double target_s = std::clamp(target.pos.s(), 0., target.lane->length());
+
+  // A Lane travelled in one direction, keyed by the Lane and whether it is travelled towards increasing s: the lowest
+  // cost of the routes that travel it up to its end, the Lane travelled before and the range travelled on it.
+  using Key = std::pair<const maliput::api::Lane*, bool>;
+  struct Visit {
+    double cost;
+    std::optional<Key> previous;
+    double s0;
+    double s1;
+  };
+  std::map<Key, Visit> visits;
+  const auto is_costlier = [](const std::pair<double, Key>& lhs, const std::pair<double, Key>& rhs) {
+    return lhs.first > rhs.first;
+  };
+  std::priority_queue<std::pair<double, Key>, std::vector<std::pair<double, Key>>, decltype(is_costlier)> queue(
+      is_costlier);
+  const auto offer = [&visits, &queue](const Key& key, const Visit& visit) {
+    const auto [it, inserted] = visits.emplace(key, visit);
+    if (!inserted) {
+      if (it->second.cost <= visit.cost) {
+        return;
+      }
+      it->second = visit;
+    }
+    queue.push({visit.cost, key});
+  };
+  // The cheapest route found so far: its cost, the Lane travelled before the Lane of @p target and the s-coordinate
+  // the Lane of @p target is entered at.
+  std::optional<double> best_cost;
+  std::optional<Key> best_previous;
+  double best_s0{origin_s};
+  if (origin.lane == target.lane) {
+    best_cost = range_cost(origin.lane, std::abs(target_s - origin_s));
+  }
+  offer({origin.lane, true}, {range_cost(origin.lane, origin.lane->length() - origin_s), {}, origin_s,
+                              origin.lane->length()});
+  offer({origin.lane, false}, {range_cost(origin.lane, origin_s), {}, origin_s, 0.});
+  while (!queue.empty()) {
+    const auto [cost, key] = queue.top();
+    queue.pop();
+    if (best_cost.has_value() && cost >= best_cost.value()) {
+      break;
+    }
+    if (visits.at(key).cost < cost) {
+      continue;
+    }
+    const maliput::api::LaneEndSet* ongoing_branches =
+        key.first->GetOngoingBranches(key.second ? maliput::api::LaneEnd::kFinish : maliput::api::LaneEnd::kStart);
+    if (ongoing_branches == nullptr) {
+      continue;
+    }
+    for (int i = 0; i < ongoing_branches->size(); ++i) {
+      const maliput::api::LaneEnd& lane_end = ongoing_branches->get(i);
+      if (exclude && is_blocked(lane_end.lane)) {
+        continue;
+      }
+      const bool increasing = lane_end.end == maliput::api::LaneEnd::kStart;
+      const double length = lane_end.lane->length();
+      const double s0 = increasing ? 0. : length;
+      if (lane_end.lane == target.lane) {
+        const double target_cost = cost + range_cost(lane_end.lane, std::abs(target_s - s0));
+        if (!best_cost.has_value() || target_cost < best_cost.value()) {
+          best_cost = target_cost;
+          best_previous = key;
+          best_s0 = s0;
+        }
+      }
+      offer({lane_end.lane, increasing}, {cost + range_cost(lane_end.lane, length), key, s0, length - s0});
+    }
+  }
+  if (!best_cost.has_value()) {
+    return std::nullopt;
+  }
+  std::vector<maliput::api::LaneSRange> ranges{
+      maliput::api::LaneSRange(target.lane->id(), maliput::api::SRange(best_s0, target_s))};
+  for (std::optional<Key> key = best_previous; key.has_value(); key = visits.at(key.value()).previous) {
+    const Visit& visit = visits.at(key.value());
+    ranges.emplace_back(key->first->id(), maliput::api::SRange(visit.s0, visit.s1));
+  }
+  std::reverse(ranges.begin(), ranges.end());
+  return maliput::api::LaneSRoute(ranges);
+}
+
+std::optional<LaneClearance> ObjectQuery::ComputeLaneClearance(
+    const maliput::api::Lane* lane, const std::vector<std::pair<double, maliput::api::RBounds>>& samples,
+    double max_distance) {
+  MALIPUT_THROW_UNLESS(!samples.empty());
+  LaneClearance clearance{lane, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+  // How far the whole Object lies beyond each lane bound. They are positive when the Object is beside the Lane.
+  double beyond_left = std::numeric_limits<double>::infinity();
+  double beyond_right = std::numeric_limits<double>::infinity();
+  for (const auto& [r, bounds] : samples) {
+    clearance.left = std::min(clearance.left, bounds.max() - r);
+    clearance.right = std::min(clearance.right, r - bounds.min());
+    beyond_left = std::min(beyond_left, r - bounds.max());
+    beyond_right = std::min(beyond_right, bounds.min() - r);
+  }
+  const double distance_to_lane = std::max(beyond_left, beyond_right);
+  if (distance_to_lane > max_distance || std::min(clearance.left, clearance.right) > max_distance) {
+    return std::nullopt;
+  }
+  return clearance;
+}
+
+std::vector<LaneClearance> ObjectQuery::FindLaneClearancesNear(const Object<maliput::math::Vector3>* object,
+                                                               double max_distance, std::size_t* num_lanes) const {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  std::vector<maliput::math::Vector3> vertices;
+  const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&object->bounding_region());
+  if (bounding_box != nullptr) {
+    vertices = bounding_box->get_vertices();
+  } else {
+    vertices.assign(1, object->position());
+  }
+  // Every point of the region of a box is within half its diagonal of its position, so the Lanes within max_distance
+  // of the region are within max_distance plus half the diagonal of the position.
+  const double radius = bounding_box != nullptr ? bounding_box->box_size().norm() / 2. : 0.;
+  std::vector<const maliput::api::Lane*> lanes;
+  for (const maliput::api::RoadPositionResult& result : road_network()->road_geometry()->FindRoadPositions(
+           maliput::api::InertialPosition::FromXyz(object->position()), max_distance + radius)) {
+    if (std::find(lanes.begin(), lanes.end(), result.road_position.lane) == lanes.end()) {
+      lanes.push_back(result.road_position.lane);
+    }
+  }
+  if (num_lanes != nullptr) {
+    *num_lanes = lanes.size();
+  }
+  std::vector<LaneClearance> clearances;
+  std::vector<std::pair<double, maliput::api::RBounds>> samples;
+  samples.reserve(vertices.size());
+  for (const maliput::api::Lane* lane : lanes) {
+    samples.clear();
+    for (const maliput::math::Vector3& vertex : vertices) {
+      const maliput::api::LanePosition lane_position =
+          lane->ToLanePosition(maliput::api::InertialPosition::FromXyz(vertex)).lane_position;
+      samples.emplace_back(lane_position.r(), lane->lane_bounds(lane_position.s()));
+    }
+    const std::optional<LaneClearance> clearance = ComputeLaneClearance(lane, samples, max_distance);
+    if (clearance.has_value()) {
+      clearances.push_back(clearance.value());
+    }
+  }
+  std::sort(clearances.begin(), clearances.end(), [](const LaneClearance& lhs, const LaneClearance& rhs) {
+    const double lhs_clearance = std::min(lhs.left, lhs.right);
+    const double rhs_clearance = std::min(rhs.left, rhs.right);
+    return lhs_clearance != rhs_clearance ? lhs_clearance < rhs_clearance
+                                          : lhs.lane->id().string() < rhs.lane->id().string();
+  });
+  return clearances;
+}
+
+}  // namespace api
+}  // namespace object
+}  // namespace maliput
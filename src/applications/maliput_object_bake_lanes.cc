@@ -0,0 +1,114 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/// @file maliput_object_bake_lanes.cc
+///
+/// Precomputes the lanes every object of a `maliput_objects` YAML document overlaps with for a given Road Network,
+/// and writes them as a `maliput_objects_lane_associations` section. See @ref maliput_object_yaml_lane_associations.
+///
+/// Usage:
+/// @code{.sh}
+/// maliput_object_bake_lanes --objects_file=objects.yaml --output_file=baked_objects.yaml
+///     --maliput_backend=maliput_malidrive --road_network_parameters="{opendrive_file: map.xodr}"
+/// @endcode
+///
+/// The output document is re-emitted by yaml-cpp, so comments and formatting of the input are not preserved.
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <gflags/gflags.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/logger.h>
+#include <maliput/plugin/create_road_network.h>
+#include <yaml-cpp/yaml.h>
+
+#include "maliput_object/base/object_lane_associations.h"
+#include "maliput_object/base/simple_object_query.h"
+#include "maliput_object/loader/loader.h"
+
+DEFINE_string(objects_file, "", "Path to the maliput_objects YAML document.");
+DEFINE_string(output_file, "", "Path to write the document with the lane associations to.");
+DEFINE_string(maliput_backend, "maliput_malidrive",
+              "Id of the RoadNetworkLoader plugin to load the Road Network with.");
+DEFINE_string(road_network_parameters, "{}",
+              "YAML mapping with the parameters to load the Road Network with, e.g. \"{opendrive_file: map.xodr}\".");
+
+namespace maliput {
+namespace object {
+namespace applications {
+namespace {
+
+std::string ReadFile(const std::string& filename) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("Unable to open " + filename);
+  }
+  std::stringstream ss;
+  ss << file.rdbuf();
+  return ss.str();
+}
+
+int Main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Precomputes the lanes every object overlaps with for a given Road Network and stores them alongside the "
+      "objects.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  if (FLAGS_objects_file.empty() || FLAGS_output_file.empty()) {
+    std::cerr << "Both --objects_file and --output_file must be provided." << std::endl;
+    return 1;
+  }
+
+  const std::unique_ptr<maliput::api::RoadNetwork> road_network = maliput::plugin::CreateRoadNetwork(
+      FLAGS_maliput_backend, YAML::Load(FLAGS_road_network_parameters).as<std::map<std::string, std::string>>());
+  const std::string objects_yaml = ReadFile(FLAGS_objects_file);
+  const std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book = loader::Load(objects_yaml);
+  const SimpleObjectQuery object_query(road_network.get(), object_book.get());
+
+  maliput::log()->info("Computing lane associations of {} objects...", object_book->objects().size());
+  const ObjectLaneAssociations lane_associations = ComputeObjectLaneAssociations(object_query);
+  maliput::log()->info("Road network hash: {}", lane_associations.road_network_hash);
+
+  std::ofstream output(FLAGS_output_file);
+  output << loader::AddLaneAssociations(objects_yaml, lane_associations) << std::endl;
+  maliput::log()->info("Lane associations written to {}", FLAGS_output_file);
+  return 0;
+}
+
+}  // namespace
+}  // namespace applications
+}  // namespace object
+}  // namespace maliput
+
+int main(int argc, char* argv[]) { return maliput::object::applications::Main(argc, argv); }
@@ -0,0 +1,160 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/// @file maliput_object_generate.cc
+///
+/// Generates synthetic object books for scale testing. See maliput::object::generator::GeneratorConfig for the meaning
+/// of every parameter.
+///
+/// Usage:
+/// @code{.sh}
+/// maliput_object_generate --num_objects=100000 --spatial_distribution=clustered --output_file=objects.yaml
+/// maliput_object_generate --num_objects=100000 --spatial_distribution=along_lanes
+///     --maliput_backend=maliput_malidrive --road_network_parameters="{opendrive_file: map.xodr}"
+///     --output_file=objects.yaml --binary_output_file=/dev/shm/objects.bin
+/// @endcode
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/logger.h>
+#include <maliput/math/vector.h>
+#include <maliput/plugin/create_road_network.h>
+#include <yaml-cpp/yaml.h>
+
+#include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/base/shared_memory_object_book.h"
+#include "maliput_object/generator/generator.h"
+
+DEFINE_int32(num_objects, 1000, "Number of objects to generate.");
+DEFINE_uint32(seed, 0, "Seed of the random number generator.");
+DEFINE_string(spatial_distribution, "uniform", "Distribution of the positions: uniform, clustered or along_lanes.");
+DEFINE_string(region_min, "[0, 0, 0]", "Minimum corner of the region for the uniform and clustered distributions.");
+DEFINE_string(region_max, "[1000, 1000, 0]",
+              "Maximum corner of the region for the uniform and clustered distributions.");
+DEFINE_int32(num_clusters, 10, "Number of clusters for the clustered distribution.");
+DEFINE_double(cluster_radius, 20., "Standard deviation of the positions around their cluster center.");
+DEFINE_string(min_box_size, "[1, 1, 1]", "Minimum size of the boxes.");
+DEFINE_string(max_box_size, "[3, 3, 3]", "Maximum size of the boxes.");
+DEFINE_double(max_yaw, 3.141592653589793, "Maximum yaw angle of the boxes, in radians.");
+DEFINE_int32(num_properties, 1, "Number of properties per object.");
+DEFINE_int32(property_cardinality, 4, "Number of distinct values of every property.");
+DEFINE_string(maliput_backend, "maliput_malidrive",
+              "Id of the RoadNetworkLoader plugin to load the Road Network with, for the along_lanes distribution.");
+DEFINE_string(road_network_parameters, "{}",
+              "YAML mapping with the parameters to load the Road Network with, e.g. \"{opendrive_file: map.xodr}\".");
+DEFINE_string(output_file, "", "Path to write the maliput_objects YAML document to.");
+DEFINE_string(binary_output_file, "", "Path to write the book to in the SharedMemoryObjectBook format.");
+
+namespace maliput {
+namespace object {
+namespace applications {
+namespace {
+
+maliput::math::Vector3 ParseVector3(const std::string& flag) {
+  const std::vector<double> values = YAML::Load(flag).as<std::vector<double>>();
+  if (values.size() != 3) {
+    throw std::runtime_error("Expected a sequence of 3 numbers, got: " + flag);
+  }
+  return maliput::math::Vector3(values[0], values[1], values[2]);
+}
+
+generator::SpatialDistribution ParseSpatialDistribution(const std::string& flag) {
+  const std::map<std::string, generator::SpatialDistribution> distributions{
+      {"uniform", generator::SpatialDistribution::kUniform},
+      {"clustered", generator::SpatialDistribution::kClustered},
+      {"along_lanes", generator::SpatialDistribution::kAlongLanes},
+  };
+  const auto it = distributions.find(flag);
+  if (it == distributions.end()) {
+    throw std::runtime_error("Unknown spatial distribution: " + flag);
+  }
+  return it->second;
+}
+
+int Main(int argc, char* argv[]) {
+  gflags::SetUsageMessage("Generates synthetic object books for scale testing.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  if (FLAGS_output_file.empty() && FLAGS_binary_output_file.empty()) {
+    std::cerr << "At least one of --output_file and --binary_output_file must be provided." << std::endl;
+    return 1;
+  }
+
+  generator::GeneratorConfig config;
+  config.num_objects = FLAGS_num_objects;
+  config.seed = FLAGS_seed;
+  config.spatial_distribution = ParseSpatialDistribution(FLAGS_spatial_distribution);
+  config.region_min = ParseVector3(FLAGS_region_min);
+  config.region_max = ParseVector3(FLAGS_region_max);
+  config.num_clusters = FLAGS_num_clusters;
+  config.cluster_radius = FLAGS_cluster_radius;
+  config.min_box_size = ParseVector3(FLAGS_min_box_size);
+  config.max_box_size = ParseVector3(FLAGS_max_box_size);
+  config.max_yaw = FLAGS_max_yaw;
+  config.num_properties = FLAGS_num_properties;
+  config.property_cardinality = FLAGS_property_cardinality;
+  std::unique_ptr<maliput::api::RoadNetwork> road_network;
+  if (config.spatial_distribution == generator::SpatialDistribution::kAlongLanes) {
+    road_network = maliput::plugin::CreateRoadNetwork(
+        FLAGS_maliput_backend, YAML::Load(FLAGS_road_network_parameters).as<std::map<std::string, std::string>>());
+    config.road_geometry = road_network->road_geometry();
+  }
+
+  std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> objects = generator::GenerateObjects(config);
+  maliput::log()->info("Generated {} objects.", objects.size());
+  if (!FLAGS_output_file.empty()) {
+    std::vector<const api::Object<maliput::math::Vector3>*> object_ptrs;
+    for (const auto& object : objects) {
+      object_ptrs.push_back(object.get());
+    }
+    std::ofstream output(FLAGS_output_file);
+    output << generator::ToYamlDocument(object_ptrs) << std::endl;
+    maliput::log()->info("Objects written to {}", FLAGS_output_file);
+  }
+  if (!FLAGS_binary_output_file.empty()) {
+    ManualObjectBook<maliput::math::Vector3> object_book(config.tolerance);
+    object_book.AddObjects(std::move(objects));
+    SharedMemoryObjectBook::Write(FLAGS_binary_output_file, object_book, config.tolerance);
+    maliput::log()->info("Objects written to {}", FLAGS_binary_output_file);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace applications
+}  // namespace object
+}  // namespace maliput
+
+int main(int argc, char* argv[]) { return maliput::object::applications::Main(argc, argv); }
@@ -0,0 +1,140 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/// @file maliput_object_replay.cc
+///
+/// Replays a query recording, see maliput::object::QueryRecorder, against an object book and optionally a
+/// maliput::object::SimpleObjectQuery. It reports latency percentiles per method, next to the recorded ones, and the
+/// number of calls whose results differ from the recorded ones.
+///
+/// Usage:
+/// @code{.sh}
+/// maliput_object_replay --recording_file=queries.rec --objects_file=objects.yaml
+/// maliput_object_replay --recording_file=queries.rec --shared_object_book_file=/dev/shm/objects.bin
+///     --maliput_backend=maliput_malidrive --road_network_parameters="{opendrive_file: map.xodr}" --repetitions=10
+///     --trace_file=replay_trace.json
+/// @endcode
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <maliput/api/road_network.h>
+#include <maliput/plugin/create_road_network.h>
+#include <yaml-cpp/yaml.h>
+
+#include "maliput_object/base/query_recording.h"
+#include "maliput_object/base/shared_memory_object_book.h"
+#include "maliput_object/base/simple_object_query.h"
+#include "maliput_object/base/tracing.h"
+#include "maliput_object/loader/loader.h"
+
+DEFINE_string(recording_file, "", "Path to the query recording.");
+DEFINE_string(objects_file, "", "Path to the maliput_objects YAML document to replay against.");
+DEFINE_string(shared_object_book_file, "", "Path to a SharedMemoryObjectBook file to replay against.");
+DEFINE_string(maliput_backend, "",
+              "Id of the RoadNetworkLoader plugin to load the Road Network with. ObjectQuery calls are skipped when "
+              "empty.");
+DEFINE_string(road_network_parameters, "{}",
+              "YAML mapping with the parameters to load the Road Network with, e.g. \"{opendrive_file: map.xodr}\".");
+DEFINE_int32(repetitions, 1, "Number of times every call is replayed.");
+DEFINE_string(trace_file, "",
+              "Path to write a Chrome trace of the replay to. Spans are only emitted when built with "
+              "MALIPUT_OBJECT_TRACING.");
+
+namespace maliput {
+namespace object {
+namespace applications {
+namespace {
+
+int Main(int argc, char* argv[]) {
+  gflags::SetUsageMessage("Replays a query recording and reports latencies and result mismatches.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  if (FLAGS_recording_file.empty() || FLAGS_objects_file.empty() == FLAGS_shared_object_book_file.empty()) {
+    std::cerr << "--recording_file and exactly one of --objects_file and --shared_object_book_file must be provided."
+              << std::endl;
+    return 1;
+  }
+
+  const std::vector<QueryRecord> records = ReadQueryRecording(FLAGS_recording_file);
+  const std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book =
+      FLAGS_objects_file.empty()
+          ? std::unique_ptr<api::ObjectBook<maliput::math::Vector3>>(
+                std::make_unique<SharedMemoryObjectBook>(FLAGS_shared_object_book_file))
+          : loader::LoadFile(FLAGS_objects_file);
+  std::unique_ptr<maliput::api::RoadNetwork> road_network;
+  std::unique_ptr<SimpleObjectQuery> object_query;
+  if (!FLAGS_maliput_backend.empty()) {
+    road_network = maliput::plugin::CreateRoadNetwork(
+        FLAGS_maliput_backend, YAML::Load(FLAGS_road_network_parameters).as<std::map<std::string, std::string>>());
+    object_query = std::make_unique<SimpleObjectQuery>(road_network.get(), object_book.get());
+  }
+
+  if (!FLAGS_trace_file.empty()) {
+    StartTracing(FLAGS_trace_file);
+  }
+  const ReplayReport report = Replay(records, object_book.get(), object_query.get(), FLAGS_repetitions);
+  if (!FLAGS_trace_file.empty()) {
+    StopTracing();
+  }
+  std::cout << "Replayed " << records.size() - report.num_skipped << " of " << records.size() << " calls, "
+            << report.mismatched_records.size() << " with mismatching results." << std::endl;
+  std::cout << std::left << std::setw(24) << "method" << std::right << std::setw(8) << "calls" << std::setw(12)
+            << "mismatches";
+  for (const int percentile : ReplayReport::kPercentiles) {
+    std::cout << std::setw(22) << "p" + std::to_string(percentile) + " rec/replay (us)";
+  }
+  std::cout << std::endl;
+  for (const auto& method_report : report.methods) {
+    std::cout << std::left << std::setw(24) << to_string(method_report.first) << std::right << std::setw(8)
+              << method_report.second.num_calls << std::setw(12) << method_report.second.num_mismatches;
+    for (const int percentile : ReplayReport::kPercentiles) {
+      const auto to_us = [](std::chrono::nanoseconds latency) { return latency.count() / 1000.; };
+      std::stringstream ss;
+      ss << std::fixed << std::setprecision(1) << to_us(method_report.second.recorded_latencies.at(percentile)) << "/"
+         << to_us(method_report.second.replayed_latencies.at(percentile));
+      std::cout << std::setw(22) << ss.str();
+    }
+    std::cout << std::endl;
+  }
+  return report.mismatched_records.empty() ? 0 : 2;
+}
+
+}  // namespace
+}  // namespace applications
+}  // namespace object
+}  // namespace maliput
+
+int main(int argc, char* argv[]) { return maliput::object::applications::Main(argc, argv); }
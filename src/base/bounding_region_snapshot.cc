@@ -0,0 +1,66 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/bounding_region_snapshot.h"
+
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+
+namespace maliput {
+namespace object {
+
+BoundingRegionSnapshot::BoundingRegionSnapshot(const maliput::math::BoundingRegion<maliput::math::Vector3>& region) {
+  const maliput::math::Vector3& position = region.position();
+  parameters_[0] = position.x();
+  parameters_[1] = position.y();
+  parameters_[2] = position.z();
+  const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&region);
+  if (bounding_box != nullptr) {
+    is_box_ = true;
+    const maliput::math::Vector3& box_size = bounding_box->box_size();
+    const maliput::math::RollPitchYaw& rotation = bounding_box->get_orientation();
+    parameters_[3] = box_size.x();
+    parameters_[4] = box_size.y();
+    parameters_[5] = box_size.z();
+    parameters_[6] = rotation.roll_angle();
+    parameters_[7] = rotation.pitch_angle();
+    parameters_[8] = rotation.yaw_angle();
+  }
+}
+
+bool BoundingRegionSnapshot::Matches(const maliput::math::BoundingRegion<maliput::math::Vector3>& region) const {
+  return *this == BoundingRegionSnapshot(region);
+}
+
+bool BoundingRegionSnapshot::operator==(const BoundingRegionSnapshot& other) const {
+  return is_box_ == other.is_box_ && parameters_ == other.parameters_;
+}
+
+}  // namespace object
+}  // namespace maliput
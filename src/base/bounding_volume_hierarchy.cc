@@ -0,0 +1,562 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/matrix.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace object {
+namespace {
+
+constexpr std::size_t kDimensions{3};
+
+// Upper bound of the traversal stack: a tree of at most 2^31 entries is no deeper than 11 levels and every level
+// leaves at most kNodeCapacity - 1 pending siblings in the stack.
+constexpr std::size_t kMaxStackSize{128};
+
+// Sorts [first, last) following Sort-Tile-Recursive so that every run of @p capacity consecutive elements is spatially
+// compact. Elements are sorted by their center along @p axis, split into slabs and each slab is sorted along the next
+// axis. @p box_of maps an element to its AxisAlignedBox.
+template <typename It, typename BoxOf>
+void SortTileRecursive(It first, It last, std::size_t axis, int capacity, const BoxOf& box_of) {
+  const std::size_t count = std::distance(first, last);
+  if (axis == kDimensions || count <= static_cast<std::size_t>(capacity)) {
+    return;
+  }
+  std::sort(first, last, [&box_of, axis](const auto& lhs, const auto& rhs) {
+    return box_of(lhs).center()[axis] < box_of(rhs).center()[axis];
+  });
+  const double num_groups = std::ceil(static_cast<double>(count) / static_cast<double>(capacity));
+  const double num_slabs = std::ceil(std::pow(num_groups, 1. / static_cast<double>(kDimensions - axis)));
+  const std::size_t slab_size =
+      static_cast<std::size_t>(capacity) * static_cast<std::size_t>(std::ceil(num_groups / num_slabs));
+  for (std::size_t begin = 0; begin < count; begin += slab_size) {
+    SortTileRecursive(first + begin, first + std::min(begin + slab_size, count), axis + 1, capacity, box_of);
+  }
+}
+
+// Orders by distance and then by id.
+template <typename Coordinate>
+bool IsCloser(const std::pair<double, api::Object<Coordinate>*>& lhs,
+              const std::pair<double, api::Object<Coordinate>*>& rhs) {
+  if (lhs.first != rhs.first) {
+    return lhs.first < rhs.first;
+  }
+  return lhs.second->id().string() < rhs.second->id().string();
+}
+
+}  // namespace
+
+template <typename Coordinate>
+bool AxisAlignedBox<Coordinate>::Overlaps(const AxisAlignedBox<Coordinate>& other) const {
+  for (std::size_t i = 0; i < kDimensions; ++i) {
+    if (max_corner[i] < other.min_corner[i] || other.max_corner[i] < min_corner[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Coordinate>
+AxisAlignedBox<Coordinate> AxisAlignedBox<Coordinate>::Merge(const AxisAlignedBox<Coordinate>& other) const {
+  AxisAlignedBox<Coordinate> merged{*this};
+  for (std::size_t i = 0; i < kDimensions; ++i) {
+    merged.min_corner[i] = std::min(min_corner[i], other.min_corner[i]);
+    merged.max_corner[i] = std::max(max_corner[i], other.max_corner[i]);
+  }
+  return merged;
+}
+
+template <typename Coordinate>
+AxisAlignedBox<Coordinate> AxisAlignedBox<Coordinate>::Inflate(double distance) const {
+  AxisAlignedBox<Coordinate> inflated{*this};
+  for (std::size_t i = 0; i < kDimensions; ++i) {
+    inflated.min_corner[i] -= distance;
+    inflated.max_corner[i] += distance;
+  }
+  return inflated;
+}
+
+template <typename Coordinate>
+Coordinate AxisAlignedBox<Coordinate>::center() const {
+  return (min_corner + max_corner) / 2.;
+}
+
+template <typename Coordinate>
+double AxisAlignedBox<Coordinate>::SquaredDistanceTo(const Coordinate& point) const {
+  double squared_distance{0.};
+  for (std::size_t i = 0; i < kDimensions; ++i) {
+    const double excess = std::max({min_corner[i] - point[i], point[i] - max_corner[i], 0.});
+    squared_distance += excess * excess;
+  }
+  return squared_distance;
+}
+
+template <typename Coordinate>
+std::optional<double> AxisAlignedBox<Coordinate>::IntersectRay(const Coordinate& origin,
+                                                               const Coordinate& inverse_direction,
+                                                               double max_range) const {
+  double t_min{0.};
+  double t_max{max_range};
+  for (std::size_t i = 0; i < kDimensions; ++i) {
+    if (std::isinf(inverse_direction[i])) {
+      // The ray is parallel to the slab.
+      if (origin[i] < min_corner[i] || max_corner[i] < origin[i]) {
+        return std::nullopt;
+      }
+      continue;
+    }
+    const double t_a = (min_corner[i] - origin[i]) * inverse_direction[i];
+    const double t_b = (max_corner[i] - origin[i]) * inverse_direction[i];
+    t_min = std::max(t_min, std::min(t_a, t_b));
+    t_max = std::min(t_max, std::max(t_a, t_b));
+    if (t_min > t_max) {
+      return std::nullopt;
+    }
+  }
+  return t_min;
+}
+
+template <typename Coordinate>
+bool AxisAlignedBox<Coordinate>::IsOutside(const api::Frustum<Coordinate>& frustum) const {
+  const Coordinate box_center = center();
+  for (const auto& plane : frustum.planes) {
+    double radius{0.};
+    for (std::size_t i = 0; i < kDimensions; ++i) {
+      radius += (max_corner[i] - box_center[i]) * std::abs(plane.normal[i]);
+    }
+    if (plane.normal.dot(box_center) + plane.offset < -radius) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename Coordinate>
+std::optional<AxisAlignedBox<Coordinate>> ComputeAxisAlignedBox(const maliput::math::BoundingRegion<Coordinate>& region,
+                                                                double tolerance) {
+  const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&region);
+  if (bounding_box == nullptr) {
+    return std::nullopt;
+  }
+  // The half extent of the box along each axis is the projection of its half size on the axis, which is computed from
+  // the rotation rather than from the vertices to avoid allocating them.
+  const maliput::math::Matrix3 rotation = bounding_box->get_orientation().ToMatrix();
+  const Coordinate half_size = bounding_box->box_size() / 2.;
+  AxisAlignedBox<Coordinate> box{region.position(), region.position()};
+  for (std::size_t i = 0; i < kDimensions; ++i) {
+    double half_extent{tolerance};
+    for (std::size_t j = 0; j < kDimensions; ++j) {
+      half_extent += std::abs(rotation[i][j]) * half_size[j];
+    }
+    box.min_corner[i] -= half_extent;
+    box.max_corner[i] += half_extent;
+  }
+  return box;
+}
+
+template <typename Coordinate>
+Coordinate ComputeInverseDirection(const Coordinate& direction) {
+  Coordinate inverse_direction{direction};
+  for (std::size_t i = 0; i < kDimensions; ++i) {
+    inverse_direction[i] = direction[i] == 0. ? std::numeric_limits<double>::infinity() : 1. / direction[i];
+  }
+  return inverse_direction;
+}
+
+template <typename Coordinate>
+NearestObjects<Coordinate>::NearestObjects(int k) : k_(static_cast<std::size_t>(std::max(k, 0))) {
+  MALIPUT_THROW_UNLESS(k >= 0);
+}
+
+template <typename Coordinate>
+void NearestObjects<Coordinate>::Offer(api::Object<Coordinate>* object, double distance) {
+  if (k_ == 0) {
+    return;
+  }
+  const std::pair<double, api::Object<Coordinate>*> candidate{distance, object};
+  if (heap_.size() < k_) {
+    heap_.push_back(candidate);
+    std::push_heap(heap_.begin(), heap_.end(), IsCloser<Coordinate>);
+  } else if (IsCloser(candidate, heap_.front())) {
+    std::pop_heap(heap_.begin(), heap_.end(), IsCloser<Coordinate>);
+    heap_.back() = candidate;
+    std::push_heap(heap_.begin(), heap_.end(), IsCloser<Coordinate>);
+  }
+}
+
+template <typename Coordinate>
+double NearestObjects<Coordinate>::max_distance() const {
+  return heap_.size() < k_ || k_ == 0 ? std::numeric_limits<double>::infinity() : heap_.front().first;
+}
+
+template <typename Coordinate>
+std::vector<std::pair<double, api::Object<Coordinate>*>> NearestObjects<Coordinate>::SortedWithDistances() const {
+  std::vector<std::pair<double, api::Object<Coordinate>*>> sorted{heap_};
+  std::sort_heap(sorted.begin(), sorted.end(), IsCloser<Coordinate>);
+  return sorted;
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> NearestObjects<Coordinate>::Sorted() const {
+  const std::vector<std::pair<double, api::Object<Coordinate>*>> sorted = SortedWithDistances();
+  std::vector<api::Object<Coordinate>*> objects;
+  objects.reserve(sorted.size());
+  for (const auto& distance_object : sorted) {
+    objects.push_back(distance_object.second);
+  }
+  return objects;
+}
+
+template <typename Coordinate>
+BoundingVolumeHierarchy<Coordinate>::BoundingVolumeHierarchy(const std::vector<api::Object<Coordinate>*>& objects,
+                                                             double tolerance)
+    : tolerance_(tolerance) {
+  MALIPUT_THROW_UNLESS(tolerance_ >= 0.);
+  entries_.reserve(objects.size());
+  for (api::Object<Coordinate>* object : objects) {
+    MALIPUT_THROW_UNLESS(object != nullptr);
+    const std::optional<AxisAlignedBox<Coordinate>> box = ComputeAxisAlignedBox(object->bounding_region(), tolerance_);
+    if (box.has_value()) {
+      entries_.push_back({box.value(), object});
+    } else {
+      unbounded_.push_back(object);
+    }
+  }
+
+  // Leaves.
+  SortTileRecursive(entries_.begin(), entries_.end(), 0, kNodeCapacity,
+                    [](const Entry& entry) -> const AxisAlignedBox<Coordinate>& { return entry.box; });
+  std::vector<Node> level;
+  for (std::size_t first = 0; first < entries_.size(); first += kNodeCapacity) {
+    Node leaf{entries_[first].box, static_cast<int>(first),
+              static_cast<int>(std::min(entries_.size() - first, static_cast<std::size_t>(kNodeCapacity))), true};
+    for (int i = 1; i < leaf.count; ++i) {
+      leaf.box = leaf.box.Merge(entries_[first + i].box);
+    }
+    level.push_back(leaf);
+  }
+  for (std::size_t i = 0; i < entries_.size(); ++i) {
+    entry_indices_.emplace(entries_[i].object->id(), static_cast<int>(i));
+  }
+
+  // Inner nodes, packed level by level until a single root remains.
+  while (level.size() > 1) {
+    SortTileRecursive(level.begin(), level.end(), 0, kNodeCapacity,
+                      [](const Node& node) -> const AxisAlignedBox<Coordinate>& { return node.box; });
+    const int offset = static_cast<int>(nodes_.size());
+    nodes_.insert(nodes_.end(), level.begin(), level.end());
+    std::vector<Node> parents;
+    for (std::size_t first = 0; first < level.size(); first += kNodeCapacity) {
+      Node parent{level[first].box, offset + static_cast<int>(first),
+                  static_cast<int>(std::min(level.size() - first, static_cast<std::size_t>(kNodeCapacity))), false};
+      for (int i = 1; i < parent.count; ++i) {
+        parent.box = parent.box.Merge(level[first + i].box);
+      }
+      parents.push_back(parent);
+    }
+    level = std::move(parents);
+  }
+  if (!level.empty()) {
+    nodes_.push_back(level.front());
+  }
+}
+
+template <typename Coordinate>
+void BoundingVolumeHierarchy<Coordinate>::VisitCandidates(
+    const AxisAlignedBox<Coordinate>& box, const std::function<void(api::Object<Coordinate>*)>& visitor) const {
+  std::for_each(unbounded_.begin(), unbounded_.end(), visitor);
+  if (nodes_.empty() || !nodes_.back().box.Overlaps(box)) {
+    return;
+  }
+  std::array<int, kMaxStackSize> stack;
+  std::size_t stack_size{0};
+  stack[stack_size++] = static_cast<int>(nodes_.size()) - 1;
+  while (stack_size > 0) {
+    const Node& node = nodes_[stack[--stack_size]];
+    for (int i = node.first; i < node.first + node.count; ++i) {
+      if (node.is_leaf) {
+        const Entry& entry = entries_[i];
+        if (entry.object != nullptr && entry.box.Overlaps(box)) {
+          visitor(entry.object);
+        }
+      } else if (nodes_[i].box.Overlaps(box)) {
+        MALIPUT_THROW_UNLESS(stack_size < kMaxStackSize);
+        stack[stack_size++] = i;
+      }
+    }
+  }
+}
+
+template <typename Coordinate>
+void BoundingVolumeHierarchy<Coordinate>::VisitNearest(
+    const Coordinate& position, const std::function<bool(api::Object<Coordinate>*, double)>& visitor) const {
+  for (api::Object<Coordinate>* object : unbounded_) {
+    if (!visitor(object, 0.)) {
+      return;
+    }
+  }
+  if (nodes_.empty()) {
+    return;
+  }
+  // A pending node, or an entry when `is_entry` is true, keyed by the squared distance to its box.
+  struct Pending {
+    double squared_distance;
+    int index;
+    bool is_entry;
+  };
+  const auto is_farther = [](const Pending& lhs, const Pending& rhs) {
+    return lhs.squared_distance > rhs.squared_distance;
+  };
+  std::priority_queue<Pending, std::vector<Pending>, decltype(is_farther)> queue(is_farther);
+  const int root = static_cast<int>(nodes_.size()) - 1;
+  queue.push({nodes_[root].box.SquaredDistanceTo(position), root, false});
+  while (!queue.empty()) {
+    const Pending pending = queue.top();
+    queue.pop();
+    if (pending.is_entry) {
+      if (!visitor(entries_[pending.index].object, std::sqrt(pending.squared_distance))) {
+        return;
+      }
+      continue;
+    }
+    const Node& node = nodes_[pending.index];
+    for (int i = node.first; i < node.first + node.count; ++i) {
+      if (!node.is_leaf) {
+        queue.push({nodes_[i].box.SquaredDistanceTo(position), i, false});
+      } else if (entries_[i].object != nullptr) {
+        queue.push({entries_[i].box.SquaredDistanceTo(position), i, true});
+      }
+    }
+  }
+}
+
+template <typename Coordinate>
+void BoundingVolumeHierarchy<Coordinate>::VisitRayCandidates(
+    const api::Ray<Coordinate>& ray, const std::function<bool(api::Object<Coordinate>*, double)>& visitor) const {
+  for (api::Object<Coordinate>* object : unbounded_) {
+    if (!visitor(object, 0.)) {
+      return;
+    }
+  }
+  if (nodes_.empty()) {
+    return;
+  }
+  const Coordinate inverse_direction = ComputeInverseDirection(ray.direction);
+  // A pending node, or an entry when `is_entry` is true, keyed by the distance the ray enters its box at.
+  struct Pending {
+    double distance;
+    int index;
+    bool is_entry;
+  };
+  const auto is_farther = [](const Pending& lhs, const Pending& rhs) { return lhs.distance > rhs.distance; };
+  std::priority_queue<Pending, std::vector<Pending>, decltype(is_farther)> queue(is_farther);
+  const int root = static_cast<int>(nodes_.size()) - 1;
+  const std::optional<double> root_distance =
+      nodes_[root].box.IntersectRay(ray.origin, inverse_direction, ray.max_range);
+  if (root_distance.has_value()) {
+    queue.push({root_distance.value(), root, false});
+  }
+  while (!queue.empty()) {
+    const Pending pending = queue.top();
+    queue.pop();
+    if (pending.is_entry) {
+      if (!visitor(entries_[pending.index].object, pending.distance)) {
+        return;
+      }
+      continue;
+    }
+    const Node& node = nodes_[pending.index];
+    for (int i = node.first; i < node.first + node.count; ++i) {
+      if (node.is_leaf && entries_[i].object == nullptr) {
+        continue;
+      }
+      const AxisAlignedBox<Coordinate>& box = node.is_leaf ? entries_[i].box : nodes_[i].box;
+      const std::optional<double> distance = box.IntersectRay(ray.origin, inverse_direction, ray.max_range);
+      if (distance.has_value()) {
+        queue.push({distance.value(), i, node.is_leaf});
+      }
+    }
+  }
+}
+
+template <typename Coordinate>
+void BoundingVolumeHierarchy<Coordinate>::VisitRayPacketCandidates(
+    const std::vector<api::Ray<Coordinate>>& rays, std::vector<double>* ranges,
+    const std::function<void(std::size_t, api::Object<Coordinate>*)>& visitor) const {
+  MALIPUT_THROW_UNLESS(ranges != nullptr);
+  MALIPUT_THROW_UNLESS(ranges->size() == rays.size());
+  for (api::Object<Coordinate>* object : unbounded_) {
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+      visitor(i, object);
+    }
+  }
+  if (nodes_.empty()) {
+    return;
+  }
+  std::vector<Coordinate> inverse_directions;
+  inverse_directions.reserve(rays.size());
+  for (const api::Ray<Coordinate>& ray : rays) {
+    inverse_directions.push_back(ComputeInverseDirection(ray.direction));
+  }
+  static_assert(kRayPacketSize <= 64, "Packets are tracked with 64 bit masks.");
+  // A node to visit and the mask of the rays of the packet that hit it.
+  struct Pending {
+    int index;
+    std::uint64_t mask;
+  };
+  std::array<Pending, kMaxStackSize> stack;
+  for (std::size_t first = 0; first < rays.size(); first += kRayPacketSize) {
+    const std::size_t packet_size = std::min(kRayPacketSize, rays.size() - first);
+    // @returns The mask of the rays of @p mask that hit @p box within their range.
+    const auto hit_mask = [&rays, ranges, &inverse_directions, first, packet_size](
+                              const AxisAlignedBox<Coordinate>& box, std::uint64_t mask) {
+      std::uint64_t hits{0};
+      for (std::size_t i = 0; i < packet_size; ++i) {
+        const std::size_t ray = first + i;
+        if ((mask >> i & 1u) &&
+            box.IntersectRay(rays[ray].origin, inverse_directions[ray], (*ranges)[ray]).has_value()) {
+          hits |= std::uint64_t{1} << i;
+        }
+      }
+      return hits;
+    };
+    const std::uint64_t packet_mask =
+        packet_size == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << packet_size) - 1;
+    std::size_t stack_size{0};
+    const int root = static_cast<int>(nodes_.size()) - 1;
+    const std::uint64_t root_mask = hit_mask(nodes_[root].box, packet_mask);
+    if (root_mask != 0) {
+      stack[stack_size++] = {root, root_mask};
+    }
+    while (stack_size > 0) {
+      const Pending pending = stack[--stack_size];
+      const Node& node = nodes_[pending.index];
+      for (int i = node.first; i < node.first + node.count; ++i) {
+        if (node.is_leaf) {
+          if (entries_[i].object == nullptr) {
+            continue;
+          }
+          const std::uint64_t mask = hit_mask(entries_[i].box, pending.mask);
+          for (std::size_t ray = 0; ray < packet_size; ++ray) {
+            if (mask >> ray & 1u) {
+              visitor(first + ray, entries_[i].object);
+            }
+          }
+        } else {
+          const std::uint64_t mask = hit_mask(nodes_[i].box, pending.mask);
+          if (mask != 0) {
+            MALIPUT_THROW_UNLESS(stack_size < kMaxStackSize);
+            stack[stack_size++] = {i, mask};
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename Coordinate>
+void BoundingVolumeHierarchy<Coordinate>::VisitFrustumCandidates(
+    const api::Frustum<Coordinate>& frustum, const std::function<void(api::Object<Coordinate>*)>& visitor) const {
+  std::for_each(unbounded_.begin(), unbounded_.end(), visitor);
+  if (nodes_.empty() || nodes_.back().box.IsOutside(frustum)) {
+    return;
+  }
+  std::array<int, kMaxStackSize> stack;
+  std::size_t stack_size{0};
+  stack[stack_size++] = static_cast<int>(nodes_.size()) - 1;
+  while (stack_size > 0) {
+    const Node& node = nodes_[stack[--stack_size]];
+    for (int i = node.first; i < node.first + node.count; ++i) {
+      if (node.is_leaf) {
+        const Entry& entry = entries_[i];
+        if (entry.object != nullptr && !entry.box.IsOutside(frustum)) {
+          visitor(entry.object);
+        }
+      } else if (!nodes_[i].box.IsOutside(frustum)) {
+        MALIPUT_THROW_UNLESS(stack_size < kMaxStackSize);
+        stack[stack_size++] = i;
+      }
+    }
+  }
+}
+
+template <typename Coordinate>
+bool BoundingVolumeHierarchy<Coordinate>::Remove(const typename api::Object<Coordinate>::Id& object_id) {
+  const auto it = entry_indices_.find(object_id);
+  if (it != entry_indices_.end()) {
+    entries_[it->second].object = nullptr;
+    entry_indices_.erase(it);
+    return true;
+  }
+  const auto unbounded_it = std::find_if(unbounded_.begin(), unbounded_.end(),
+                                         [&object_id](const auto* object) { return object->id() == object_id; });
+  if (unbounded_it != unbounded_.end()) {
+    unbounded_.erase(unbounded_it);
+    return true;
+  }
+  return false;
+}
+
+template <typename Coordinate>
+MemoryUsageReport BoundingVolumeHierarchy<Coordinate>::MemoryUsage() const {
+  MemoryUsageReport report;
+  report.index = sizeof(*this) + entries_.capacity() * sizeof(Entry) + nodes_.capacity() * sizeof(Node) +
+                 unbounded_.capacity() * sizeof(api::Object<Coordinate>*) +
+                 EstimateHashTableSize(entry_indices_.bucket_count(), entry_indices_.size(),
+                                       sizeof(typename decltype(entry_indices_)::value_type));
+  for (const auto& id_index : entry_indices_) {
+    report.index += EstimateHeapSize(id_index.first.string());
+  }
+  return report;
+}
+
+template struct AxisAlignedBox<maliput::math::Vector3>;
+template std::optional<AxisAlignedBox<maliput::math::Vector3>> ComputeAxisAlignedBox(
+    const maliput::math::BoundingRegion<maliput::math::Vector3>&, double);
+template maliput::math::Vector3 ComputeInverseDirection(const maliput::math::Vector3&);
+template class NearestObjects<maliput::math::Vector3>;
+template class BoundingVolumeHierarchy<maliput::math::Vector3>;
+
+}  // namespace object
+}  // namespace maliput
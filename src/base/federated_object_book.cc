@@ -0,0 +1,260 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/federated_object_book.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+#include "maliput_object/base/spatial_join.h"
+
+namespace maliput {
+namespace object {
+namespace {
+
+// Sorts @p objects by increasing distance to @p position, as api::ObjectBook::FindWithinDistance() does.
+template <typename Coordinate>
+void SortByDistance(const Coordinate& position, std::vector<api::Object<Coordinate>*>* objects) {
+  std::vector<std::pair<double, api::Object<Coordinate>*>> distance_objects;
+  distance_objects.reserve(objects->size());
+  for (api::Object<Coordinate>* object : *objects) {
+    distance_objects.emplace_back(api::ComputeDistance(object->bounding_region(), position), object);
+  }
+  std::sort(distance_objects.begin(), distance_objects.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.first != rhs.first ? lhs.first < rhs.first : lhs.second->id().string() < rhs.second->id().string();
+  });
+  for (std::size_t i = 0; i < distance_objects.size(); ++i) {
+    (*objects)[i] = distance_objects[i].second;
+  }
+}
+
+// @returns Whether @p lhs is closer than @p rhs, ties broken by id.
+template <typename Coordinate>
+bool IsCloserHit(const api::RayHit<Coordinate>& lhs, const api::RayHit<Coordinate>& rhs) {
+  return lhs.distance != rhs.distance ? lhs.distance < rhs.distance
+                                      : lhs.object->id().string() < rhs.object->id().string();
+}
+
+}  // namespace
+
+template <typename Coordinate>
+FederatedObjectBook<Coordinate>::FederatedObjectBook(std::vector<Layer> layers) : layers_(std::move(layers)) {
+  std::unordered_set<std::string> names;
+  for (const Layer& layer : layers_) {
+    MALIPUT_THROW_UNLESS(layer.book != nullptr);
+    MALIPUT_VALIDATE(names.insert(layer.name).second, "Duplicated layer name: " + layer.name);
+  }
+}
+
+template <typename Coordinate>
+const typename FederatedObjectBook<Coordinate>::Layer* FederatedObjectBook<Coordinate>::FindLayer(
+    const std::string& name) const {
+  const auto it =
+      std::find_if(layers_.begin(), layers_.end(), [&name](const Layer& layer) { return layer.name == name; });
+  return it == layers_.end() ? nullptr : &*it;
+}
+
+template <typename Coordinate>
+std::unique_ptr<FederatedObjectBook<Coordinate>> FederatedObjectBook<Coordinate>::SelectLayers(
+    const std::map<std::string, std::string>& properties) const {
+  std::vector<Layer> selected_layers;
+  for (const Layer& layer : layers_) {
+    const bool selected = std::all_of(properties.begin(), properties.end(), [&layer](const auto& key_value) {
+      const auto it = layer.properties.find(key_value.first);
+      return it == layer.properties.end() || it->second == key_value.second;
+    });
+    if (selected) {
+      selected_layers.push_back(layer);
+    }
+  }
+  return std::make_unique<FederatedObjectBook<Coordinate>>(std::move(selected_layers));
+}
+
+template <typename Coordinate>
+std::unordered_map<typename api::Object<Coordinate>::Id, api::Object<Coordinate>*>
+FederatedObjectBook<Coordinate>::do_objects() const {
+  std::unordered_map<typename api::Object<Coordinate>::Id, api::Object<Coordinate>*> objects;
+  for (const Layer& layer : layers_) {
+    // The Objects of earlier layers are kept, as in FindById().
+    const std::unordered_map<typename api::Object<Coordinate>::Id, api::Object<Coordinate>*> layer_objects =
+        layer.book->objects();
+    objects.insert(layer_objects.begin(), layer_objects.end());
+  }
+  return objects;
+}
+
+template <typename Coordinate>
+api::Object<Coordinate>* FederatedObjectBook<Coordinate>::DoFindById(
+    const typename api::Object<Coordinate>::Id& object_id) const {
+  for (const Layer& layer : layers_) {
+    api::Object<Coordinate>* object = layer.book->FindById(object_id);
+    if (object != nullptr) {
+      return object;
+    }
+  }
+  return nullptr;
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> FederatedObjectBook<Coordinate>::DoFindByPredicate(
+    std::function<bool(const api::Object<Coordinate>*)> predicate) const {
+  std::vector<api::Object<Coordinate>*> objects;
+  for (const Layer& layer : layers_) {
+    layer.book->FindByPredicate(predicate, &objects);
+  }
+  return objects;
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> FederatedObjectBook<Coordinate>::DoFindOverlappingIn(
+    const maliput::math::BoundingRegion<Coordinate>& region,
+    const maliput::math::OverlappingType& overlapping_type) const {
+  std::vector<api::Object<Coordinate>*> objects;
+  for (const Layer& layer : layers_) {
+    layer.book->FindOverlappingIn(region, overlapping_type, &objects);
+  }
+  return objects;
+}
+
+template <typename Coordinate>
+void FederatedObjectBook<Coordinate>::DoVisitByPredicate(
+    const std::function<bool(const api::Object<Coordinate>*)>& predicate,
+    const std::function<void(api::Object<Coordinate>*)>& visitor) const {
+  for (const Layer& layer : layers_) {
+    layer.book->VisitByPredicate(predicate, visitor);
+  }
+}
+
+template <typename Coordinate>
+void FederatedObjectBook<Coordinate>::DoVisitOverlappingIn(
+    const maliput::math::BoundingRegion<Coordinate>& region, const maliput::math::OverlappingType& overlapping_type,
+    const std::function<void(api::Object<Coordinate>*)>& visitor) const {
+  for (const Layer& layer : layers_) {
+    layer.book->VisitOverlappingIn(region, overlapping_type, visitor);
+  }
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> FederatedObjectBook<Coordinate>::DoFindNearest(
+    const Coordinate& position, int k, const std::function<bool(const api::Object<Coordinate>*)>& predicate) const {
+  // The k nearest Objects are among the k nearest Objects of every layer.
+  NearestObjects<Coordinate> nearest(k);
+  for (const Layer& layer : layers_) {
+    for (api::Object<Coordinate>* object : layer.book->FindNearest(position, k, predicate)) {
+      nearest.Offer(object, api::ComputeDistance(object->bounding_region(), position));
+    }
+  }
+  return nearest.Sorted();
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> FederatedObjectBook<Coordinate>::DoFindWithinDistance(const Coordinate& position,
+                                                                                           double radius) const {
+  std::vector<api::Object<Coordinate>*> objects;
+  for (const Layer& layer : layers_) {
+    const std::vector<api::Object<Coordinate>*> layer_objects = layer.book->FindWithinDistance(position, radius);
+    objects.insert(objects.end(), layer_objects.begin(), layer_objects.end());
+  }
+  if (layers_.size() > 1) {
+    SortByDistance(position, &objects);
+  }
+  return objects;
+}
+
+template <typename Coordinate>
+std::vector<api::RayHit<Coordinate>> FederatedObjectBook<Coordinate>::DoRayCastAll(
+    const api::Ray<Coordinate>& ray) const {
+  std::vector<api::RayHit<Coordinate>> hits;
+  for (const Layer& layer : layers_) {
+    const std::vector<api::RayHit<Coordinate>> layer_hits =
+        layer.book->RayCastAll(ray.origin, ray.direction, ray.max_range);
+    hits.insert(hits.end(), layer_hits.begin(), layer_hits.end());
+  }
+  std::sort(hits.begin(), hits.end(), IsCloserHit<Coordinate>);
+  return hits;
+}
+
+template <typename Coordinate>
+void FederatedObjectBook<Coordinate>::DoRayCast(const std::vector<api::Ray<Coordinate>>& rays,
+                                                std::vector<std::optional<api::RayHit<Coordinate>>>* hits) const {
+  for (const Layer& layer : layers_) {
+    const std::vector<std::optional<api::RayHit<Coordinate>>> layer_hits = layer.book->RayCast(rays);
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+      if (layer_hits[i].has_value() && (!(*hits)[i].has_value() || IsCloserHit(*layer_hits[i], *(*hits)[i]))) {
+        (*hits)[i] = layer_hits[i];
+      }
+    }
+  }
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> FederatedObjectBook<Coordinate>::DoFindInFrustum(
+    const api::Frustum<Coordinate>& frustum) const {
+  std::vector<api::Object<Coordinate>*> objects;
+  for (const Layer& layer : layers_) {
+    const std::vector<api::Object<Coordinate>*> layer_objects = layer.book->FindInFrustum(frustum);
+    objects.insert(objects.end(), layer_objects.begin(), layer_objects.end());
+  }
+  return objects;
+}
+
+template <typename Coordinate>
+std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>>
+FederatedObjectBook<Coordinate>::DoFindAllOverlappingPairs() const {
+  std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> pairs;
+  for (std::size_t i = 0; i < layers_.size(); ++i) {
+    const std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> layer_pairs =
+        layers_[i].book->FindAllOverlappingPairs();
+    pairs.insert(pairs.end(), layer_pairs.begin(), layer_pairs.end());
+    for (std::size_t j = i + 1; j < layers_.size(); ++j) {
+      for (const auto& pair :
+           SpatialJoin(*layers_[i].book, *layers_[j].book, maliput::math::OverlappingType::kIntersected)) {
+        pairs.push_back(pair.second->id().string() < pair.first->id().string()
+                            ? std::make_pair(pair.second, pair.first)
+                            : pair);
+      }
+    }
+  }
+  std::sort(pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) {
+    if (lhs.first->id() != rhs.first->id()) {
+      return lhs.first->id().string() < rhs.first->id().string();
+    }
+    return lhs.second->id().string() < rhs.second->id().string();
+  });
+  return pairs;
+}
+
+template class FederatedObjectBook<maliput::math::Vector3>;
+
+}  // namespace object
+}  // namespace maliput
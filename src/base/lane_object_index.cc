@@ -0,0 +1,204 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/lane_object_index.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_set>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace object {
+namespace {
+
+using maliput::math::Vector3;
+
+// Computes the maximum s_max of the subtree of @p intervals rooted at the middle of [@p first, @p last), stores it in
+// @p max_s_max for every node of the subtree and returns it.
+double ComputeMaxSMax(const std::vector<LaneObjectInterval>& intervals, std::size_t first, std::size_t last,
+                      std::vector<double>* max_s_max) {
+  if (first >= last) {
+    return -std::numeric_limits<double>::infinity();
+  }
+  const std::size_t middle = first + (last - first) / 2;
+  (*max_s_max)[middle] = std::max({intervals[middle].s_max, ComputeMaxSMax(intervals, first, middle, max_s_max),
+                                   ComputeMaxSMax(intervals, middle + 1, last, max_s_max)});
+  return (*max_s_max)[middle];
+}
+
+// Visits, in order, the intervals of the subtree rooted at the middle of [@p first, @p last) that overlap with
+// [@p s_min, @p s_max].
+void VisitOverlapping(const std::vector<LaneObjectInterval>& intervals, const std::vector<double>& max_s_max,
+                      std::size_t first, std::size_t last, double s_min, double s_max,
+                      const std::function<void(const LaneObjectInterval&)>& visitor) {
+  while (first < last) {
+    const std::size_t middle = first + (last - first) / 2;
+    if (max_s_max[middle] < s_min) {
+      return;
+    }
+    VisitOverlapping(intervals, max_s_max, first, middle, s_min, s_max, visitor);
+    // Intervals of the right subtree start after the middle one.
+    if (intervals[middle].s_min > s_max) {
+      return;
+    }
+    if (intervals[middle].s_max >= s_min) {
+      visitor(intervals[middle]);
+    }
+    first = middle + 1;
+  }
+}
+
+}  // namespace
+
+LaneObjectIndex::LaneObjectIndex(const api::ObjectBook<Vector3>* object_book,
+                                 const ObjectLaneAssociations& lane_associations) {
+  MALIPUT_THROW_UNLESS(object_book != nullptr);
+  for (const auto& id_footprints : lane_associations.footprints) {
+    const api::Object<Vector3>* object = object_book->FindById(id_footprints.first);
+    if (object == nullptr || !AreFootprintsCurrent(lane_associations, object)) {
+      continue;
+    }
+    std::vector<maliput::api::LaneId>& lane_ids = object_lanes_[object->id()];
+    for (const LaneFootprint& footprint : id_footprints.second) {
+      lanes_[footprint.lane_id].intervals.push_back(
+          {object, footprint.s_min, footprint.s_max, footprint.r_min, footprint.r_max});
+      lane_ids.push_back(footprint.lane_id);
+    }
+  }
+  for (auto& lane_id_intervals : lanes_) {
+    Rebuild(&lane_id_intervals.second);
+  }
+}
+
+LaneObjectIndex::LaneObjectIndex(const api::ObjectQuery& object_query)
+    : LaneObjectIndex(object_query.object_book(), ComputeObjectLaneAssociations(object_query)) {}
+
+void LaneObjectIndex::Update(const api::Object<Vector3>* object, const std::vector<LaneFootprint>& footprints) {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  Remove(object->id());
+  std::vector<maliput::api::LaneId>& lane_ids = object_lanes_[object->id()];
+  for (const LaneFootprint& footprint : footprints) {
+    lanes_[footprint.lane_id].intervals.push_back(
+        {object, footprint.s_min, footprint.s_max, footprint.r_min, footprint.r_max});
+    lane_ids.push_back(footprint.lane_id);
+  }
+  for (const maliput::api::LaneId& lane_id : lane_ids) {
+    Rebuild(&lanes_.at(lane_id));
+  }
+}
+
+void LaneObjectIndex::Update(const api::ObjectQuery& object_query, const api::Object<Vector3>* object) {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  std::vector<LaneFootprint> footprints;
+  for (const maliput::api::Lane* lane : object_query.FindOverlappingLanesIn(object)) {
+    footprints.push_back(ComputeLaneFootprint(lane, object));
+  }
+  Update(object, footprints);
+}
+
+bool LaneObjectIndex::Remove(const api::Object<Vector3>::Id& id) {
+  const auto it = object_lanes_.find(id);
+  if (it == object_lanes_.end()) {
+    return false;
+  }
+  for (const maliput::api::LaneId& lane_id : std::unordered_set<maliput::api::LaneId>(it->second.begin(),
+                                                                                       it->second.end())) {
+    LaneIntervals& lane_intervals = lanes_.at(lane_id);
+    lane_intervals.intervals.erase(std::remove_if(lane_intervals.intervals.begin(), lane_intervals.intervals.end(),
+                                                  [&id](const LaneObjectInterval& interval) {
+                                                    return interval.object->id() == id;
+                                                  }),
+                                   lane_intervals.intervals.end());
+    if (lane_intervals.intervals.empty()) {
+      lanes_.erase(lane_id);
+    } else {
+      Rebuild(&lane_intervals);
+    }
+  }
+  object_lanes_.erase(it);
+  return true;
+}
+
+std::vector<const api::Object<Vector3>*> LaneObjectIndex::FindObjectsOnLane(
+    const maliput::api::LaneId& lane_id, const maliput::api::SRange& s_range) const {
+  std::vector<const api::Object<Vector3>*> objects;
+  VisitIntervalsOnLane(lane_id, s_range,
+                       [&objects](const LaneObjectInterval& interval) { objects.push_back(interval.object); });
+  return objects;
+}
+
+void LaneObjectIndex::VisitIntervalsOnLane(const maliput::api::LaneId& lane_id, const maliput::api::SRange& s_range,
+                                           const std::function<void(const LaneObjectInterval&)>& visitor) const {
+  const auto it = lanes_.find(lane_id);
+  if (it == lanes_.end()) {
+    return;
+  }
+  VisitOverlapping(it->second.intervals, it->second.max_s_max, 0, it->second.intervals.size(),
+                   std::min(s_range.s0(), s_range.s1()), std::max(s_range.s0(), s_range.s1()), visitor);
+}
+
+const std::vector<LaneObjectInterval>* LaneObjectIndex::GetIntervalsOnLane(const maliput::api::LaneId& lane_id) const {
+  const auto it = lanes_.find(lane_id);
+  return it == lanes_.end() ? nullptr : &it->second.intervals;
+}
+
+MemoryUsageReport LaneObjectIndex::MemoryUsage() const {
+  MemoryUsageReport report;
+  report.index = sizeof(*this) +
+                 EstimateHashTableSize(lanes_.bucket_count(), lanes_.size(), sizeof(decltype(lanes_)::value_type)) +
+                 EstimateHashTableSize(object_lanes_.bucket_count(), object_lanes_.size(),
+                                       sizeof(decltype(object_lanes_)::value_type));
+  for (const auto& lane_id_intervals : lanes_) {
+    report.index += EstimateHeapSize(lane_id_intervals.first.string()) +
+                    lane_id_intervals.second.intervals.capacity() * sizeof(LaneObjectInterval) +
+                    lane_id_intervals.second.max_s_max.capacity() * sizeof(double);
+  }
+  for (const auto& id_lane_ids : object_lanes_) {
+    report.index += EstimateHeapSize(id_lane_ids.first.string()) +
+                    id_lane_ids.second.capacity() * sizeof(maliput::api::LaneId);
+    for (const maliput::api::LaneId& lane_id : id_lane_ids.second) {
+      report.index += EstimateHeapSize(lane_id.string());
+    }
+  }
+  return report;
+}
+
+void LaneObjectIndex::Rebuild(LaneIntervals* lane_intervals) {
+  std::vector<LaneObjectInterval>& intervals = lane_intervals->intervals;
+  std::sort(intervals.begin(), intervals.end(), [](const LaneObjectInterval& lhs, const LaneObjectInterval& rhs) {
+    return lhs.s_min != rhs.s_min ? lhs.s_min < rhs.s_min : lhs.object->id().string() < rhs.object->id().string();
+  });
+  lane_intervals->max_s_max.resize(intervals.size());
+  ComputeMaxSMax(intervals, 0, intervals.size(), &lane_intervals->max_s_max);
+}
+
+}  // namespace object
+}  // namespace maliput
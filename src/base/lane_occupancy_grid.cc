@@ -0,0 +1,249 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/lane_occupancy_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/overlapping_type.h>
+
+namespace maliput {
+namespace object {
+
+using maliput::math::Vector3;
+
+LaneOccupancyGrid::LaneOccupancyGrid(double length, double r_min, double r_max, double s_resolution,
+                                     double r_resolution)
+    : length_(length), r_min_(r_min), r_max_(r_max), s_resolution_(s_resolution), r_resolution_(r_resolution) {
+  MALIPUT_THROW_UNLESS(length_ >= 0.);
+  MALIPUT_THROW_UNLESS(r_max_ >= r_min_);
+  MALIPUT_THROW_UNLESS(s_resolution_ > 0.);
+  MALIPUT_THROW_UNLESS(r_resolution_ > 0.);
+  num_s_cells_ = std::max(1, static_cast<int>(std::ceil(length_ / s_resolution_)));
+  num_r_cells_ = std::max(1, static_cast<int>(std::ceil((r_max_ - r_min_) / r_resolution_)));
+  words_per_row_ = (num_r_cells_ + 63) / 64;
+  bits_.assign(static_cast<std::size_t>(num_s_cells_) * words_per_row_, 0u);
+}
+
+void LaneOccupancyGrid::Update(const LaneObjectInterval& interval) {
+  MALIPUT_THROW_UNLESS(interval.object != nullptr);
+  Remove(interval.object->id());
+  intervals_.emplace(interval.object->id(), interval);
+  if (const std::optional<CellRange> cells = ToCellRange(interval); cells.has_value()) {
+    Rasterize(*cells, true);
+  }
+}
+
+bool LaneOccupancyGrid::Remove(const api::Object<Vector3>::Id& id) {
+  const auto it = intervals_.find(id);
+  if (it == intervals_.end()) {
+    return false;
+  }
+  const LaneObjectInterval interval = it->second;
+  intervals_.erase(it);
+  Erase(interval);
+  return true;
+}
+
+MemoryUsageReport LaneOccupancyGrid::MemoryUsage() const {
+  MemoryUsageReport report;
+  report.index = sizeof(*this) + bits_.capacity() * sizeof(std::uint64_t) +
+                 EstimateHashTableSize(intervals_.bucket_count(), intervals_.size(),
+                                       sizeof(decltype(intervals_)::value_type));
+  for (const auto& id_interval : intervals_) {
+    report.index += EstimateHeapSize(id_interval.first.string());
+  }
+  return report;
+}
+
+std::optional<LaneOccupancyGrid::CellRange> LaneOccupancyGrid::ToCellRange(const LaneObjectInterval& interval) const {
+  if (interval.s_max < 0. || interval.s_min > length_ || interval.r_max < r_min_ || interval.r_min > r_max_) {
+    return std::nullopt;
+  }
+  return CellRange{ToCell(interval.s_min / s_resolution_, num_s_cells_),
+                   ToCell(interval.s_max / s_resolution_, num_s_cells_),
+                   ToCell((interval.r_min - r_min_) / r_resolution_, num_r_cells_),
+                   ToCell((interval.r_max - r_min_) / r_resolution_, num_r_cells_)};
+}
+
+void LaneOccupancyGrid::Rasterize(const CellRange& cells, bool occupied) {
+  for (int s_cell = cells.s_first; s_cell <= cells.s_last; ++s_cell) {
+    std::uint64_t* row = &bits_[static_cast<std::size_t>(s_cell) * words_per_row_];
+    for (int word = cells.r_first / 64; word <= cells.r_last / 64; ++word) {
+      const int first_bit = word == cells.r_first / 64 ? cells.r_first % 64 : 0;
+      const int last_bit = word == cells.r_last / 64 ? cells.r_last % 64 : 63;
+      const std::uint64_t mask = (~std::uint64_t{0} >> (63 - last_bit)) & (~std::uint64_t{0} << first_bit);
+      row[word] = occupied ? row[word] | mask : row[word] & ~mask;
+    }
+  }
+}
+
+void LaneOccupancyGrid::Erase(const LaneObjectInterval& interval) {
+  const std::optional<CellRange> cells = ToCellRange(interval);
+  if (!cells.has_value()) {
+    return;
+  }
+  Rasterize(*cells, false);
+  for (const auto& id_interval : intervals_) {
+    const std::optional<CellRange> other = ToCellRange(id_interval.second);
+    if (other.has_value() && other->s_first <= cells->s_last && other->s_last >= cells->s_first &&
+        other->r_first <= cells->r_last && other->r_last >= cells->r_first) {
+      Rasterize(*other, true);
+    }
+  }
+}
+
+LaneOccupancyGrids::LaneOccupancyGrids(const api::ObjectQuery* object_query, double s_resolution,
+                                       double r_resolution)
+    : object_query_(object_query), s_resolution_(s_resolution), r_resolution_(r_resolution) {
+  MALIPUT_THROW_UNLESS(object_query_ != nullptr);
+  MALIPUT_THROW_UNLESS(s_resolution_ > 0.);
+  MALIPUT_THROW_UNLESS(r_resolution_ > 0.);
+  for (const auto& id_object : object_query_->object_book()->objects()) {
+    Update(id_object.second);
+  }
+}
+
+void LaneOccupancyGrids::Update(const api::Object<Vector3>* object, const std::vector<LaneFootprint>& footprints) {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  std::vector<const maliput::api::Lane*> lanes;
+  for (const LaneFootprint& footprint : footprints) {
+    lanes.push_back(object_query_->road_network()->road_geometry()->ById().GetLane(footprint.lane_id));
+    MALIPUT_THROW_UNLESS(lanes.back() != nullptr);
+  }
+  Remove(object->id());
+  for (std::size_t i = 0; i < footprints.size(); ++i) {
+    const maliput::api::Lane* lane = lanes[i];
+    auto it = grids_.find(lane);
+    if (it == grids_.end()) {
+      double r_min = std::numeric_limits<double>::infinity();
+      double r_max = -std::numeric_limits<double>::infinity();
+      for (const double s : {0., lane->length() / 2., lane->length()}) {
+        const maliput::api::RBounds lane_bounds = lane->lane_bounds(s);
+        r_min = std::min(r_min, lane_bounds.min());
+        r_max = std::max(r_max, lane_bounds.max());
+      }
+      it = grids_.emplace(lane, LaneOccupancyGrid(lane->length(), r_min, r_max, s_resolution_, r_resolution_)).first;
+    }
+    it->second.Update(
+        {object, footprints[i].s_min, footprints[i].s_max, footprints[i].r_min, footprints[i].r_max});
+  }
+  object_lanes_.emplace(object->id(), std::move(lanes));
+}
+
+void LaneOccupancyGrids::Update(const api::Object<Vector3>* object) {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  std::vector<LaneFootprint> footprints;
+  object_query_->VisitOverlappingLanesIn(object, maliput::math::OverlappingType::kIntersected,
+                                         [&footprints, object](const maliput::api::Lane* lane) {
+                                           footprints.push_back(ComputeLaneFootprint(lane, object));
+                                         });
+  Update(object, footprints);
+}
+
+bool LaneOccupancyGrids::Remove(const api::Object<Vector3>::Id& id) {
+  const auto it = object_lanes_.find(id);
+  if (it == object_lanes_.end()) {
+    return false;
+  }
+  for (const maliput::api::Lane* lane : it->second) {
+    grids_.at(lane).Remove(id);
+  }
+  object_lanes_.erase(it);
+  return true;
+}
+
+template <typename Visitor>
+void LaneOccupancyGrids::VisitSamples(const std::vector<maliput::api::RoadPosition>& trajectory,
+                                      Visitor visitor) const {
+  const maliput::api::Lane* lane{};
+  const LaneOccupancyGrid* grid{};
+  for (std::size_t i = 0; i < trajectory.size(); ++i) {
+    const maliput::api::RoadPosition& sample = trajectory[i];
+    if (i == 0 || sample.lane != lane) {
+      lane = sample.lane;
+      const auto it = grids_.find(lane);
+      grid = it == grids_.end() ? nullptr : &it->second;
+    }
+    if (!visitor(i, grid != nullptr && grid->IsOccupied(sample.pos.s(), sample.pos.r()))) {
+      return;
+    }
+  }
+}
+
+std::vector<bool> LaneOccupancyGrids::IsOccupied(const std::vector<maliput::api::RoadPosition>& trajectory) const {
+  std::vector<bool> occupied(trajectory.size());
+  VisitSamples(trajectory, [&occupied](std::size_t i, bool sample_occupied) {
+    occupied[i] = sample_occupied;
+    return true;
+  });
+  return occupied;
+}
+
+std::optional<std::size_t> LaneOccupancyGrids::FindFirstOccupied(
+    const std::vector<maliput::api::RoadPosition>& trajectory) const {
+  std::optional<std::size_t> first;
+  VisitSamples(trajectory, [&first](std::size_t i, bool sample_occupied) {
+    if (sample_occupied) {
+      first = i;
+    }
+    return !sample_occupied;
+  });
+  return first;
+}
+
+const LaneOccupancyGrid* LaneOccupancyGrids::GetGrid(const maliput::api::Lane* lane) const {
+  const auto it = grids_.find(lane);
+  return it == grids_.end() ? nullptr : &it->second;
+}
+
+MemoryUsageReport LaneOccupancyGrids::MemoryUsage() const {
+  MemoryUsageReport report;
+  report.index = sizeof(*this) +
+                 EstimateHashTableSize(grids_.bucket_count(), grids_.size(), sizeof(decltype(grids_)::value_type)) +
+                 EstimateHashTableSize(object_lanes_.bucket_count(), object_lanes_.size(),
+                                       sizeof(decltype(object_lanes_)::value_type));
+  for (const auto& lane_grid : grids_) {
+    report.index += lane_grid.second.MemoryUsage().index - sizeof(LaneOccupancyGrid);
+  }
+  for (const auto& id_lanes : object_lanes_) {
+    report.index += EstimateHeapSize(id_lanes.first.string()) +
+                    id_lanes.second.capacity() * sizeof(const maliput::api::Lane*);
+  }
+  return report;
+}
+
+}  // namespace object
+}  // namespace maliput
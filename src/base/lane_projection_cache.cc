@@ -0,0 +1,140 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/lane_projection_cache.h"
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/overlapping_type.h>
+
+namespace maliput {
+namespace object {
+
+using maliput::math::Vector3;
+
+LaneProjectionCache::LaneProjectionCache(const api::ObjectQuery* object_query) : object_query_(object_query) {
+  MALIPUT_THROW_UNLESS(object_query_ != nullptr);
+}
+
+void LaneProjectionCache::Compute(const std::vector<const api::Object<Vector3>*>& objects, int num_threads) {
+  MALIPUT_THROW_UNLESS(num_threads >= 0);
+  std::vector<const api::Object<Vector3>*> misses;
+  for (const api::Object<Vector3>* object : objects) {
+    MALIPUT_THROW_UNLESS(object != nullptr);
+    if (Find(object) == nullptr) {
+      misses.push_back(object);
+    }
+  }
+  if (misses.empty()) {
+    return;
+  }
+  if (num_threads == 0) {
+    num_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+  const std::size_t num_chunks = std::min(misses.size(), static_cast<std::size_t>(num_threads));
+  const std::size_t chunk_size = (misses.size() + num_chunks - 1) / num_chunks;
+  // Workers write the projections of disjoint chunks of the misses, which are moved into the entries once they are
+  // all done.
+  std::vector<std::vector<LaneProjection>> projections(misses.size());
+  const auto project_chunk = [this, &misses, &projections, chunk_size](std::size_t chunk) {
+    for (std::size_t i = chunk * chunk_size; i < std::min((chunk + 1) * chunk_size, misses.size()); ++i) {
+      projections[i] = Project(misses[i]);
+    }
+  };
+  std::vector<std::future<void>> workers;
+  for (std::size_t chunk = 1; chunk < num_chunks; ++chunk) {
+    workers.push_back(std::async(std::launch::async, project_chunk, chunk));
+  }
+  project_chunk(0);
+  for (std::future<void>& worker : workers) {
+    worker.get();
+  }
+  for (std::size_t i = 0; i < misses.size(); ++i) {
+    entries_.insert_or_assign(misses[i]->id(),
+                              Entry{BoundingRegionSnapshot(misses[i]->bounding_region()), std::move(projections[i])});
+  }
+}
+
+void LaneProjectionCache::ComputeAll(int num_threads) {
+  std::vector<const api::Object<Vector3>*> objects;
+  for (const auto& id_object : object_query_->object_book()->objects()) {
+    objects.push_back(id_object.second);
+  }
+  Compute(objects, num_threads);
+}
+
+const std::vector<LaneProjection>* LaneProjectionCache::Find(const api::Object<Vector3>* object) const {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  const auto it = entries_.find(object->id());
+  return it == entries_.end() || !it->second.region.Matches(object->bounding_region()) ? nullptr
+                                                                                         : &it->second.projections;
+}
+
+const std::vector<LaneProjection>& LaneProjectionCache::Get(const api::Object<Vector3>* object) {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  const auto it = entries_.find(object->id());
+  if (it != entries_.end() && it->second.region.Matches(object->bounding_region())) {
+    return it->second.projections;
+  }
+  std::vector<LaneProjection> projections = Project(object);
+  return entries_
+      .insert_or_assign(object->id(), Entry{BoundingRegionSnapshot(object->bounding_region()), std::move(projections)})
+      .first->second.projections;
+}
+
+bool LaneProjectionCache::Invalidate(const api::Object<Vector3>::Id& id) { return entries_.erase(id) != 0; }
+
+MemoryUsageReport LaneProjectionCache::MemoryUsage() const {
+  MemoryUsageReport report;
+  report.caches = sizeof(*this) + EstimateHashTableSize(entries_.bucket_count(), entries_.size(),
+                                                        sizeof(decltype(entries_)::value_type));
+  for (const auto& id_entry : entries_) {
+    report.caches +=
+        EstimateHeapSize(id_entry.first.string()) + id_entry.second.projections.capacity() * sizeof(LaneProjection);
+  }
+  return report;
+}
+
+std::vector<LaneProjection> LaneProjectionCache::Project(const api::Object<Vector3>* object) const {
+  std::vector<LaneProjection> projections;
+  object_query_->VisitOverlappingLanesIn(
+      object, maliput::math::OverlappingType::kIntersected, [&projections, object](const maliput::api::Lane* lane) {
+        projections.push_back(
+            {lane, lane->ToLanePosition(maliput::api::InertialPosition::FromXyz(object->position())).lane_position});
+      });
+  projections.shrink_to_fit();
+  return projections;
+}
+
+}  // namespace object
+}  // namespace maliput
@@ -29,26 +29,170 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_object/base/manual_object_book.h"
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
 #include <maliput/math/vector.h>
 
+#include "maliput_object/base/query_statistics.h"
+#include "maliput_object/base/tracing.h"
+
 namespace maliput {
 namespace object {
 
+namespace {
+
+std::shared_future<void> MakeReadyFuture() {
+  std::promise<void> promise;
+  promise.set_value();
+  return promise.get_future().share();
+}
+
+// State of an overlapping search. Visitors capture it by a single reference so that they fit in the small buffer of
+// std::function and the search does not allocate.
+template <typename Coordinate>
+struct OverlappingSearch {
+  // Calls the visitor with @p object when it overlaps with the region.
+  void Check(api::Object<Coordinate>* object) {
+    statistics->AddCandidates(1);
+    if ((object->bounding_region().Overlaps(region) & overlapping_type) == overlapping_type) {
+      ++num_results;
+      visitor(object);
+    }
+  }
+
+  const maliput::math::BoundingRegion<Coordinate>& region;
+  const maliput::math::OverlappingType& overlapping_type;
+  const std::function<void(api::Object<Coordinate>*)>& visitor;
+  QueryStatisticsScope* statistics;
+  std::size_t num_results{0};
+};
+
+}  // namespace
+
+template <typename Coordinate>
+ManualObjectBook<Coordinate>::ManualObjectBook(double index_tolerance)
+    : index_tolerance_(index_tolerance), index_ready_(MakeReadyFuture()), sweep_and_prune_(index_tolerance) {
+  MALIPUT_THROW_UNLESS(index_tolerance_ >= 0.);
+}
+
+template <typename Coordinate>
+ManualObjectBook<Coordinate>::~ManualObjectBook() {
+  index_ready_.wait();
+}
+
 template <typename Coordinate>
 void ManualObjectBook<Coordinate>::AddObject(std::unique_ptr<api::Object<Coordinate>> object) {
   MALIPUT_THROW_UNLESS(object != nullptr);
-  objects_.emplace(object->id(), std::move(object));
+  index_ready_.wait();
+  api::Object<Coordinate>* object_ptr = object.get();
+  if (!objects_.emplace(object->id(), std::move(object)).second) {
+    return;
+  }
+  sweep_and_prune_.Insert(object_ptr);
+  if (index_ != nullptr) {
+    unindexed_objects_.push_back(object_ptr);
+  }
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> ManualObjectBook<Coordinate>::InsertObjects(
+    std::vector<std::unique_ptr<api::Object<Coordinate>>> objects) {
+  MALIPUT_THROW_UNLESS(
+      std::none_of(objects.begin(), objects.end(), [](const auto& object) { return object == nullptr; }));
+  index_ready_.wait();
+  objects_.reserve(objects_.size() + objects.size());
+  for (auto& object : objects) {
+    objects_.emplace(object->id(), std::move(object));
+  }
+  std::vector<api::Object<Coordinate>*> book_objects;
+  book_objects.reserve(objects_.size());
+  for (const auto& pair : objects_) {
+    book_objects.push_back(pair.second.get());
+  }
+  sweep_and_prune_.Update(book_objects);
+  return book_objects;
+}
+
+template <typename Coordinate>
+void ManualObjectBook<Coordinate>::AddObjects(std::vector<std::unique_ptr<api::Object<Coordinate>>> objects) {
+  const std::vector<api::Object<Coordinate>*> book_objects = InsertObjects(std::move(objects));
+  MALIPUT_OBJECT_TRACE_SPAN("ManualObjectBook::BuildIndex");
+  std::atomic_store(&index_, std::make_shared<BoundingVolumeHierarchy<Coordinate>>(book_objects, index_tolerance_));
+  unindexed_objects_.clear();
+}
+
+template <typename Coordinate>
+std::shared_future<void> ManualObjectBook<Coordinate>::AddObjectsAsync(
+    std::vector<std::unique_ptr<api::Object<Coordinate>>> objects, std::function<void()> on_index_ready) {
+  std::vector<api::Object<Coordinate>*> book_objects = InsertObjects(std::move(objects));
+  // Queries fall back to linear search until the new index is swapped in.
+  std::atomic_store(&index_, std::shared_ptr<BoundingVolumeHierarchy<Coordinate>>{});
+  unindexed_objects_.clear();
+  auto build_index = [this, book_objects = std::move(book_objects), on_index_ready = std::move(on_index_ready)]() {
+    MALIPUT_OBJECT_TRACE_SPAN("ManualObjectBook::BuildIndex");
+    std::atomic_store(&index_, std::make_shared<BoundingVolumeHierarchy<Coordinate>>(book_objects, index_tolerance_));
+    if (on_index_ready) {
+      on_index_ready();
+    }
+  };
+  index_ready_ = std::async(std::launch::async, std::move(build_index)).share();
+  return index_ready_;
 }
 
 template <typename Coordinate>
 void ManualObjectBook<Coordinate>::RemoveObject(const typename api::Object<Coordinate>::Id& object) {
   MALIPUT_THROW_UNLESS(objects_.find(object) != objects_.end());
+  index_ready_.wait();
+  if (index_ != nullptr && !index_->Remove(object)) {
+    unindexed_objects_.erase(std::find_if(unindexed_objects_.begin(), unindexed_objects_.end(),
+                                          [&object](const auto* unindexed) { return unindexed->id() == object; }));
+  }
+  sweep_and_prune_.Remove(object);
   objects_.erase(object);
 }
 
+template <typename Coordinate>
+std::shared_ptr<const BoundingVolumeHierarchy<Coordinate>> ManualObjectBook<Coordinate>::index() const {
+  const std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index = std::atomic_load(&index_);
+  return unindexed_objects_.empty() ? index : nullptr;
+}
+
+template <typename Coordinate>
+int ManualObjectBook<Coordinate>::num_stale_index_entries() const {
+  const std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index = std::atomic_load(&index_);
+  return static_cast<int>(unindexed_objects_.size()) + (index != nullptr ? index->num_removed() : 0);
+}
+
+template <typename Coordinate>
+MemoryUsageReport ManualObjectBook<Coordinate>::MemoryUsage() const {
+  MemoryUsageReport report;
+  report.containers = sizeof(*this) +
+                      EstimateHashTableSize(objects_.bucket_count(), objects_.size(),
+                                            sizeof(typename decltype(objects_)::value_type)) +
+                      unindexed_objects_.capacity() * sizeof(api::Object<Coordinate>*);
+  for (const auto& id_object : objects_) {
+    report.ids += EstimateHeapSize(id_object.first.string());
+    report += EstimateMemoryUsage(*id_object.second);
+  }
+  const std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index = std::atomic_load(&index_);
+  if (index != nullptr) {
+    report += index->MemoryUsage();
+  }
+  MemoryUsageReport sweep_and_prune = sweep_and_prune_.MemoryUsage();
+  // The SweepAndPrune itself is accounted in sizeof(*this).
+  sweep_and_prune.index -= sizeof(sweep_and_prune_);
+  report += sweep_and_prune;
+  return report;
+}
+
 template <typename Coordinate>
 std::unordered_map<typename api::Object<Coordinate>::Id, api::Object<Coordinate>*>
 ManualObjectBook<Coordinate>::do_objects() const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kObjects);
+  statistics.SetResults(objects_.size());
   std::unordered_map<typename api::Object<Coordinate>::Id, api::Object<Coordinate>*> objects;
   objects.reserve(objects_.size());
   for (const auto& pair : objects_) {
@@ -60,7 +204,9 @@ ManualObjectBook<Coordinate>::do_objects() const {
 template <typename Coordinate>
 api::Object<Coordinate>* ManualObjectBook<Coordinate>::DoFindById(
     const typename api::Object<Coordinate>::Id& object_id) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindById);
   const auto it = objects_.find(object_id);
+  statistics.SetResults(it == objects_.end() ? 0 : 1);
   return it == objects_.end() ? nullptr : it->second.get();
 }
 
@@ -68,11 +214,7 @@ template <typename Coordinate>
 std::vector<api::Object<Coordinate>*> ManualObjectBook<Coordinate>::DoFindByPredicate(
     std::function<bool(const api::Object<Coordinate>*)> predicate) const {
   std::vector<api::Object<Coordinate>*> result;
-  std::for_each(objects_.begin(), objects_.end(), [&predicate, &result](const auto& pair) {
-    if (predicate(pair.second.get())) {
-      result.push_back(pair.second.get());
-    }
-  });
+  DoVisitByPredicate(predicate, [&result](api::Object<Coordinate>* object) { result.push_back(object); });
   return result;
 }
 
@@ -81,14 +223,220 @@ std::vector<api::Object<Coordinate>*> ManualObjectBook<Coordinate>::DoFindOverla
     const maliput::math::BoundingRegion<Coordinate>& region,
     const maliput::math::OverlappingType& overlapping_type) const {
   std::vector<api::Object<Coordinate>*> result;
-  std::for_each(objects_.begin(), objects_.end(), [&region, &overlapping_type, &result](const auto& pair) {
-    if ((pair.second->bounding_region().Overlaps(region) & overlapping_type) == overlapping_type) {
-      result.push_back(pair.second.get());
+  DoVisitOverlappingIn(region, overlapping_type,
+                       [&result](api::Object<Coordinate>* object) { result.push_back(object); });
+  return result;
+}
+
+template <typename Coordinate>
+void ManualObjectBook<Coordinate>::DoVisitByPredicate(
+    const std::function<bool(const api::Object<Coordinate>*)>& predicate,
+    const std::function<void(api::Object<Coordinate>*)>& visitor) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindByPredicate);
+  std::size_t num_results{0};
+  for (const auto& pair : objects_) {
+    if (predicate(pair.second.get())) {
+      ++num_results;
+      visitor(pair.second.get());
+    }
+  }
+  statistics.AddCandidates(objects_.size());
+  statistics.SetResults(num_results);
+}
+
+template <typename Coordinate>
+void ManualObjectBook<Coordinate>::DoVisitOverlappingIn(
+    const maliput::math::BoundingRegion<Coordinate>& region, const maliput::math::OverlappingType& overlapping_type,
+    const std::function<void(api::Object<Coordinate>*)>& visitor) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindOverlappingIn);
+  OverlappingSearch<Coordinate> search{region, overlapping_type, visitor, &statistics};
+  const std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index = std::atomic_load(&index_);
+  // Objects that are disjointed from the region cannot be pruned by the index.
+  const std::optional<AxisAlignedBox<Coordinate>> region_box =
+      index != nullptr && overlapping_type != maliput::math::OverlappingType::kDisjointed
+          ? ComputeAxisAlignedBox(region, index_tolerance_)
+          : std::nullopt;
+  if (region_box.has_value()) {
+    index->VisitCandidates(region_box.value(), [&search](api::Object<Coordinate>* object) { search.Check(object); });
+    for (api::Object<Coordinate>* object : unindexed_objects_) {
+      search.Check(object);
+    }
+  } else {
+    for (const auto& pair : objects_) {
+      search.Check(pair.second.get());
+    }
+  }
+  statistics.SetResults(search.num_results);
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> ManualObjectBook<Coordinate>::DoFindNearest(
+    const Coordinate& position, int k, const std::function<bool(const api::Object<Coordinate>*)>& predicate) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindNearest);
+  if (k == 0) {
+    return {};
+  }
+  NearestObjects<Coordinate> nearest(k);
+  const auto offer = [&position, &predicate, &nearest, &statistics](api::Object<Coordinate>* object) {
+    statistics.AddCandidates(1);
+    if (!predicate || predicate(object)) {
+      nearest.Offer(object, api::ComputeDistance(object->bounding_region(), position));
+    }
+  };
+  const std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index = std::atomic_load(&index_);
+  if (index != nullptr) {
+    std::for_each(unindexed_objects_.begin(), unindexed_objects_.end(), offer);
+    index->VisitNearest(position, [&offer, &nearest](api::Object<Coordinate>* object, double lower_bound) {
+      // The remaining objects cannot be closer than the farthest object kept.
+      if (lower_bound > nearest.max_distance()) {
+        return false;
+      }
+      offer(object);
+      return true;
+    });
+  } else {
+    for (const auto& pair : objects_) {
+      offer(pair.second.get());
+    }
+  }
+  std::vector<api::Object<Coordinate>*> result = nearest.Sorted();
+  statistics.SetResults(result.size());
+  return result;
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> ManualObjectBook<Coordinate>::DoFindWithinDistance(const Coordinate& position,
+                                                                                         double radius) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindWithinDistance);
+  NearestObjects<Coordinate> within(std::numeric_limits<int>::max());
+  const auto offer = [&position, radius, &within, &statistics](api::Object<Coordinate>* object) {
+    statistics.AddCandidates(1);
+    const double distance = api::ComputeDistance(object->bounding_region(), position);
+    if (distance <= radius) {
+      within.Offer(object, distance);
+    }
+  };
+  const std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index = std::atomic_load(&index_);
+  if (index != nullptr) {
+    std::for_each(unindexed_objects_.begin(), unindexed_objects_.end(), offer);
+    index->VisitCandidates(AxisAlignedBox<Coordinate>{position, position}.Inflate(radius), offer);
+  } else {
+    for (const auto& pair : objects_) {
+      offer(pair.second.get());
+    }
+  }
+  std::vector<api::Object<Coordinate>*> result = within.Sorted();
+  statistics.SetResults(result.size());
+  return result;
+}
+
+template <typename Coordinate>
+std::vector<api::RayHit<Coordinate>> ManualObjectBook<Coordinate>::DoRayCastAll(const api::Ray<Coordinate>& ray) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kRayCastAll);
+  NearestObjects<Coordinate> hits(std::numeric_limits<int>::max());
+  const auto offer = [&ray, &hits, &statistics](api::Object<Coordinate>* object) {
+    statistics.AddCandidates(1);
+    const std::optional<double> distance = api::ComputeRayIntersection(object->bounding_region(), ray);
+    if (distance.has_value()) {
+      hits.Offer(object, distance.value());
+    }
+  };
+  const std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index = std::atomic_load(&index_);
+  if (index != nullptr) {
+    std::for_each(unindexed_objects_.begin(), unindexed_objects_.end(), offer);
+    index->VisitRayCandidates(ray, [&offer](api::Object<Coordinate>* object, double) {
+      offer(object);
+      return true;
+    });
+  } else {
+    for (const auto& pair : objects_) {
+      offer(pair.second.get());
+    }
+  }
+  std::vector<api::RayHit<Coordinate>> result;
+  for (const auto& distance_object : hits.SortedWithDistances()) {
+    result.push_back({distance_object.second, distance_object.first});
+  }
+  statistics.SetResults(result.size());
+  return result;
+}
+
+template <typename Coordinate>
+void ManualObjectBook<Coordinate>::DoRayCast(const std::vector<api::Ray<Coordinate>>& rays,
+                                             std::vector<std::optional<api::RayHit<Coordinate>>>* hits) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kRayCast);
+  // Ranges shrink to the closest hit found so far, which prunes farther candidates.
+  std::vector<double> ranges;
+  ranges.reserve(rays.size());
+  for (const api::Ray<Coordinate>& ray : rays) {
+    ranges.push_back(ray.max_range);
+  }
+  const auto offer = [&rays, &ranges, hits, &statistics](std::size_t ray, api::Object<Coordinate>* object) {
+    statistics.AddCandidates(1);
+    const std::optional<double> distance =
+        api::ComputeRayIntersection(object->bounding_region(), {rays[ray].origin, rays[ray].direction, ranges[ray]});
+    std::optional<api::RayHit<Coordinate>>& hit = (*hits)[ray];
+    if (distance.has_value() &&
+        (!hit.has_value() || distance.value() < hit->distance ||
+         (distance.value() == hit->distance && object->id().string() < hit->object->id().string()))) {
+      hit = api::RayHit<Coordinate>{object, distance.value()};
+      ranges[ray] = distance.value();
+    }
+  };
+  const auto offer_to_every_ray = [&rays, &offer](api::Object<Coordinate>* object) {
+    for (std::size_t ray = 0; ray < rays.size(); ++ray) {
+      offer(ray, object);
+    }
+  };
+  const std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index = std::atomic_load(&index_);
+  if (index != nullptr) {
+    std::for_each(unindexed_objects_.begin(), unindexed_objects_.end(), offer_to_every_ray);
+    index->VisitRayPacketCandidates(rays, &ranges, offer);
+  } else {
+    for (const auto& pair : objects_) {
+      offer_to_every_ray(pair.second.get());
+    }
+  }
+  statistics.SetResults(std::count_if(hits->begin(), hits->end(), [](const auto& hit) { return hit.has_value(); }));
+}
+
+template <typename Coordinate>
+std::vector<api::Object<Coordinate>*> ManualObjectBook<Coordinate>::DoFindInFrustum(
+    const api::Frustum<Coordinate>& frustum) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindInFrustum);
+  std::vector<api::Object<Coordinate>*> result;
+  const auto check = [&frustum, &result, &statistics](api::Object<Coordinate>* object) {
+    statistics.AddCandidates(1);
+    if (api::OverlapsFrustum(object->bounding_region(), frustum)) {
+      result.push_back(object);
+    }
+  };
+  const std::shared_ptr<BoundingVolumeHierarchy<Coordinate>> index = std::atomic_load(&index_);
+  if (index != nullptr) {
+    std::for_each(unindexed_objects_.begin(), unindexed_objects_.end(), check);
+    index->VisitFrustumCandidates(frustum, check);
+  } else {
+    for (const auto& pair : objects_) {
+      check(pair.second.get());
     }
-  });
+  }
+  statistics.SetResults(result.size());
   return result;
 }
 
+template <typename Coordinate>
+std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>>
+ManualObjectBook<Coordinate>::DoFindAllOverlappingPairs() const {
+  MALIPUT_OBJECT_TRACE_SPAN("ManualObjectBook::FindAllOverlappingPairs");
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindAllOverlappingPairs);
+  std::size_t num_candidates{0};
+  std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> pairs =
+      sweep_and_prune_.FindOverlappingPairs(QueryStatisticsEnabled() ? &num_candidates : nullptr);
+  statistics.AddCandidates(num_candidates);
+  statistics.SetResults(pairs.size());
+  return pairs;
+}
+
 template class ManualObjectBook<maliput::math::Vector3>;
 
 }  // namespace object
@@ -0,0 +1,90 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/memory_usage.h"
+
+#include <map>
+#include <type_traits>
+
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace object {
+namespace {
+
+// Links and color of a red-black tree node, as used by std::map.
+constexpr std::size_t kTreeNodeOverhead{4 * sizeof(void*)};
+
+}  // namespace
+
+MemoryUsageReport& MemoryUsageReport::operator+=(const MemoryUsageReport& other) {
+  objects += other.objects;
+  bounding_regions += other.bounding_regions;
+  properties += other.properties;
+  ids += other.ids;
+  index += other.index;
+  caches += other.caches;
+  containers += other.containers;
+  mapped += other.mapped;
+  return *this;
+}
+
+std::size_t EstimateHeapSize(const std::string& value) {
+  static const std::size_t kSmallStringCapacity = std::string().capacity();
+  return value.capacity() > kSmallStringCapacity ? value.capacity() + 1 : 0;
+}
+
+std::size_t EstimateHashTableSize(std::size_t bucket_count, std::size_t size, std::size_t value_size) {
+  // Every node holds the value, a link to the next node and the cached hash.
+  return bucket_count * sizeof(void*) + size * (value_size + sizeof(void*) + sizeof(std::size_t));
+}
+
+template <typename Coordinate>
+MemoryUsageReport EstimateMemoryUsage(const api::Object<Coordinate>& object) {
+  MemoryUsageReport report;
+  report.objects = sizeof(api::Object<Coordinate>);
+  report.ids = EstimateHeapSize(object.id().string());
+  report.bounding_regions = sizeof(maliput::math::BoundingRegion<Coordinate>);
+  if constexpr (std::is_same_v<Coordinate, maliput::math::Vector3>) {
+    if (dynamic_cast<const maliput::math::BoundingBox*>(&object.bounding_region()) != nullptr) {
+      report.bounding_regions = sizeof(maliput::math::BoundingBox);
+    }
+  }
+  for (const auto& key_value : object.get_properties()) {
+    report.properties += kTreeNodeOverhead + sizeof(std::map<std::string, std::string>::value_type) +
+                         EstimateHeapSize(key_value.first) + EstimateHeapSize(key_value.second);
+  }
+  return report;
+}
+
+template MemoryUsageReport EstimateMemoryUsage(const api::Object<maliput::math::Vector3>&);
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,175 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/object_lane_associations.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_box.h>
+
+#include "maliput_object/base/bounding_region_snapshot.h"
+
+namespace maliput {
+namespace object {
+namespace {
+
+// Incremental 64-bit FNV-1a hash.
+class Fnv1aHash {
+ public:
+  void Add(const std::string& value) {
+    for (const char c : value) {
+      AddByte(static_cast<std::uint8_t>(c));
+    }
+    // Separates consecutive strings.
+    AddByte(0);
+  }
+
+  void Add(std::int64_t value) {
+    for (int i = 0; i < 8; ++i) {
+      AddByte(static_cast<std::uint8_t>((static_cast<std::uint64_t>(value) >> (8 * i)) & 0xff));
+    }
+  }
+
+  std::string ToHexString() const {
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash_;
+    return ss.str();
+  }
+
+ private:
+  static constexpr std::uint64_t kPrime{0x100000001b3};
+
+  void AddByte(std::uint8_t byte) {
+    hash_ ^= byte;
+    hash_ *= kPrime;
+  }
+
+  std::uint64_t hash_{0xcbf29ce484222325};
+};
+
+}  // namespace
+
+std::string ComputeRoadNetworkHash(const maliput::api::RoadGeometry* road_geometry) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  const double quantum = road_geometry->linear_tolerance();
+  MALIPUT_THROW_UNLESS(quantum > 0.);
+  const auto quantize = [quantum](double value) { return static_cast<std::int64_t>(std::llround(value / quantum)); };
+
+  std::vector<const maliput::api::Lane*> lanes;
+  for (const auto& lane_id_lane : road_geometry->ById().GetLanes()) {
+    lanes.push_back(lane_id_lane.second);
+  }
+  std::sort(lanes.begin(), lanes.end(), [](const maliput::api::Lane* lhs, const maliput::api::Lane* rhs) {
+    return lhs->id().string() < rhs->id().string();
+  });
+
+  Fnv1aHash hash;
+  hash.Add(road_geometry->id().string());
+  for (const maliput::api::Lane* lane : lanes) {
+    hash.Add(lane->id().string());
+    hash.Add(quantize(lane->length()));
+    const double length = lane->length();
+    const double step = kRoadNetworkHashSamplingStep * quantum;
+    const auto num_steps = static_cast<std::int64_t>(std::ceil(length / step));
+    for (std::int64_t i = 0; i <= num_steps; ++i) {
+      const double s = std::min(i * step, length);
+      const maliput::api::RBounds lane_bounds = lane->lane_bounds(s);
+      for (const double r : {0., lane_bounds.min(), lane_bounds.max()}) {
+        const maliput::math::Vector3 xyz = lane->ToInertialPosition(maliput::api::LanePosition(s, r, 0.)).xyz();
+        for (const double value : {r, xyz.x(), xyz.y(), xyz.z()}) {
+          hash.Add(quantize(value));
+        }
+      }
+    }
+  }
+  return hash.ToHexString();
+}
+
+std::string ComputeObjectHash(const api::Object<maliput::math::Vector3>* object) {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  const BoundingRegionSnapshot snapshot(object->bounding_region());
+  Fnv1aHash hash;
+  hash.Add(static_cast<std::int64_t>(snapshot.is_box()));
+  // Parameters are hashed exactly: objects parsed from the same document have the same bits.
+  for (const double parameter : snapshot.parameters()) {
+    std::int64_t bits{};
+    std::memcpy(&bits, &parameter, sizeof(bits));
+    hash.Add(bits);
+  }
+  return hash.ToHexString();
+}
+
+bool AreFootprintsCurrent(const ObjectLaneAssociations& lane_associations,
+                          const api::Object<maliput::math::Vector3>* object) {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  const auto it = lane_associations.object_hashes.find(object->id());
+  return it == lane_associations.object_hashes.end() || it->second == ComputeObjectHash(object);
+}
+
+LaneFootprint ComputeLaneFootprint(const maliput::api::Lane* lane, const api::Object<maliput::math::Vector3>* object) {
+  MALIPUT_THROW_UNLESS(lane != nullptr);
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  const maliput::api::LanePosition lane_position =
+      lane->ToLanePosition(maliput::api::InertialPosition::FromXyz(object->position())).lane_position;
+  LaneFootprint footprint{lane->id(),        lane_position,     lane_position.s(),
+                          lane_position.s(), lane_position.r(), lane_position.r()};
+  const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&object->bounding_region());
+  if (bounding_box != nullptr) {
+    for (const auto& vertex : bounding_box->get_vertices()) {
+      const maliput::api::LanePosition vertex_lane_position =
+          lane->ToLanePosition(maliput::api::InertialPosition::FromXyz(vertex)).lane_position;
+      footprint.s_min = std::min(footprint.s_min, vertex_lane_position.s());
+      footprint.s_max = std::max(footprint.s_max, vertex_lane_position.s());
+      footprint.r_min = std::min(footprint.r_min, vertex_lane_position.r());
+      footprint.r_max = std::max(footprint.r_max, vertex_lane_position.r());
+    }
+  }
+  return footprint;
+}
+
+ObjectLaneAssociations ComputeObjectLaneAssociations(const api::ObjectQuery& object_query) {
+  ObjectLaneAssociations associations{ComputeRoadNetworkHash(object_query.road_network()->road_geometry()), {}, {}};
+  for (const auto& id_object : object_query.object_book()->objects()) {
+    associations.object_hashes.emplace(id_object.first, ComputeObjectHash(id_object.second));
+    std::vector<LaneFootprint>& footprints = associations.footprints[id_object.first];
+    for (const maliput::api::Lane* lane : object_query.FindOverlappingLanesIn(id_object.second)) {
+      footprints.push_back(ComputeLaneFootprint(lane, id_object.second));
+    }
+  }
+  return associations;
+}
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,679 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/query_recording.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_box.h>
+
+namespace maliput {
+namespace object {
+namespace {
+
+using maliput::math::Vector3;
+
+// Recording layout: kMagic followed by the records. Every record is the method, start and duration, a flags byte
+// telling whether the region, the overlapping type and a predicate are present, the overlapping type, the region as
+// ten doubles when present, the object ids and result ids as counted lists of length-prefixed strings, the parameters
+// as a counted list of doubles and the predicate ids as a counted list of strings. Recordings of the first version,
+// which start with kMagicVersion1, have neither parameters nor predicate ids. Integers and doubles are stored in
+// native byte order.
+constexpr char kMagic[8]{'M', 'O', 'B', 'J', 'R', 'E', 'C', '2'};
+constexpr char kMagicVersion1[8]{'M', 'O', 'B', 'J', 'R', 'E', 'C', '1'};
+constexpr std::uint8_t kHasRegion{1 << 0};
+constexpr std::uint8_t kHasOverlappingType{1 << 1};
+constexpr std::uint8_t kHasPredicate{1 << 2};
+
+template <typename T>
+void Write(T value, std::ostream* os) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  os->write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void Write(const std::vector<std::string>& values, std::ostream* os) {
+  Write(static_cast<std::uint32_t>(values.size()), os);
+  for (const std::string& value : values) {
+    Write(static_cast<std::uint32_t>(value.size()), os);
+    os->write(value.data(), value.size());
+  }
+}
+
+void Write(const std::vector<double>& values, std::ostream* os) {
+  Write(static_cast<std::uint32_t>(values.size()), os);
+  for (const double value : values) {
+    Write(value, os);
+  }
+}
+
+template <typename T>
+bool Read(std::istream* is, T* value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  return static_cast<bool>(is->read(reinterpret_cast<char*>(value), sizeof(T)));
+}
+
+bool Read(std::istream* is, std::vector<std::string>* values) {
+  std::uint32_t count{};
+  if (!Read(is, &count)) {
+    return false;
+  }
+  values->resize(count);
+  for (std::string& value : *values) {
+    std::uint32_t size{};
+    if (!Read(is, &size)) {
+      return false;
+    }
+    value.resize(size);
+    if (!is->read(value.data(), size)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Read(std::istream* is, std::vector<double>* values) {
+  std::uint32_t count{};
+  if (!Read(is, &count)) {
+    return false;
+  }
+  values->resize(count);
+  for (double& value : *values) {
+    if (!Read(is, &value)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Reads the next record of @p is. @p version_1 tells whether the recording is of the first version.
+// @returns False at the end of the recording or on a truncated record.
+bool Read(std::istream* is, bool version_1, QueryRecord* record) {
+  std::uint8_t method{};
+  std::int64_t start{};
+  std::int64_t duration{};
+  std::uint8_t flags{};
+  std::uint8_t overlapping_type{};
+  if (!Read(is, &method) || !Read(is, &start) || !Read(is, &duration) || !Read(is, &flags) ||
+      !Read(is, &overlapping_type)) {
+    return false;
+  }
+  MALIPUT_VALIDATE(method <= static_cast<std::uint8_t>(QueryRecord::Method::kRayCastAll),
+                   "Unknown recorded method.");
+  record->method = static_cast<QueryRecord::Method>(method);
+  record->start = std::chrono::nanoseconds(start);
+  record->duration = std::chrono::nanoseconds(duration);
+  record->overlapping_type = (flags & kHasOverlappingType)
+                                 ? std::make_optional(static_cast<maliput::math::OverlappingType>(overlapping_type))
+                                 : std::nullopt;
+  record->has_predicate = (flags & kHasPredicate) != 0;
+  record->region = std::nullopt;
+  if (flags & kHasRegion) {
+    double values[10];
+    for (double& value : values) {
+      if (!Read(is, &value)) {
+        return false;
+      }
+    }
+    record->region = QueryRecord::Box{{values[0], values[1], values[2]},
+                                      {values[3], values[4], values[5]},
+                                      maliput::math::RollPitchYaw(values[6], values[7], values[8]),
+                                      values[9]};
+  }
+  if (!Read(is, &record->object_ids) || !Read(is, &record->result_ids)) {
+    return false;
+  }
+  if (version_1) {
+    record->parameters.clear();
+    record->predicate_ids.clear();
+    return true;
+  }
+  return Read(is, &record->parameters) && Read(is, &record->predicate_ids);
+}
+
+// @returns The ids of @p elements, which are Objects or Lanes.
+template <typename T>
+std::vector<std::string> ToIds(const std::vector<T*>& elements) {
+  std::vector<std::string> ids;
+  ids.reserve(elements.size());
+  for (const T* element : elements) {
+    ids.push_back(element->id().string());
+  }
+  return ids;
+}
+
+std::vector<std::string> ToIds(const std::vector<std::pair<api::Object<Vector3>*, api::Object<Vector3>*>>& pairs) {
+  std::vector<std::string> ids;
+  ids.reserve(2 * pairs.size());
+  for (const auto& pair : pairs) {
+    ids.push_back(pair.first->id().string());
+    ids.push_back(pair.second->id().string());
+  }
+  return ids;
+}
+
+// @returns The predicate @p record was called with, which makes true the objects it made true when it was recorded, or
+// an empty function when the call had no predicate.
+std::function<bool(const api::Object<Vector3>*)> MakePredicate(const QueryRecord& record) {
+  if (!record.has_predicate) {
+    return {};
+  }
+  const auto ids = std::make_shared<const std::unordered_set<std::string>>(record.predicate_ids.begin(),
+                                                                           record.predicate_ids.end());
+  return [ids](const api::Object<Vector3>* object) { return ids->count(object->id().string()) != 0; };
+}
+
+// Number of parameters of a recorded api::Ray: its origin, direction and maximum range.
+constexpr std::size_t kNumRayParameters{7};
+// Number of parameters of a recorded api::Frustum::Plane: its normal and offset.
+constexpr std::size_t kNumPlaneParameters{4};
+
+// @returns The api::Ray recorded in @p parameters from @p index.
+api::Ray<Vector3> ToRay(const std::vector<double>& parameters, std::size_t index) {
+  return {Vector3(parameters[index], parameters[index + 1], parameters[index + 2]),
+          Vector3(parameters[index + 3], parameters[index + 4], parameters[index + 5]), parameters[index + 6]};
+}
+
+// A replayable call. It returns the ids of the results and sets the latency of the call.
+using ReplayCall = std::function<std::vector<std::string>(std::chrono::nanoseconds*)>;
+
+// Times @p call and stores its latency in @p duration.
+template <typename Call>
+auto Time(Call&& call, std::chrono::nanoseconds* duration) {
+  const auto start = std::chrono::steady_clock::now();
+  auto result = call();
+  *duration = std::chrono::steady_clock::now() - start;
+  return result;
+}
+
+// @returns The call @p record describes, or nullptr when it cannot be replayed.
+ReplayCall MakeReplayCall(const QueryRecord& record, const api::ObjectBook<Vector3>* object_book,
+                          const api::ObjectQuery* object_query) {
+  // Object arguments of ObjectQuery methods. They are left empty when any of them is unknown.
+  std::vector<const api::Object<Vector3>*> objects;
+  for (const std::string& object_id : record.object_ids) {
+    objects.push_back(object_book->FindById(api::Object<Vector3>::Id(object_id)));
+  }
+  if (std::find(objects.begin(), objects.end(), nullptr) != objects.end()) {
+    objects.clear();
+  }
+  switch (record.method) {
+    case QueryRecord::Method::kObjects:
+      return [object_book](std::chrono::nanoseconds* duration) {
+        const auto objects = Time([object_book]() { return object_book->objects(); }, duration);
+        std::vector<std::string> ids;
+        for (const auto& id_object : objects) {
+          ids.push_back(id_object.first.string());
+        }
+        return ids;
+      };
+    case QueryRecord::Method::kFindById: {
+      if (record.object_ids.size() != 1) {
+        return nullptr;
+      }
+      const api::Object<Vector3>::Id id(record.object_ids.front());
+      return [object_book, id](std::chrono::nanoseconds* duration) {
+        const api::Object<Vector3>* object = Time([object_book, &id]() { return object_book->FindById(id); }, duration);
+        return object == nullptr ? std::vector<std::string>{} : std::vector<std::string>{object->id().string()};
+      };
+    }
+    case QueryRecord::Method::kFindByPredicate: {
+      if (!record.has_predicate) {
+        return nullptr;
+      }
+      const std::function<bool(const api::Object<Vector3>*)> predicate = MakePredicate(record);
+      return [object_book, predicate](std::chrono::nanoseconds* duration) {
+        return ToIds(Time([&]() { return object_book->FindByPredicate(predicate); }, duration));
+      };
+    }
+    case QueryRecord::Method::kFindNearest: {
+      if (record.parameters.size() != 4) {
+        return nullptr;
+      }
+      const Vector3 position(record.parameters[0], record.parameters[1], record.parameters[2]);
+      const int k = static_cast<int>(record.parameters[3]);
+      const std::function<bool(const api::Object<Vector3>*)> predicate = MakePredicate(record);
+      return [object_book, position, k, predicate](std::chrono::nanoseconds* duration) {
+        return ToIds(Time([&]() { return object_book->FindNearest(position, k, predicate); }, duration));
+      };
+    }
+    case QueryRecord::Method::kFindWithinDistance: {
+      if (record.parameters.size() != 4) {
+        return nullptr;
+      }
+      const Vector3 position(record.parameters[0], record.parameters[1], record.parameters[2]);
+      const double radius = record.parameters[3];
+      return [object_book, position, radius](std::chrono::nanoseconds* duration) {
+        return ToIds(Time([&]() { return object_book->FindWithinDistance(position, radius); }, duration));
+      };
+    }
+    case QueryRecord::Method::kRayCast: {
+      if (record.parameters.empty() || record.parameters.size() % kNumRayParameters != 0) {
+        return nullptr;
+      }
+      std::vector<api::Ray<Vector3>> rays;
+      for (std::size_t i = 0; i < record.parameters.size(); i += kNumRayParameters) {
+        rays.push_back(ToRay(record.parameters, i));
+      }
+      return [object_book, rays](std::chrono::nanoseconds* duration) {
+        const std::vector<std::optional<api::RayHit<Vector3>>> hits =
+            Time([&]() { return object_book->RayCast(rays); }, duration);
+        std::vector<std::string> ids;
+        for (const std::optional<api::RayHit<Vector3>>& hit : hits) {
+          if (hit.has_value()) {
+            ids.push_back(hit->object->id().string());
+          }
+        }
+        return ids;
+      };
+    }
+    case QueryRecord::Method::kRayCastAll: {
+      if (record.parameters.size() != kNumRayParameters) {
+        return nullptr;
+      }
+      const api::Ray<Vector3> ray = ToRay(record.parameters, 0);
+      return [object_book, ray](std::chrono::nanoseconds* duration) {
+        const std::vector<api::RayHit<Vector3>> hits =
+            Time([&]() { return object_book->RayCastAll(ray.origin, ray.direction, ray.max_range); }, duration);
+        std::vector<std::string> ids;
+        for (const api::RayHit<Vector3>& hit : hits) {
+          ids.push_back(hit.object->id().string());
+        }
+        return ids;
+      };
+    }
+    case QueryRecord::Method::kFindInFrustum: {
+      if (record.parameters.size() % kNumPlaneParameters != 0) {
+        return nullptr;
+      }
+      api::Frustum<Vector3> frustum;
+      for (std::size_t i = 0; i < record.parameters.size(); i += kNumPlaneParameters) {
+        frustum.planes.push_back({Vector3(record.parameters[i], record.parameters[i + 1], record.parameters[i + 2]),
+                                  record.parameters[i + 3]});
+      }
+      return [object_book, frustum](std::chrono::nanoseconds* duration) {
+        return ToIds(Time([&]() { return object_book->FindInFrustum(frustum); }, duration));
+      };
+    }
+    case QueryRecord::Method::kFindObjectsOnLane: {
+      if (object_query == nullptr || record.object_ids.size() != 1 || record.parameters.size() != 2) {
+        return nullptr;
+      }
+      const maliput::api::LaneId lane_id(record.object_ids.front());
+      const maliput::api::SRange s_range(record.parameters[0], record.parameters[1]);
+      return [object_query, lane_id, s_range](std::chrono::nanoseconds* duration) {
+        return ToIds(Time([&]() { return object_query->FindObjectsOnLane(lane_id, s_range); }, duration));
+      };
+    }
+    case QueryRecord::Method::kFindObjectsAlongRoute: {
+      if (object_query == nullptr || record.parameters.size() != 2 * record.object_ids.size() + 1) {
+        return nullptr;
+      }
+      std::vector<maliput::api::LaneSRange> ranges;
+      for (std::size_t i = 0; i < record.object_ids.size(); ++i) {
+        ranges.emplace_back(maliput::api::LaneId(record.object_ids[i]),
+                            maliput::api::SRange(record.parameters[2 * i], record.parameters[2 * i + 1]));
+      }
+      const maliput::api::LaneSRoute route(ranges);
+      const double lateral_margin = record.parameters.back();
+      return [object_query, route, lateral_margin](std::chrono::nanoseconds* duration) {
+        const std::vector<api::ObjectAlongRoute> objects =
+            Time([&]() { return object_query->FindObjectsAlongRoute(route, lateral_margin); }, duration);
+        std::vector<std::string> ids;
+        for (const api::ObjectAlongRoute& object : objects) {
+          ids.push_back(object.object->id().string());
+        }
+        return ids;
+      };
+    }
+    case QueryRecord::Method::kFindNextObjectsAhead: {
+      if (object_query == nullptr || object_query->road_network() == nullptr || record.object_ids.size() != 1 ||
+          record.parameters.size() != 4) {
+        return nullptr;
+      }
+      const maliput::api::Lane* lane = object_query->road_network()->road_geometry()->ById().GetLane(
+          maliput::api::LaneId(record.object_ids.front()));
+      if (lane == nullptr) {
+        return nullptr;
+      }
+      const maliput::api::RoadPosition road_position(
+          lane, maliput::api::LanePosition(record.parameters[0], record.parameters[1], record.parameters[2]));
+      const double horizon = record.parameters[3];
+      const std::function<bool(const api::Object<Vector3>*)> predicate = MakePredicate(record);
+      return [object_query, road_position, horizon, predicate](std::chrono::nanoseconds* duration) {
+        const std::vector<api::ObjectAhead> objects =
+            Time([&]() { return object_query->FindNextObjectsAhead(road_position, horizon, predicate); }, duration);
+        std::vector<std::string> ids;
+        for (const api::ObjectAhead& object : objects) {
+          ids.push_back(object.object->id().string());
+        }
+        return ids;
+      };
+    }
+    case QueryRecord::Method::kFindFreeGaps: {
+      if (object_query == nullptr || record.object_ids.size() != 1 || record.parameters.size() != 3) {
+        return nullptr;
+      }
+      const maliput::api::LaneId lane_id(record.object_ids.front());
+      const maliput::api::SRange s_range(record.parameters[0], record.parameters[1]);
+      const double min_gap_length = record.parameters[2];
+      // Gaps are not recorded, so only the latency is compared.
+      return [object_query, lane_id, s_range, min_gap_length](std::chrono::nanoseconds* duration) {
+        Time([&]() { return object_query->FindFreeGaps(lane_id, s_range, min_gap_length); }, duration);
+        return std::vector<std::string>{};
+      };
+    }
+    case QueryRecord::Method::kRouteAvoiding: {
+      // The third id is the cache key of the RouteAvoidance.
+      if (object_query == nullptr || record.object_ids.size() != 3 || record.parameters.size() != 2 ||
+          !record.has_predicate) {
+        return nullptr;
+      }
+      const api::Object<Vector3>* origin = object_book->FindById(api::Object<Vector3>::Id(record.object_ids[0]));
+      const api::Object<Vector3>* target = object_book->FindById(api::Object<Vector3>::Id(record.object_ids[1]));
+      if (origin == nullptr || target == nullptr) {
+        return nullptr;
+      }
+      api::RouteAvoidance avoidance;
+      avoidance.predicate = MakePredicate(record);
+      avoidance.cache_key = record.object_ids[2];
+      avoidance.mode = static_cast<api::RouteAvoidance::Mode>(record.parameters[0]);
+      avoidance.penalty = record.parameters[1];
+      return [object_query, origin, target, avoidance](std::chrono::nanoseconds* duration) {
+        const std::optional<const maliput::api::LaneSRoute> route =
+            Time([&]() { return object_query->Route(origin, target, avoidance); }, duration);
+        std::vector<std::string> ids;
+        if (route.has_value()) {
+          for (const maliput::api::LaneSRange& range : route->ranges()) {
+            ids.push_back(range.lane_id().string());
+          }
+        }
+        return ids;
+      };
+    }
+    case QueryRecord::Method::kFindNearestNeighbors: {
+      if (object_query == nullptr || objects.size() != record.object_ids.size() || record.parameters.size() != 2) {
+        return nullptr;
+      }
+      const int k = static_cast<int>(record.parameters[0]);
+      const double max_distance = record.parameters[1];
+      return [object_query, objects, k, max_distance](std::chrono::nanoseconds* duration) {
+        const std::vector<std::vector<api::ObjectDistance>> neighbors =
+            Time([&]() { return object_query->FindNearestNeighbors(objects, k, max_distance); }, duration);
+        std::vector<std::string> ids;
+        for (const std::vector<api::ObjectDistance>& object_neighbors : neighbors) {
+          for (const api::ObjectDistance& neighbor : object_neighbors) {
+            ids.push_back(neighbor.object->id().string());
+          }
+        }
+        return ids;
+      };
+    }
+    case QueryRecord::Method::kFindLaneClearances: {
+      if (object_query == nullptr || objects.size() != record.object_ids.size() || record.parameters.size() != 1) {
+        return nullptr;
+      }
+      const double max_distance = record.parameters[0];
+      return [object_query, objects, max_distance](std::chrono::nanoseconds* duration) {
+        const std::vector<std::vector<api::LaneClearance>> clearances =
+            Time([&]() { return object_query->FindLaneClearances(objects, max_distance); }, duration);
+        std::vector<std::string> ids;
+        for (const std::vector<api::LaneClearance>& object_clearances : clearances) {
+          for (const api::LaneClearance& clearance : object_clearances) {
+            ids.push_back(clearance.lane->id().string());
+          }
+        }
+        return ids;
+      };
+    }
+    case QueryRecord::Method::kFindAllOverlappingPairs:
+      return [object_book](std::chrono::nanoseconds* duration) {
+        return ToIds(Time([object_book]() { return object_book->FindAllOverlappingPairs(); }, duration));
+      };
+    case QueryRecord::Method::kFindOverlappingIn: {
+      if (!record.region.has_value() || !record.overlapping_type.has_value()) {
+        return nullptr;
+      }
+      const auto region = std::make_shared<maliput::math::BoundingBox>(
+          record.region->position, record.region->box_size, record.region->rotation, record.region->tolerance);
+      const maliput::math::OverlappingType overlapping_type = record.overlapping_type.value();
+      return [object_book, region, overlapping_type](std::chrono::nanoseconds* duration) {
+        return ToIds(Time([&]() { return object_book->FindOverlappingIn(*region, overlapping_type); }, duration));
+      };
+    }
+    case QueryRecord::Method::kFindOverlappingLanesIn: {
+      if (object_query == nullptr || objects.size() != 1) {
+        return nullptr;
+      }
+      const api::Object<Vector3>* object = objects.front();
+      const std::optional<maliput::math::OverlappingType> overlapping_type = record.overlapping_type;
+      return [object_query, object, overlapping_type](std::chrono::nanoseconds* duration) {
+        return ToIds(Time(
+            [&]() {
+              return overlapping_type.has_value()
+                         ? object_query->FindOverlappingLanesIn(object, overlapping_type.value())
+                         : object_query->FindOverlappingLanesIn(object);
+            },
+            duration));
+      };
+    }
+    case QueryRecord::Method::kRoute: {
+      if (object_query == nullptr || objects.size() != 2) {
+        return nullptr;
+      }
+      const api::Object<Vector3>* origin = objects[0];
+      const api::Object<Vector3>* target = objects[1];
+      return [object_query, origin, target](std::chrono::nanoseconds* duration) {
+        const std::optional<const maliput::api::LaneSRoute> route =
+            Time([&]() { return object_query->Route(origin, target); }, duration);
+        std::vector<std::string> ids;
+        if (route.has_value()) {
+          for (const maliput::api::LaneSRange& range : route->ranges()) {
+            ids.push_back(range.lane_id().string());
+          }
+        }
+        return ids;
+      };
+    }
+  }
+  return nullptr;
+}
+
+// @returns The nearest-rank percentiles of @p latencies.
+std::map<int, std::chrono::nanoseconds> ComputePercentiles(std::vector<std::chrono::nanoseconds> latencies) {
+  std::map<int, std::chrono::nanoseconds> percentiles;
+  if (latencies.empty()) {
+    return percentiles;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  for (const int percentile : ReplayReport::kPercentiles) {
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(percentile / 100. * latencies.size()));
+    percentiles.emplace(percentile, latencies[std::clamp<std::size_t>(rank, 1, latencies.size()) - 1]);
+  }
+  return percentiles;
+}
+
+}  // namespace
+
+QueryRecorder::QueryRecorder(const std::string& filename)
+    : start_(std::chrono::steady_clock::now()), file_(filename, std::ios::binary | std::ios::trunc) {
+  MALIPUT_VALIDATE(file_.is_open(), "Unable to open " + filename);
+  file_.write(kMagic, sizeof(kMagic));
+}
+
+void QueryRecorder::Record(const QueryRecord& record) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Write(static_cast<std::uint8_t>(record.method), &file_);
+  Write(static_cast<std::int64_t>(record.start.count()), &file_);
+  Write(static_cast<std::int64_t>(record.duration.count()), &file_);
+  const std::uint8_t flags = (record.region.has_value() ? kHasRegion : 0) |
+                             (record.overlapping_type.has_value() ? kHasOverlappingType : 0) |
+                             (record.has_predicate ? kHasPredicate : 0);
+  Write(flags, &file_);
+  Write(static_cast<std::uint8_t>(record.overlapping_type.value_or(maliput::math::OverlappingType::kDisjointed)),
+        &file_);
+  if (record.region.has_value()) {
+    const QueryRecord::Box& region = record.region.value();
+    for (const double value :
+         {region.position.x(), region.position.y(), region.position.z(), region.box_size.x(), region.box_size.y(),
+          region.box_size.z(), region.rotation.roll_angle(), region.rotation.pitch_angle(),
+          region.rotation.yaw_angle(), region.tolerance}) {
+      Write(value, &file_);
+    }
+  }
+  Write(record.object_ids, &file_);
+  Write(record.result_ids, &file_);
+  Write(record.parameters, &file_);
+  Write(record.predicate_ids, &file_);
+}
+
+std::chrono::nanoseconds QueryRecorder::Now() const { return std::chrono::steady_clock::now() - start_; }
+
+void QueryRecorder::Flush() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  file_.flush();
+}
+
+std::vector<QueryRecord> ReadQueryRecording(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  MALIPUT_VALIDATE(file.is_open(), "Unable to open " + filename);
+  char magic[sizeof(kMagic)];
+  MALIPUT_VALIDATE(file.read(magic, sizeof(magic)) && (std::memcmp(magic, kMagic, sizeof(kMagic)) == 0 ||
+                                                       std::memcmp(magic, kMagicVersion1, sizeof(kMagic)) == 0),
+                   filename + " is not a query recording.");
+  const bool version_1 = std::memcmp(magic, kMagicVersion1, sizeof(kMagic)) == 0;
+  std::vector<QueryRecord> records;
+  QueryRecord record;
+  while (Read(&file, version_1, &record)) {
+    records.push_back(record);
+  }
+  return records;
+}
+
+ReplayReport Replay(const std::vector<QueryRecord>& records, const api::ObjectBook<Vector3>* object_book,
+                    const api::ObjectQuery* object_query, int repetitions) {
+  MALIPUT_THROW_UNLESS(object_book != nullptr);
+  MALIPUT_THROW_UNLESS(repetitions > 0);
+  ReplayReport report;
+  std::map<QueryRecord::Method, std::vector<std::chrono::nanoseconds>> recorded_latencies;
+  std::map<QueryRecord::Method, std::vector<std::chrono::nanoseconds>> replayed_latencies;
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    const QueryRecord& record = records[i];
+    const ReplayCall call = MakeReplayCall(record, object_book, object_query);
+    if (call == nullptr) {
+      ++report.num_skipped;
+      continue;
+    }
+    std::vector<std::string> result_ids;
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+      std::chrono::nanoseconds duration{};
+      std::vector<std::string> ids = call(&duration);
+      replayed_latencies[record.method].push_back(duration);
+      if (repetition == 0) {
+        result_ids = std::move(ids);
+      }
+    }
+    recorded_latencies[record.method].push_back(record.duration);
+
+    ReplayReport::MethodReport& method_report = report.methods[record.method];
+    ++method_report.num_calls;
+    std::vector<std::string> recorded_ids = record.result_ids;
+    std::sort(recorded_ids.begin(), recorded_ids.end());
+    std::sort(result_ids.begin(), result_ids.end());
+    if (recorded_ids != result_ids) {
+      ++method_report.num_mismatches;
+      report.mismatched_records.push_back(i);
+    }
+  }
+  for (auto& method_report : report.methods) {
+    method_report.second.recorded_latencies = ComputePercentiles(recorded_latencies[method_report.first]);
+    method_report.second.replayed_latencies = ComputePercentiles(replayed_latencies[method_report.first]);
+  }
+  return report;
+}
+
+std::string to_string(QueryRecord::Method method) {
+  switch (method) {
+    case QueryRecord::Method::kObjects:
+      return "objects";
+    case QueryRecord::Method::kFindById:
+      return "FindById";
+    case QueryRecord::Method::kFindByPredicate:
+      return "FindByPredicate";
+    case QueryRecord::Method::kFindOverlappingIn:
+      return "FindOverlappingIn";
+    case QueryRecord::Method::kFindOverlappingLanesIn:
+      return "FindOverlappingLanesIn";
+    case QueryRecord::Method::kRoute:
+      return "Route";
+    case QueryRecord::Method::kFindNearest:
+      return "FindNearest";
+    case QueryRecord::Method::kFindWithinDistance:
+      return "FindWithinDistance";
+    case QueryRecord::Method::kRayCast:
+      return "RayCast";
+    case QueryRecord::Method::kFindInFrustum:
+      return "FindInFrustum";
+    case QueryRecord::Method::kFindObjectsOnLane:
+      return "FindObjectsOnLane";
+    case QueryRecord::Method::kFindObjectsAlongRoute:
+      return "FindObjectsAlongRoute";
+    case QueryRecord::Method::kFindNextObjectsAhead:
+      return "FindNextObjectsAhead";
+    case QueryRecord::Method::kFindFreeGaps:
+      return "FindFreeGaps";
+    case QueryRecord::Method::kRouteAvoiding:
+      return "RouteAvoiding";
+    case QueryRecord::Method::kFindAllOverlappingPairs:
+      return "FindAllOverlappingPairs";
+    case QueryRecord::Method::kFindNearestNeighbors:
+      return "FindNearestNeighbors";
+    case QueryRecord::Method::kFindLaneClearances:
+      return "FindLaneClearances";
+    case QueryRecord::Method::kRayCastAll:
+      return "RayCastAll";
+  }
+  MALIPUT_THROW_MESSAGE("Unknown method.");
+}
+
+}  // namespace object
+}  // namespace maliput
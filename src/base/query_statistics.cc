@@ -0,0 +1,240 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/query_statistics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace object {
+namespace {
+
+constexpr std::size_t kNumMethods{static_cast<std::size_t>(QueryRecord::Method::kRayCastAll) + 1};
+
+using MethodStatistics = QueryStatistics::MethodStatistics;
+using Totals = std::array<MethodStatistics, kNumMethods>;
+
+std::atomic<bool> statistics_enabled{false};
+
+// Counters of one method. They are only written by the thread that owns them, and read by any thread.
+struct MethodCounters {
+  std::atomic<std::uint64_t> num_calls{0};
+  std::atomic<std::uint64_t> total_latency{0};
+  std::array<std::atomic<std::uint64_t>, QueryStatistics::kNumLatencyBuckets> latency_histogram{};
+  std::atomic<std::uint64_t> candidates_examined{0};
+  std::atomic<std::uint64_t> results_returned{0};
+  std::atomic<std::uint64_t> cache_hits{0};
+  std::atomic<std::uint64_t> cache_misses{0};
+};
+
+using ThreadCounters = std::array<MethodCounters, kNumMethods>;
+
+// Increments a counter that has a single writer, which avoids a read-modify-write operation.
+void Increment(std::atomic<std::uint64_t>* counter, std::uint64_t value) {
+  counter->store(counter->load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+std::size_t ComputeLatencyBucket(std::uint64_t latency) {
+  std::size_t bucket{0};
+  while ((latency >>= 1) != 0 && bucket + 1 < QueryStatistics::kNumLatencyBuckets) {
+    ++bucket;
+  }
+  return bucket;
+}
+
+// Adds @p counters to @p totals.
+void Accumulate(const ThreadCounters& counters, Totals* totals) {
+  for (std::size_t i = 0; i < kNumMethods; ++i) {
+    const MethodCounters& source = counters[i];
+    MethodStatistics& target = (*totals)[i];
+    const auto load = [](const std::atomic<std::uint64_t>& counter) { return counter.load(std::memory_order_relaxed); };
+    target.num_calls += load(source.num_calls);
+    target.total_latency += std::chrono::nanoseconds(load(source.total_latency));
+    for (std::size_t bucket = 0; bucket < QueryStatistics::kNumLatencyBuckets; ++bucket) {
+      target.latency_histogram[bucket] += load(source.latency_histogram[bucket]);
+    }
+    target.candidates_examined += load(source.candidates_examined);
+    target.results_returned += load(source.results_returned);
+    target.cache_hits += load(source.cache_hits);
+    target.cache_misses += load(source.cache_misses);
+  }
+}
+
+// Subtracts @p baseline from @p totals.
+void Subtract(const Totals& baseline, Totals* totals) {
+  for (std::size_t i = 0; i < kNumMethods; ++i) {
+    MethodStatistics& target = (*totals)[i];
+    target.num_calls -= baseline[i].num_calls;
+    target.total_latency -= baseline[i].total_latency;
+    for (std::size_t bucket = 0; bucket < QueryStatistics::kNumLatencyBuckets; ++bucket) {
+      target.latency_histogram[bucket] -= baseline[i].latency_histogram[bucket];
+    }
+    target.candidates_examined -= baseline[i].candidates_examined;
+    target.results_returned -= baseline[i].results_returned;
+    target.cache_hits -= baseline[i].cache_hits;
+    target.cache_misses -= baseline[i].cache_misses;
+  }
+}
+
+// Keeps track of the counters of every thread.
+class Registry {
+ public:
+  // The registry is never destroyed, so threads can retire their counters during static destruction.
+  static Registry& Get() {
+    static Registry* registry = new Registry();
+    return *registry;
+  }
+
+  void Register(const ThreadCounters* counters) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_counters_.push_back(counters);
+  }
+
+  // Folds @p counters into the ones of the exited threads.
+  void Retire(const ThreadCounters* counters) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Accumulate(*counters, &retired_totals_);
+    live_counters_.erase(std::find(live_counters_.begin(), live_counters_.end(), counters));
+  }
+
+  Totals ComputeTotals() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Totals totals = ComputeTotalsUnlocked();
+    Subtract(baseline_, &totals);
+    return totals;
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    baseline_ = ComputeTotalsUnlocked();
+  }
+
+ private:
+  Registry() = default;
+
+  Totals ComputeTotalsUnlocked() const {
+    Totals totals = retired_totals_;
+    for (const ThreadCounters* counters : live_counters_) {
+      Accumulate(*counters, &totals);
+    }
+    return totals;
+  }
+
+  mutable std::mutex mutex_;
+  std::vector<const ThreadCounters*> live_counters_;
+  Totals retired_totals_{};
+  // Totals at the time of the last Reset() call.
+  Totals baseline_{};
+};
+
+// Registers the counters of a thread on construction and retires them when the thread exits.
+struct ThreadCountersHolder {
+  ThreadCountersHolder() { Registry::Get().Register(&counters); }
+  ~ThreadCountersHolder() { Registry::Get().Retire(&counters); }
+  ThreadCounters counters{};
+};
+
+ThreadCounters& GetThreadCounters() {
+  thread_local ThreadCountersHolder holder;
+  return holder.counters;
+}
+
+}  // namespace
+
+double QueryStatistics::MethodStatistics::cache_hit_ratio() const {
+  const std::uint64_t lookups = cache_hits + cache_misses;
+  return lookups == 0 ? 0. : static_cast<double>(cache_hits) / static_cast<double>(lookups);
+}
+
+std::chrono::nanoseconds QueryStatistics::MethodStatistics::latency_percentile(double percentile) const {
+  MALIPUT_THROW_UNLESS(percentile >= 0. && percentile <= 100.);
+  if (num_calls == 0) {
+    return std::chrono::nanoseconds{0};
+  }
+  const std::uint64_t rank =
+      std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(percentile / 100. * num_calls)));
+  std::uint64_t count{0};
+  std::size_t bucket{0};
+  for (; bucket + 1 < kNumLatencyBuckets; ++bucket) {
+    count += latency_histogram[bucket];
+    if (count >= rank) {
+      break;
+    }
+  }
+  return std::chrono::nanoseconds(std::uint64_t{1} << (bucket + 1));
+}
+
+void EnableQueryStatistics(bool enable) { statistics_enabled.store(enable, std::memory_order_relaxed); }
+
+bool QueryStatisticsEnabled() { return statistics_enabled.load(std::memory_order_relaxed); }
+
+QueryStatistics GetQueryStatistics() {
+  const Totals totals = Registry::Get().ComputeTotals();
+  QueryStatistics statistics;
+  for (std::size_t i = 0; i < kNumMethods; ++i) {
+    if (totals[i].num_calls != 0) {
+      statistics.methods.emplace(static_cast<QueryRecord::Method>(i), totals[i]);
+    }
+  }
+  return statistics;
+}
+
+void ResetQueryStatistics() { Registry::Get().Reset(); }
+
+QueryStatisticsScope::QueryStatisticsScope(QueryRecord::Method method)
+    : method_(method), enabled_(QueryStatisticsEnabled()) {
+  if (enabled_) {
+    start_ = std::chrono::steady_clock::now();
+  }
+}
+
+QueryStatisticsScope::~QueryStatisticsScope() {
+  if (!enabled_) {
+    return;
+  }
+  const std::uint64_t latency =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count();
+  MethodCounters& counters = GetThreadCounters()[static_cast<std::size_t>(method_)];
+  Increment(&counters.num_calls, 1);
+  Increment(&counters.total_latency, latency);
+  Increment(&counters.latency_histogram[ComputeLatencyBucket(latency)], 1);
+  Increment(&counters.candidates_examined, candidates_);
+  Increment(&counters.results_returned, results_);
+  Increment(&counters.cache_hits, cache_hits_);
+  Increment(&counters.cache_misses, cache_misses_);
+}
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,277 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/recording_object_book.h"
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_box.h>
+
+namespace maliput {
+namespace object {
+namespace {
+
+using maliput::math::Vector3;
+
+std::vector<std::string> ToIds(const std::vector<api::Object<Vector3>*>& objects) {
+  std::vector<std::string> ids;
+  ids.reserve(objects.size());
+  for (const api::Object<Vector3>* object : objects) {
+    ids.push_back(object->id().string());
+  }
+  return ids;
+}
+
+// @returns The origin, direction and maximum range of @p ray, as they are recorded.
+std::vector<double> ToParameters(const api::Ray<Vector3>& ray) {
+  return {ray.origin.x(),    ray.origin.y(),    ray.origin.z(), ray.direction.x(),
+          ray.direction.y(), ray.direction.z(), ray.max_range};
+}
+
+// @returns The ids of the Objects of @p object_book that make @p predicate true, or nothing when @p predicate is empty.
+std::vector<std::string> EvaluatePredicate(const api::ObjectBook<Vector3>* object_book,
+                                           const std::function<bool(const api::Object<Vector3>*)>& predicate) {
+  std::vector<std::string> ids;
+  if (predicate) {
+    for (const auto& id_object : object_book->objects()) {
+      if (predicate(id_object.second)) {
+        ids.push_back(id_object.first.string());
+      }
+    }
+  }
+  return ids;
+}
+
+}  // namespace
+
+RecordingObjectBook::RecordingObjectBook(const api::ObjectBook<Vector3>* object_book, QueryRecorder* recorder,
+                                         double region_tolerance)
+    : object_book_(object_book), recorder_(recorder), region_tolerance_(region_tolerance) {
+  MALIPUT_THROW_UNLESS(object_book_ != nullptr);
+  MALIPUT_THROW_UNLESS(recorder_ != nullptr);
+  MALIPUT_THROW_UNLESS(region_tolerance_ >= 0.);
+}
+
+std::unordered_map<api::Object<Vector3>::Id, api::Object<Vector3>*> RecordingObjectBook::do_objects() const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kObjects;
+  record.start = recorder_->Now();
+  auto objects = object_book_->objects();
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids.reserve(objects.size());
+  for (const auto& id_object : objects) {
+    record.result_ids.push_back(id_object.first.string());
+  }
+  recorder_->Record(record);
+  return objects;
+}
+
+api::Object<Vector3>* RecordingObjectBook::DoFindById(const api::Object<Vector3>::Id& object_id) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindById;
+  record.object_ids.push_back(object_id.string());
+  record.start = recorder_->Now();
+  api::Object<Vector3>* object = object_book_->FindById(object_id);
+  record.duration = recorder_->Now() - record.start;
+  if (object != nullptr) {
+    record.result_ids.push_back(object->id().string());
+  }
+  recorder_->Record(record);
+  return object;
+}
+
+std::vector<api::Object<Vector3>*> RecordingObjectBook::DoFindByPredicate(
+    std::function<bool(const api::Object<Vector3>*)> predicate) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindByPredicate;
+  record.has_predicate = static_cast<bool>(predicate);
+  record.start = recorder_->Now();
+  std::vector<api::Object<Vector3>*> objects = object_book_->FindByPredicate(std::move(predicate));
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(objects);
+  // The predicate makes true exactly the results.
+  record.predicate_ids = record.result_ids;
+  recorder_->Record(record);
+  return objects;
+}
+
+std::vector<api::Object<Vector3>*> RecordingObjectBook::DoFindOverlappingIn(
+    const maliput::math::BoundingRegion<Vector3>& region,
+    const maliput::math::OverlappingType& overlapping_type) const {
+  QueryRecord record = MakeFindOverlappingInRecord(region, overlapping_type);
+  record.start = recorder_->Now();
+  std::vector<api::Object<Vector3>*> objects = object_book_->FindOverlappingIn(region, overlapping_type);
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(objects);
+  recorder_->Record(record);
+  return objects;
+}
+
+std::vector<api::Object<Vector3>*> RecordingObjectBook::DoFindNearest(
+    const Vector3& position, int k, const std::function<bool(const api::Object<Vector3>*)>& predicate) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindNearest;
+  record.parameters = {position.x(), position.y(), position.z(), static_cast<double>(k)};
+  record.has_predicate = static_cast<bool>(predicate);
+  record.predicate_ids = EvaluatePredicate(object_book_, predicate);
+  record.start = recorder_->Now();
+  std::vector<api::Object<Vector3>*> objects = object_book_->FindNearest(position, k, predicate);
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(objects);
+  recorder_->Record(record);
+  return objects;
+}
+
+std::vector<api::Object<Vector3>*> RecordingObjectBook::DoFindWithinDistance(const Vector3& position,
+                                                                             double radius) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindWithinDistance;
+  record.parameters = {position.x(), position.y(), position.z(), radius};
+  record.start = recorder_->Now();
+  std::vector<api::Object<Vector3>*> objects = object_book_->FindWithinDistance(position, radius);
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(objects);
+  recorder_->Record(record);
+  return objects;
+}
+
+std::vector<api::RayHit<Vector3>> RecordingObjectBook::DoRayCastAll(const api::Ray<Vector3>& ray) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kRayCastAll;
+  record.parameters = ToParameters(ray);
+  record.start = recorder_->Now();
+  std::vector<api::RayHit<Vector3>> hits = object_book_->RayCastAll(ray.origin, ray.direction, ray.max_range);
+  record.duration = recorder_->Now() - record.start;
+  for (const api::RayHit<Vector3>& hit : hits) {
+    record.result_ids.push_back(hit.object->id().string());
+  }
+  recorder_->Record(record);
+  return hits;
+}
+
+void RecordingObjectBook::DoRayCast(const std::vector<api::Ray<Vector3>>& rays,
+                                    std::vector<std::optional<api::RayHit<Vector3>>>* hits) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kRayCast;
+  for (const api::Ray<Vector3>& ray : rays) {
+    const std::vector<double> parameters = ToParameters(ray);
+    record.parameters.insert(record.parameters.end(), parameters.begin(), parameters.end());
+  }
+  record.start = recorder_->Now();
+  *hits = object_book_->RayCast(rays);
+  record.duration = recorder_->Now() - record.start;
+  for (const std::optional<api::RayHit<Vector3>>& hit : *hits) {
+    if (hit.has_value()) {
+      record.result_ids.push_back(hit->object->id().string());
+    }
+  }
+  recorder_->Record(record);
+}
+
+std::vector<api::Object<Vector3>*> RecordingObjectBook::DoFindInFrustum(const api::Frustum<Vector3>& frustum) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindInFrustum;
+  for (const api::Frustum<Vector3>::Plane& plane : frustum.planes) {
+    record.parameters.insert(record.parameters.end(),
+                             {plane.normal.x(), plane.normal.y(), plane.normal.z(), plane.offset});
+  }
+  record.start = recorder_->Now();
+  std::vector<api::Object<Vector3>*> objects = object_book_->FindInFrustum(frustum);
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(objects);
+  recorder_->Record(record);
+  return objects;
+}
+
+std::vector<std::pair<api::Object<Vector3>*, api::Object<Vector3>*>> RecordingObjectBook::DoFindAllOverlappingPairs()
+    const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindAllOverlappingPairs;
+  record.start = recorder_->Now();
+  std::vector<std::pair<api::Object<Vector3>*, api::Object<Vector3>*>> pairs = object_book_->FindAllOverlappingPairs();
+  record.duration = recorder_->Now() - record.start;
+  for (const auto& pair : pairs) {
+    record.result_ids.push_back(pair.first->id().string());
+    record.result_ids.push_back(pair.second->id().string());
+  }
+  recorder_->Record(record);
+  return pairs;
+}
+
+void RecordingObjectBook::DoVisitByPredicate(const std::function<bool(const api::Object<Vector3>*)>& predicate,
+                                             const std::function<void(api::Object<Vector3>*)>& visitor) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindByPredicate;
+  record.has_predicate = static_cast<bool>(predicate);
+  std::vector<api::Object<Vector3>*> objects;
+  record.start = recorder_->Now();
+  object_book_->FindByPredicate(predicate, &objects);
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(objects);
+  record.predicate_ids = record.result_ids;
+  recorder_->Record(record);
+  for (api::Object<Vector3>* object : objects) {
+    visitor(object);
+  }
+}
+
+void RecordingObjectBook::DoVisitOverlappingIn(const maliput::math::BoundingRegion<Vector3>& region,
+                                               const maliput::math::OverlappingType& overlapping_type,
+                                               const std::function<void(api::Object<Vector3>*)>& visitor) const {
+  QueryRecord record = MakeFindOverlappingInRecord(region, overlapping_type);
+  std::vector<api::Object<Vector3>*> objects;
+  record.start = recorder_->Now();
+  object_book_->FindOverlappingIn(region, overlapping_type, &objects);
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(objects);
+  recorder_->Record(record);
+  for (api::Object<Vector3>* object : objects) {
+    visitor(object);
+  }
+}
+
+QueryRecord RecordingObjectBook::MakeFindOverlappingInRecord(const maliput::math::BoundingRegion<Vector3>& region,
+                                                             const maliput::math::OverlappingType& overlapping_type)
+    const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindOverlappingIn;
+  const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&region);
+  if (bounding_box != nullptr) {
+    record.region = QueryRecord::Box{bounding_box->position(), bounding_box->box_size(),
+                                     bounding_box->get_orientation(), region_tolerance_};
+  }
+  record.overlapping_type = overlapping_type;
+  return record;
+}
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,267 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/recording_object_query.h"
+
+#include <string>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace object {
+namespace {
+
+using maliput::math::Vector3;
+
+std::vector<std::string> ToIds(const std::vector<const maliput::api::Lane*>& lanes) {
+  std::vector<std::string> ids;
+  ids.reserve(lanes.size());
+  for (const maliput::api::Lane* lane : lanes) {
+    ids.push_back(lane->id().string());
+  }
+  return ids;
+}
+
+// @returns The ids of the Objects of @p object_book that make @p predicate true, or nothing when @p predicate is empty
+// or @p object_book is nullptr.
+std::vector<std::string> EvaluatePredicate(const api::ObjectBook<Vector3>* object_book,
+                                           const std::function<bool(const api::Object<Vector3>*)>& predicate) {
+  std::vector<std::string> ids;
+  if (predicate && object_book != nullptr) {
+    for (const auto& id_object : object_book->objects()) {
+      if (predicate(id_object.second)) {
+        ids.push_back(id_object.first.string());
+      }
+    }
+  }
+  return ids;
+}
+
+}  // namespace
+
+RecordingObjectQuery::RecordingObjectQuery(const api::ObjectQuery* object_query, QueryRecorder* recorder)
+    : object_query_(object_query), recorder_(recorder) {
+  MALIPUT_THROW_UNLESS(object_query_ != nullptr);
+  MALIPUT_THROW_UNLESS(recorder_ != nullptr);
+}
+
+std::vector<const maliput::api::Lane*> RecordingObjectQuery::DoFindOverlappingLanesIn(
+    const api::Object<Vector3>* object) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindOverlappingLanesIn;
+  record.object_ids.push_back(object->id().string());
+  record.start = recorder_->Now();
+  std::vector<const maliput::api::Lane*> lanes = object_query_->FindOverlappingLanesIn(object);
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(lanes);
+  recorder_->Record(record);
+  return lanes;
+}
+
+std::vector<const maliput::api::Lane*> RecordingObjectQuery::DoFindOverlappingLanesIn(
+    const api::Object<Vector3>* object, const maliput::math::OverlappingType& overlapping_type) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindOverlappingLanesIn;
+  record.object_ids.push_back(object->id().string());
+  record.overlapping_type = overlapping_type;
+  record.start = recorder_->Now();
+  std::vector<const maliput::api::Lane*> lanes = object_query_->FindOverlappingLanesIn(object, overlapping_type);
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(lanes);
+  recorder_->Record(record);
+  return lanes;
+}
+
+void RecordingObjectQuery::DoVisitOverlappingLanesIn(
+    const api::Object<Vector3>* object, const maliput::math::OverlappingType& overlapping_type,
+    const std::function<void(const maliput::api::Lane*)>& visitor) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindOverlappingLanesIn;
+  record.object_ids.push_back(object->id().string());
+  record.overlapping_type = overlapping_type;
+  std::vector<const maliput::api::Lane*> lanes;
+  record.start = recorder_->Now();
+  object_query_->FindOverlappingLanesIn(object, overlapping_type, &lanes);
+  record.duration = recorder_->Now() - record.start;
+  record.result_ids = ToIds(lanes);
+  recorder_->Record(record);
+  for (const maliput::api::Lane* lane : lanes) {
+    visitor(lane);
+  }
+}
+
+std::optional<const maliput::api::LaneSRoute> RecordingObjectQuery::DoRoute(const api::Object<Vector3>* origin,
+                                                                          const api::Object<Vector3>* target) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kRoute;
+  record.object_ids = {origin->id().string(), target->id().string()};
+  record.start = recorder_->Now();
+  std::optional<const maliput::api::LaneSRoute> route = object_query_->Route(origin, target);
+  record.duration = recorder_->Now() - record.start;
+  if (route.has_value()) {
+    for (const maliput::api::LaneSRange& range : route->ranges()) {
+      record.result_ids.push_back(range.lane_id().string());
+    }
+  }
+  recorder_->Record(record);
+  return route;
+}
+
+std::optional<const maliput::api::LaneSRoute> RecordingObjectQuery::DoRoute(
+    const api::Object<Vector3>* origin, const api::Object<Vector3>* target,
+    const api::RouteAvoidance& avoidance) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kRouteAvoiding;
+  record.object_ids = {origin->id().string(), target->id().string(), avoidance.cache_key};
+  record.parameters = {static_cast<double>(avoidance.mode), avoidance.penalty};
+  record.has_predicate = static_cast<bool>(avoidance.predicate);
+  record.predicate_ids = EvaluatePredicate(object_query_->object_book(), avoidance.predicate);
+  record.start = recorder_->Now();
+  std::optional<const maliput::api::LaneSRoute> route = object_query_->Route(origin, target, avoidance);
+  record.duration = recorder_->Now() - record.start;
+  if (route.has_value()) {
+    for (const maliput::api::LaneSRange& range : route->ranges()) {
+      record.result_ids.push_back(range.lane_id().string());
+    }
+  }
+  recorder_->Record(record);
+  return route;
+}
+
+std::vector<const api::Object<Vector3>*> RecordingObjectQuery::DoFindObjectsOnLane(
+    const maliput::api::LaneId& lane_id, const maliput::api::SRange& s_range) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindObjectsOnLane;
+  record.object_ids.push_back(lane_id.string());
+  record.parameters = {s_range.s0(), s_range.s1()};
+  record.start = recorder_->Now();
+  std::vector<const api::Object<Vector3>*> objects = object_query_->FindObjectsOnLane(lane_id, s_range);
+  record.duration = recorder_->Now() - record.start;
+  for (const api::Object<Vector3>* object : objects) {
+    record.result_ids.push_back(object->id().string());
+  }
+  recorder_->Record(record);
+  return objects;
+}
+
+std::vector<maliput::api::SRange> RecordingObjectQuery::DoFindFreeGaps(const maliput::api::LaneId& lane_id,
+                                                                       const maliput::api::SRange& s_range,
+                                                                       double min_gap_length) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindFreeGaps;
+  record.object_ids.push_back(lane_id.string());
+  record.parameters = {s_range.s0(), s_range.s1(), min_gap_length};
+  record.start = recorder_->Now();
+  std::vector<maliput::api::SRange> gaps = object_query_->FindFreeGaps(lane_id, s_range, min_gap_length);
+  record.duration = recorder_->Now() - record.start;
+  recorder_->Record(record);
+  return gaps;
+}
+
+std::vector<api::ObjectAlongRoute> RecordingObjectQuery::DoFindObjectsAlongRoute(const maliput::api::LaneSRoute& route,
+                                                                                double lateral_margin) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindObjectsAlongRoute;
+  for (const maliput::api::LaneSRange& range : route.ranges()) {
+    record.object_ids.push_back(range.lane_id().string());
+    record.parameters.insert(record.parameters.end(), {range.s_range().s0(), range.s_range().s1()});
+  }
+  record.parameters.push_back(lateral_margin);
+  record.start = recorder_->Now();
+  std::vector<api::ObjectAlongRoute> objects = object_query_->FindObjectsAlongRoute(route, lateral_margin);
+  record.duration = recorder_->Now() - record.start;
+  for (const api::ObjectAlongRoute& object : objects) {
+    record.result_ids.push_back(object.object->id().string());
+  }
+  recorder_->Record(record);
+  return objects;
+}
+
+std::vector<api::ObjectAhead> RecordingObjectQuery::DoFindNextObjectsAhead(
+    const maliput::api::RoadPosition& road_position, double horizon,
+    const std::function<bool(const api::Object<Vector3>*)>& predicate) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindNextObjectsAhead;
+  record.object_ids.push_back(road_position.lane->id().string());
+  record.parameters = {road_position.pos.s(), road_position.pos.r(), road_position.pos.h(), horizon};
+  record.has_predicate = static_cast<bool>(predicate);
+  record.predicate_ids = EvaluatePredicate(object_query_->object_book(), predicate);
+  record.start = recorder_->Now();
+  std::vector<api::ObjectAhead> objects = object_query_->FindNextObjectsAhead(road_position, horizon, predicate);
+  record.duration = recorder_->Now() - record.start;
+  for (const api::ObjectAhead& object : objects) {
+    record.result_ids.push_back(object.object->id().string());
+  }
+  recorder_->Record(record);
+  return objects;
+}
+
+std::vector<std::vector<api::ObjectDistance>> RecordingObjectQuery::DoFindNearestNeighbors(
+    const std::vector<const api::Object<Vector3>*>& objects, int k, double max_distance) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindNearestNeighbors;
+  for (const api::Object<Vector3>* object : objects) {
+    record.object_ids.push_back(object->id().string());
+  }
+  record.parameters = {static_cast<double>(k), max_distance};
+  record.start = recorder_->Now();
+  std::vector<std::vector<api::ObjectDistance>> neighbors =
+      object_query_->FindNearestNeighbors(objects, k, max_distance);
+  record.duration = recorder_->Now() - record.start;
+  for (const std::vector<api::ObjectDistance>& object_neighbors : neighbors) {
+    for (const api::ObjectDistance& neighbor : object_neighbors) {
+      record.result_ids.push_back(neighbor.object->id().string());
+    }
+  }
+  recorder_->Record(record);
+  return neighbors;
+}
+
+std::vector<std::vector<api::LaneClearance>> RecordingObjectQuery::DoFindLaneClearances(
+    const std::vector<const api::Object<Vector3>*>& objects, double max_distance) const {
+  QueryRecord record;
+  record.method = QueryRecord::Method::kFindLaneClearances;
+  for (const api::Object<Vector3>* object : objects) {
+    record.object_ids.push_back(object->id().string());
+  }
+  record.parameters = {max_distance};
+  record.start = recorder_->Now();
+  std::vector<std::vector<api::LaneClearance>> clearances = object_query_->FindLaneClearances(objects, max_distance);
+  record.duration = recorder_->Now() - record.start;
+  for (const std::vector<api::LaneClearance>& object_clearances : clearances) {
+    for (const api::LaneClearance& clearance : object_clearances) {
+      record.result_ids.push_back(clearance.lane->id().string());
+    }
+  }
+  recorder_->Record(record);
+  return clearances;
+}
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,684 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/shared_memory_object_book.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <queue>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+
+namespace maliput {
+namespace object {
+namespace {
+
+using maliput::math::Vector3;
+using Object = api::Object<Vector3>;
+
+// File layout. Every section is an array of records aligned to kAlignment bytes and is located by its offset from the
+// beginning of the file, which makes the file position independent.
+
+constexpr std::array<char, 8> kMagic{'M', 'O', 'B', 'J', 'B', 'O', 'O', 'K'};
+constexpr std::uint32_t kVersion{1};
+constexpr std::size_t kAlignment{8};
+// See BoundingVolumeHierarchy.
+constexpr std::size_t kMaxStackSize{128};
+
+// Location of an array of records.
+struct SectionRecord {
+  std::uint64_t offset;
+  std::uint64_t count;
+};
+
+// A string of the strings section.
+struct StringRecord {
+  std::uint64_t offset;
+  std::uint64_t size;
+};
+
+struct ObjectRecord {
+  StringRecord id;
+  double position[3];
+  // Roll, pitch and yaw angles.
+  double rotation[3];
+  double box_size[3];
+  // Properties are `properties[first_property, first_property + num_properties)`.
+  std::uint64_t first_property;
+  std::uint64_t num_properties;
+};
+
+struct PropertyRecord {
+  StringRecord key;
+  StringRecord value;
+};
+
+struct BoxRecord {
+  double min_corner[3];
+  double max_corner[3];
+};
+
+// See BoundingVolumeHierarchy::Node. Children of inner nodes are stored before their parent.
+struct NodeRecord {
+  BoxRecord box;
+  std::int32_t first;
+  std::int32_t count;
+  std::int32_t is_leaf;
+  std::int32_t padding;
+};
+
+struct EntryRecord {
+  BoxRecord box;
+  std::uint64_t object_index;
+};
+
+struct Header {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t padding;
+  // Size of the whole file.
+  std::uint64_t size;
+  double tolerance;
+  // ObjectRecords, sorted by id.
+  SectionRecord objects;
+  SectionRecord properties;
+  // NodeRecords. The root is the last node.
+  SectionRecord nodes;
+  SectionRecord entries;
+  // Characters of the interned strings.
+  SectionRecord strings;
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && std::is_trivially_copyable_v<ObjectRecord> &&
+                  std::is_trivially_copyable_v<PropertyRecord> && std::is_trivially_copyable_v<NodeRecord> &&
+                  std::is_trivially_copyable_v<EntryRecord>,
+              "Records must be trivially copyable to be shared.");
+
+// Stores every distinct string once.
+class StringTable {
+ public:
+  StringRecord Intern(const std::string& value) {
+    const auto it = records_.find(value);
+    if (it != records_.end()) {
+      return it->second;
+    }
+    const StringRecord record{characters_.size(), value.size()};
+    characters_.insert(characters_.end(), value.begin(), value.end());
+    records_.emplace(value, record);
+    return record;
+  }
+
+  const std::vector<char>& characters() const { return characters_; }
+
+ private:
+  std::vector<char> characters_;
+  std::unordered_map<std::string, StringRecord> records_;
+};
+
+// Appends @p records to @p buffer at the next aligned offset.
+template <typename Record>
+SectionRecord Append(const std::vector<Record>& records, std::vector<char>* buffer) {
+  buffer->resize((buffer->size() + kAlignment - 1) / kAlignment * kAlignment);
+  const SectionRecord section{buffer->size(), records.size()};
+  const char* begin = reinterpret_cast<const char*>(records.data());
+  buffer->insert(buffer->end(), begin, begin + records.size() * sizeof(Record));
+  return section;
+}
+
+void CopyTo(const Vector3& vector, double* out) {
+  for (std::size_t i = 0; i < 3; ++i) {
+    out[i] = vector[i];
+  }
+}
+
+Vector3 ToVector3(const double* values) { return Vector3(values[0], values[1], values[2]); }
+
+BoxRecord ToBoxRecord(const AxisAlignedBox<Vector3>& box) {
+  BoxRecord record{};
+  CopyTo(box.min_corner, record.min_corner);
+  CopyTo(box.max_corner, record.max_corner);
+  return record;
+}
+
+AxisAlignedBox<Vector3> ToAxisAlignedBox(const BoxRecord& record) {
+  return {ToVector3(record.min_corner), ToVector3(record.max_corner)};
+}
+
+bool Overlaps(const BoxRecord& record, const AxisAlignedBox<Vector3>& box) {
+  for (std::size_t i = 0; i < 3; ++i) {
+    if (record.max_corner[i] < box.min_corner[i] || box.max_corner[i] < record.min_corner[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+double SquaredDistance(const BoxRecord& record, const Vector3& point) {
+  double squared_distance{0.};
+  for (std::size_t i = 0; i < 3; ++i) {
+    const double excess = std::max({record.min_corner[i] - point[i], point[i] - record.max_corner[i], 0.});
+    squared_distance += excess * excess;
+  }
+  return squared_distance;
+}
+
+maliput::math::BoundingBox ToBoundingBox(const ObjectRecord& record, double tolerance) {
+  return maliput::math::BoundingBox(
+      ToVector3(record.position), ToVector3(record.box_size),
+      maliput::math::RollPitchYaw(record.rotation[0], record.rotation[1], record.rotation[2]), tolerance);
+}
+
+const Header& GetHeader(const void* data) { return *static_cast<const Header*>(data); }
+
+template <typename Record>
+const Record* GetRecords(const void* data, const SectionRecord& section) {
+  return reinterpret_cast<const Record*>(static_cast<const char*>(data) + section.offset);
+}
+
+std::string_view GetString(const void* data, const StringRecord& record) {
+  return std::string_view(GetRecords<char>(data, GetHeader(data).strings) + record.offset, record.size);
+}
+
+// Bounds checks every offset of the file so that a truncated or corrupted file is rejected at attach time.
+bool IsValid(const void* data, std::size_t size) {
+  if (size < sizeof(Header)) {
+    return false;
+  }
+  const Header& header = GetHeader(data);
+  if (header.magic != kMagic || header.version != kVersion || header.size != size || !(header.tolerance >= 0.)) {
+    return false;
+  }
+  const auto is_valid_section = [size](const SectionRecord& section, std::size_t record_size) {
+    return section.offset % kAlignment == 0 && section.offset <= size &&
+           section.count <= (size - section.offset) / record_size;
+  };
+  if (!is_valid_section(header.objects, sizeof(ObjectRecord)) ||
+      !is_valid_section(header.properties, sizeof(PropertyRecord)) ||
+      !is_valid_section(header.nodes, sizeof(NodeRecord)) || !is_valid_section(header.entries, sizeof(EntryRecord)) ||
+      !is_valid_section(header.strings, sizeof(char))) {
+    return false;
+  }
+  const auto is_valid_string = [&header](const StringRecord& record) {
+    return record.offset <= header.strings.count && record.size <= header.strings.count - record.offset;
+  };
+  const auto is_valid_range = [](std::int64_t first, std::int64_t count, std::uint64_t end) {
+    return first >= 0 && count >= 0 && static_cast<std::uint64_t>(first + count) <= end;
+  };
+
+  const ObjectRecord* objects = GetRecords<ObjectRecord>(data, header.objects);
+  for (std::uint64_t i = 0; i < header.objects.count; ++i) {
+    if (!is_valid_string(objects[i].id) || objects[i].first_property > header.properties.count ||
+        objects[i].num_properties > header.properties.count - objects[i].first_property) {
+      return false;
+    }
+  }
+  const PropertyRecord* properties = GetRecords<PropertyRecord>(data, header.properties);
+  for (std::uint64_t i = 0; i < header.properties.count; ++i) {
+    if (!is_valid_string(properties[i].key) || !is_valid_string(properties[i].value)) {
+      return false;
+    }
+  }
+  const NodeRecord* nodes = GetRecords<NodeRecord>(data, header.nodes);
+  for (std::uint64_t i = 0; i < header.nodes.count; ++i) {
+    // Requiring children to precede their parent rules out cycles.
+    if (nodes[i].is_leaf ? !is_valid_range(nodes[i].first, nodes[i].count, header.entries.count)
+                         : !is_valid_range(nodes[i].first, nodes[i].count, i)) {
+      return false;
+    }
+  }
+  const EntryRecord* entries = GetRecords<EntryRecord>(data, header.entries);
+  for (std::uint64_t i = 0; i < header.entries.count; ++i) {
+    if (entries[i].object_index >= header.objects.count) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Calls @p visitor with the index of every object whose box in the packed hierarchy passes @p box_test. Nodes whose
+// box does not pass @p box_test are pruned.
+template <typename BoxTest, typename Visitor>
+void VisitCandidates(const void* data, const BoxTest& box_test, const Visitor& visitor) {
+  const Header& header = GetHeader(data);
+  const NodeRecord* nodes = GetRecords<NodeRecord>(data, header.nodes);
+  const EntryRecord* entries = GetRecords<EntryRecord>(data, header.entries);
+  if (header.nodes.count == 0 || !box_test(nodes[header.nodes.count - 1].box)) {
+    return;
+  }
+  std::array<std::int32_t, kMaxStackSize> stack;
+  std::size_t stack_size{0};
+  stack[stack_size++] = static_cast<std::int32_t>(header.nodes.count - 1);
+  while (stack_size > 0) {
+    const NodeRecord& node = nodes[stack[--stack_size]];
+    for (std::int32_t i = node.first; i < node.first + node.count; ++i) {
+      if (node.is_leaf) {
+        if (box_test(entries[i].box)) {
+          visitor(entries[i].object_index);
+        }
+      } else if (box_test(nodes[i].box)) {
+        MALIPUT_THROW_UNLESS(stack_size < kMaxStackSize);
+        stack[stack_size++] = i;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+void SharedMemoryObjectBook::Write(const std::string& filename, const api::ObjectBook<Vector3>& object_book,
+                                   double tolerance) {
+  MALIPUT_THROW_UNLESS(tolerance >= 0.);
+  std::vector<Object*> objects;
+  for (const auto& id_object : object_book.objects()) {
+    objects.push_back(id_object.second);
+  }
+  std::sort(objects.begin(), objects.end(),
+            [](const Object* lhs, const Object* rhs) { return lhs->id().string() < rhs->id().string(); });
+
+  StringTable strings;
+  std::vector<ObjectRecord> object_records;
+  std::vector<PropertyRecord> property_records;
+  std::unordered_map<const Object*, std::uint64_t> object_indices;
+  object_records.reserve(objects.size());
+  for (const Object* object : objects) {
+    const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&object->bounding_region());
+    MALIPUT_VALIDATE(bounding_box != nullptr, "Object " + object->id().string() + " is not bounded by a box.");
+    ObjectRecord record{};
+    record.id = strings.Intern(object->id().string());
+    CopyTo(bounding_box->position(), record.position);
+    record.rotation[0] = bounding_box->get_orientation().roll_angle();
+    record.rotation[1] = bounding_box->get_orientation().pitch_angle();
+    record.rotation[2] = bounding_box->get_orientation().yaw_angle();
+    CopyTo(bounding_box->box_size(), record.box_size);
+    record.first_property = property_records.size();
+    record.num_properties = object->get_properties().size();
+    for (const auto& property : object->get_properties()) {
+      property_records.push_back({strings.Intern(property.first), strings.Intern(property.second)});
+    }
+    object_indices.emplace(object, object_records.size());
+    object_records.push_back(record);
+  }
+
+  const BoundingVolumeHierarchy<Vector3> index(objects, tolerance);
+  std::vector<NodeRecord> node_records;
+  node_records.reserve(index.nodes().size());
+  for (const auto& node : index.nodes()) {
+    node_records.push_back({ToBoxRecord(node.box), node.first, node.count, node.is_leaf ? 1 : 0, 0});
+  }
+  std::vector<EntryRecord> entry_records;
+  entry_records.reserve(index.entries().size());
+  for (const auto& entry : index.entries()) {
+    entry_records.push_back({ToBoxRecord(entry.box), object_indices.at(entry.object)});
+  }
+
+  Header header{};
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.tolerance = tolerance;
+  std::vector<char> buffer(sizeof(Header));
+  header.objects = Append(object_records, &buffer);
+  header.properties = Append(property_records, &buffer);
+  header.nodes = Append(node_records, &buffer);
+  header.entries = Append(entry_records, &buffer);
+  header.strings = Append(strings.characters(), &buffer);
+  header.size = buffer.size();
+  std::memcpy(buffer.data(), &header, sizeof(Header));
+
+  // Writes a temporary file and renames it so that attaching processes never map a partially written file.
+  const std::string temporary_filename = filename + ".tmp." + std::to_string(::getpid());
+  {
+    std::ofstream file(temporary_filename, std::ios::binary | std::ios::trunc);
+    MALIPUT_VALIDATE(file.is_open(), "Unable to open " + temporary_filename);
+    file.write(buffer.data(), buffer.size());
+    MALIPUT_VALIDATE(file.good(), "Unable to write " + temporary_filename);
+  }
+  if (std::rename(temporary_filename.c_str(), filename.c_str()) != 0) {
+    std::remove(temporary_filename.c_str());
+    MALIPUT_THROW_MESSAGE("Unable to write " + filename + ": " + std::strerror(errno));
+  }
+}
+
+SharedMemoryObjectBook::SharedMemoryObjectBook(const std::string& filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  MALIPUT_VALIDATE(fd >= 0, "Unable to open " + filename + ": " + std::strerror(errno));
+  struct stat file_stat {};
+  if (::fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    ::close(fd);
+    MALIPUT_THROW_MESSAGE(filename + " is not a valid object book.");
+  }
+  size_ = static_cast<std::size_t>(file_stat.st_size);
+  void* data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  MALIPUT_VALIDATE(data != MAP_FAILED, "Unable to map " + filename + ": " + std::strerror(errno));
+  if (!IsValid(data, size_)) {
+    ::munmap(data, size_);
+    MALIPUT_THROW_MESSAGE(filename + " is not a valid object book.");
+  }
+  data_ = data;
+  num_objects_ = GetHeader(data_).objects.count;
+  materialized_objects_.resize(num_objects_);
+}
+
+SharedMemoryObjectBook::~SharedMemoryObjectBook() { ::munmap(data_, size_); }
+
+Object* SharedMemoryObjectBook::GetObject(std::size_t index, QueryStatisticsScope* statistics) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::unique_ptr<Object>& object = materialized_objects_[index];
+  statistics->AddCacheLookup(object != nullptr);
+  if (object == nullptr) {
+    const Header& header = GetHeader(data_);
+    const ObjectRecord& record = GetRecords<ObjectRecord>(data_, header.objects)[index];
+    const PropertyRecord* property_records = GetRecords<PropertyRecord>(data_, header.properties);
+    std::map<std::string, std::string> properties;
+    for (std::uint64_t i = record.first_property; i < record.first_property + record.num_properties; ++i) {
+      properties.emplace(GetString(data_, property_records[i].key), GetString(data_, property_records[i].value));
+    }
+    object = std::make_unique<Object>(
+        Object::Id(std::string(GetString(data_, record.id))), properties,
+        std::make_unique<maliput::math::BoundingBox>(
+            ToVector3(record.position), ToVector3(record.box_size),
+            maliput::math::RollPitchYaw(record.rotation[0], record.rotation[1], record.rotation[2]), header.tolerance));
+  }
+  return object.get();
+}
+
+MemoryUsageReport SharedMemoryObjectBook::MemoryUsage() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  MemoryUsageReport report;
+  report.mapped = size_;
+  report.containers = sizeof(*this) + materialized_objects_.capacity() * sizeof(std::unique_ptr<Object>);
+  for (const auto& object : materialized_objects_) {
+    if (object != nullptr) {
+      report += EstimateMemoryUsage(*object);
+    }
+  }
+  return report;
+}
+
+std::unordered_map<Object::Id, Object*> SharedMemoryObjectBook::do_objects() const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kObjects);
+  std::unordered_map<Object::Id, Object*> objects;
+  objects.reserve(num_objects_);
+  for (std::size_t i = 0; i < num_objects_; ++i) {
+    Object* object = GetObject(i, &statistics);
+    objects.emplace(object->id(), object);
+  }
+  statistics.SetResults(objects.size());
+  return objects;
+}
+
+Object* SharedMemoryObjectBook::DoFindById(const Object::Id& object_id) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindById);
+  const ObjectRecord* begin = GetRecords<ObjectRecord>(data_, GetHeader(data_).objects);
+  const ObjectRecord* end = begin + num_objects_;
+  const std::string_view id = object_id.string();
+  const ObjectRecord* it = std::lower_bound(begin, end, id, [this](const ObjectRecord& record, std::string_view value) {
+    return GetString(data_, record.id) < value;
+  });
+  if (it == end || GetString(data_, it->id) != id) {
+    return nullptr;
+  }
+  statistics.SetResults(1);
+  return GetObject(it - begin, &statistics);
+}
+
+std::vector<Object*> SharedMemoryObjectBook::DoFindByPredicate(std::function<bool(const Object*)> predicate) const {
+  std::vector<Object*> result;
+  DoVisitByPredicate(predicate, [&result](Object* object) { result.push_back(object); });
+  return result;
+}
+
+std::vector<Object*> SharedMemoryObjectBook::DoFindOverlappingIn(
+    const maliput::math::BoundingRegion<Vector3>& region,
+    const maliput::math::OverlappingType& overlapping_type) const {
+  std::vector<Object*> result;
+  DoVisitOverlappingIn(region, overlapping_type, [&result](Object* object) { result.push_back(object); });
+  return result;
+}
+
+void SharedMemoryObjectBook::DoVisitByPredicate(const std::function<bool(const Object*)>& predicate,
+                                                const std::function<void(Object*)>& visitor) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindByPredicate);
+  std::size_t num_results{0};
+  for (std::size_t i = 0; i < num_objects_; ++i) {
+    Object* object = GetObject(i, &statistics);
+    if (predicate(object)) {
+      ++num_results;
+      visitor(object);
+    }
+  }
+  statistics.AddCandidates(num_objects_);
+  statistics.SetResults(num_results);
+}
+
+void SharedMemoryObjectBook::DoVisitOverlappingIn(const maliput::math::BoundingRegion<Vector3>& region,
+                                                  const maliput::math::OverlappingType& overlapping_type,
+                                                  const std::function<void(Object*)>& visitor) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindOverlappingIn);
+  std::size_t num_results{0};
+  const auto check_overlapping = [this, &region, &overlapping_type, &visitor, &statistics,
+                                  &num_results](std::size_t index) {
+    statistics.AddCandidates(1);
+    Object* object = GetObject(index, &statistics);
+    if ((object->bounding_region().Overlaps(region) & overlapping_type) == overlapping_type) {
+      ++num_results;
+      visitor(object);
+    }
+  };
+  const Header& header = GetHeader(data_);
+  // Objects that are disjointed from the region cannot be pruned by the index.
+  const std::optional<AxisAlignedBox<Vector3>> region_box =
+      overlapping_type != maliput::math::OverlappingType::kDisjointed
+          ? ComputeAxisAlignedBox(region, header.tolerance)
+          : std::nullopt;
+  if (region_box.has_value()) {
+    const auto overlaps = [&region_box](const BoxRecord& box) { return Overlaps(box, region_box.value()); };
+    VisitCandidates(data_, overlaps, check_overlapping);
+  } else {
+    for (std::size_t i = 0; i < num_objects_; ++i) {
+      check_overlapping(i);
+    }
+  }
+  statistics.SetResults(num_results);
+}
+
+std::vector<Object*> SharedMemoryObjectBook::DoFindNearest(const Vector3& position, int k,
+                                                           const std::function<bool(const Object*)>& predicate) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindNearest);
+  const Header& header = GetHeader(data_);
+  if (k == 0 || header.nodes.count == 0) {
+    return {};
+  }
+  const ObjectRecord* objects = GetRecords<ObjectRecord>(data_, header.objects);
+  const NodeRecord* nodes = GetRecords<NodeRecord>(data_, header.nodes);
+  const EntryRecord* entries = GetRecords<EntryRecord>(data_, header.entries);
+  NearestObjects<Vector3> nearest(k);
+  // Distances are computed from the records, so only the objects that may be kept are materialized.
+  const auto offer = [this, objects, &header, &position, &predicate, &nearest, &statistics](std::size_t index) {
+    statistics.AddCandidates(1);
+    const double distance = api::ComputeDistance<Vector3>(ToBoundingBox(objects[index], header.tolerance), position);
+    if (distance > nearest.max_distance()) {
+      return;
+    }
+    Object* object = GetObject(index, &statistics);
+    if (!predicate || predicate(object)) {
+      nearest.Offer(object, distance);
+    }
+  };
+
+  // Best-first traversal of the packed hierarchy. See BoundingVolumeHierarchy::VisitNearest().
+  struct Pending {
+    double squared_distance;
+    std::int32_t index;
+    bool is_entry;
+  };
+  const auto is_farther = [](const Pending& lhs, const Pending& rhs) {
+    return lhs.squared_distance > rhs.squared_distance;
+  };
+  std::priority_queue<Pending, std::vector<Pending>, decltype(is_farther)> queue(is_farther);
+  const auto root = static_cast<std::int32_t>(header.nodes.count - 1);
+  queue.push({SquaredDistance(nodes[root].box, position), root, false});
+  while (!queue.empty()) {
+    const Pending pending = queue.top();
+    queue.pop();
+    // The remaining objects cannot be closer than the farthest object kept.
+    if (std::sqrt(pending.squared_distance) > nearest.max_distance()) {
+      break;
+    }
+    if (pending.is_entry) {
+      offer(entries[pending.index].object_index);
+      continue;
+    }
+    const NodeRecord& node = nodes[pending.index];
+    for (std::int32_t i = node.first; i < node.first + node.count; ++i) {
+      queue.push({SquaredDistance(node.is_leaf ? entries[i].box : nodes[i].box, position), i, node.is_leaf != 0});
+    }
+  }
+  std::vector<Object*> result = nearest.Sorted();
+  statistics.SetResults(result.size());
+  return result;
+}
+
+std::vector<Object*> SharedMemoryObjectBook::DoFindWithinDistance(const Vector3& position, double radius) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindWithinDistance);
+  const Header& header = GetHeader(data_);
+  const ObjectRecord* objects = GetRecords<ObjectRecord>(data_, header.objects);
+  NearestObjects<Vector3> within(std::numeric_limits<int>::max());
+  const auto offer = [this, objects, &header, &position, radius, &within, &statistics](std::size_t index) {
+    statistics.AddCandidates(1);
+    const double distance = api::ComputeDistance<Vector3>(ToBoundingBox(objects[index], header.tolerance), position);
+    if (distance <= radius) {
+      within.Offer(GetObject(index, &statistics), distance);
+    }
+  };
+  const AxisAlignedBox<Vector3> box = AxisAlignedBox<Vector3>{position, position}.Inflate(radius);
+  VisitCandidates(data_, [&box](const BoxRecord& record) { return Overlaps(record, box); }, offer);
+  std::vector<Object*> result = within.Sorted();
+  statistics.SetResults(result.size());
+  return result;
+}
+
+std::vector<api::RayHit<Vector3>> SharedMemoryObjectBook::DoRayCastAll(const api::Ray<Vector3>& ray) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kRayCastAll);
+  const Header& header = GetHeader(data_);
+  const ObjectRecord* objects = GetRecords<ObjectRecord>(data_, header.objects);
+  const Vector3 inverse_direction = ComputeInverseDirection(ray.direction);
+  NearestObjects<Vector3> hits(std::numeric_limits<int>::max());
+  const auto is_hit = [&ray, &inverse_direction](const BoxRecord& box) {
+    return ToAxisAlignedBox(box).IntersectRay(ray.origin, inverse_direction, ray.max_range).has_value();
+  };
+  const auto offer = [this, objects, &header, &ray, &hits, &statistics](std::size_t index) {
+    statistics.AddCandidates(1);
+    const std::optional<double> distance =
+        api::ComputeRayIntersection<Vector3>(ToBoundingBox(objects[index], header.tolerance), ray);
+    if (distance.has_value()) {
+      hits.Offer(GetObject(index, &statistics), distance.value());
+    }
+  };
+  VisitCandidates(data_, is_hit, offer);
+  std::vector<api::RayHit<Vector3>> result;
+  for (const auto& distance_object : hits.SortedWithDistances()) {
+    result.push_back({distance_object.second, distance_object.first});
+  }
+  statistics.SetResults(result.size());
+  return result;
+}
+
+void SharedMemoryObjectBook::DoRayCast(const std::vector<api::Ray<Vector3>>& rays,
+                                       std::vector<std::optional<api::RayHit<Vector3>>>* hits) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kRayCast);
+  const Header& header = GetHeader(data_);
+  const ObjectRecord* objects = GetRecords<ObjectRecord>(data_, header.objects);
+  std::size_t num_results{0};
+  for (std::size_t i = 0; i < rays.size(); ++i) {
+    const api::Ray<Vector3>& ray = rays[i];
+    const Vector3 inverse_direction = ComputeInverseDirection(ray.direction);
+    std::optional<api::RayHit<Vector3>>& hit = (*hits)[i];
+    // The range shrinks to the closest hit found so far, which prunes farther candidates.
+    double range{ray.max_range};
+    const auto is_hit = [&ray, &inverse_direction, &range](const BoxRecord& box) {
+      return ToAxisAlignedBox(box).IntersectRay(ray.origin, inverse_direction, range).has_value();
+    };
+    const auto offer = [this, objects, &header, &ray, &range, &hit, &statistics](std::size_t index) {
+      statistics.AddCandidates(1);
+      const std::optional<double> distance = api::ComputeRayIntersection<Vector3>(
+          ToBoundingBox(objects[index], header.tolerance), {ray.origin, ray.direction, range});
+      if (!distance.has_value() || (hit.has_value() && distance.value() == hit->distance &&
+                                    GetString(data_, objects[index].id) > hit->object->id().string())) {
+        return;
+      }
+      hit = api::RayHit<Vector3>{GetObject(index, &statistics), distance.value()};
+      range = distance.value();
+    };
+    VisitCandidates(data_, is_hit, offer);
+    num_results += hit.has_value() ? 1 : 0;
+  }
+  statistics.SetResults(num_results);
+}
+
+std::vector<Object*> SharedMemoryObjectBook::DoFindInFrustum(const api::Frustum<Vector3>& frustum) const {
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindInFrustum);
+  const Header& header = GetHeader(data_);
+  const ObjectRecord* objects = GetRecords<ObjectRecord>(data_, header.objects);
+  std::vector<Object*> result;
+  const auto is_inside = [&frustum](const BoxRecord& box) { return !ToAxisAlignedBox(box).IsOutside(frustum); };
+  const auto check = [this, objects, &header, &frustum, &result, &statistics](std::size_t index) {
+    statistics.AddCandidates(1);
+    if (api::OverlapsFrustum<Vector3>(ToBoundingBox(objects[index], header.tolerance), frustum)) {
+      result.push_back(GetObject(index, &statistics));
+    }
+  };
+  VisitCandidates(data_, is_inside, check);
+  statistics.SetResults(result.size());
+  return result;
+}
+
+}  // namespace object
+}  // namespace maliput
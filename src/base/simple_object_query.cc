@@ -30,11 +30,20 @@
 #include "maliput_object/base/simple_object_query.h"
 
 #include <algorithm>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <utility>
 
+#include <maliput/api/branch_point.h>
 #include <maliput/common/maliput_throw.h>
 #include <maliput/math/bounding_box.h>
 #include <maliput/routing/derive_lane_s_routes.h>
 
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+#include "maliput_object/base/query_statistics.h"
+#include "maliput_object/base/tracing.h"
+
 namespace maliput {
 namespace object {
 
@@ -45,26 +54,98 @@ SimpleObjectQuery::SimpleObjectQuery(const maliput::api::RoadNetwork* road_netwo
   MALIPUT_THROW_UNLESS(object_book != nullptr);
 }
 
+SimpleObjectQuery::SimpleObjectQuery(const maliput::api::RoadNetwork* road_network,
+                                     const api::ObjectBook<maliput::math::Vector3>* object_book,
+                                     const ObjectLaneAssociations& lane_associations)
+    : SimpleObjectQuery(road_network, object_book) {
+  const maliput::api::RoadGeometry* road_geometry = road_network_->road_geometry();
+  MALIPUT_VALIDATE(lane_associations.road_network_hash == ComputeRoadNetworkHash(road_geometry),
+                   "Lane associations were computed for a different road network.");
+  auto precomputed_lanes = std::make_shared<
+      std::unordered_map<api::Object<maliput::math::Vector3>::Id, std::vector<const maliput::api::Lane*>>>();
+  // Objects that changed since the associations were computed get their lanes computed again.
+  std::vector<const api::Object<maliput::math::Vector3>*> stale_objects;
+  for (const auto& id_footprints : lane_associations.footprints) {
+    const api::Object<maliput::math::Vector3>* object = object_book_->FindById(id_footprints.first);
+    if (object != nullptr && !AreFootprintsCurrent(lane_associations, object)) {
+      stale_objects.push_back(object);
+      continue;
+    }
+    std::vector<const maliput::api::Lane*>& lanes = (*precomputed_lanes)[id_footprints.first];
+    for (const LaneFootprint& footprint : id_footprints.second) {
+      const maliput::api::Lane* lane = road_geometry->ById().GetLane(footprint.lane_id);
+      MALIPUT_VALIDATE(lane != nullptr, "Unknown lane in lane associations: " + footprint.lane_id.string());
+      lanes.push_back(lane);
+    }
+  }
+  precomputed_lanes_ = std::move(precomputed_lanes);
+  auto lane_object_index = std::make_shared<LaneObjectIndex>(object_book_, lane_associations);
+  for (const api::Object<maliput::math::Vector3>* object : stale_objects) {
+    lane_object_index->Update(*this, object);
+  }
+  lane_object_index_ = std::move(lane_object_index);
+}
+
+SimpleObjectQuery::SimpleObjectQuery(const maliput::api::RoadNetwork* road_network,
+                                     const api::ObjectBook<maliput::math::Vector3>* object_book,
+                                     std::shared_ptr<const LaneObjectIndex> lane_object_index)
+    : SimpleObjectQuery(road_network, object_book) {
+  MALIPUT_THROW_UNLESS(lane_object_index != nullptr);
+  lane_object_index_ = std::move(lane_object_index);
+}
+
+MemoryUsageReport SimpleObjectQuery::MemoryUsage() const {
+  MemoryUsageReport report;
+  report.caches = sizeof(*this);
+  if (precomputed_lanes_ != nullptr) {
+    report.caches += EstimateHashTableSize(precomputed_lanes_->bucket_count(), precomputed_lanes_->size(),
+                                           sizeof(decltype(precomputed_lanes_)::element_type::value_type));
+    for (const auto& id_lanes : *precomputed_lanes_) {
+      report.caches +=
+          EstimateHeapSize(id_lanes.first.string()) + id_lanes.second.capacity() * sizeof(const maliput::api::Lane*);
+    }
+  }
+  if (lane_object_index_ != nullptr) {
+    report += lane_object_index_->MemoryUsage();
+  }
+  return report;
+}
+
 std::vector<const maliput::api::Lane*> SimpleObjectQuery::DoFindOverlappingLanesIn(
     const api::Object<maliput::math::Vector3>* object) const {
   MALIPUT_THROW_UNLESS(object != nullptr);
   return DoFindOverlappingLanesIn(object, maliput::math::OverlappingType::kIntersected);
 }
-std::vector<const maliput::api::Lane*> SimpleObjectQuery::DoFindOverlappingLanesIn(
-    const api::Object<maliput::math::Vector3>* object, const maliput::math::OverlappingType& overlapping_type) const {
-  MALIPUT_THROW_UNLESS(object != nullptr);
+std::vector<const maliput::api::Lane*> SimpleObjectQuery::FindIntersectedLanes(
+    const api::Object<maliput::math::Vector3>* object, QueryStatisticsScope* statistics) const {
+  if (precomputed_lanes_ != nullptr) {
+    const auto it = precomputed_lanes_->find(object->id());
+    statistics->AddCacheLookup(it != precomputed_lanes_->end());
+    if (it != precomputed_lanes_->end()) {
+      return it->second;
+    }
+  }
   std::vector<const maliput::api::Lane*> overlapping_lanes;
 
-  // TODO(#25): The following assumes vertices are available and the bounding region is a maliput::math::BoundingBox.
-  const auto bb = static_cast<const maliput::math::BoundingBox&>(object->bounding_region());
-  const auto vertices = bb.get_vertices();
+  std::vector<maliput::math::Vector3> vertices;
+  {
+    MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::VertexExtraction");
+    // TODO(#25): The following assumes vertices are available and the bounding region is a maliput::math::BoundingBox.
+    const auto bb = static_cast<const maliput::math::BoundingBox&>(object->bounding_region());
+    vertices = bb.get_vertices();
+  }
 
   for (const auto& vertex : vertices) {
     // FindRoadPosition at each vertex of the bounding box using a radius large enough to include the center of the
     // bounding box.
     const double radius = (object->position() - vertex).norm();
-    const std::vector<maliput::api::RoadPositionResult> road_position_results =
-        road_network_->road_geometry()->FindRoadPositions(maliput::api::InertialPosition::FromXyz(vertex), radius);
+    std::vector<maliput::api::RoadPositionResult> road_position_results;
+    {
+      MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::FindRoadPositions");
+      road_position_results =
+          road_network_->road_geometry()->FindRoadPositions(maliput::api::InertialPosition::FromXyz(vertex), radius);
+    }
+    statistics->AddCandidates(road_position_results.size());
     // The RoadPositionResults contain the closest points to the lanes contained in the sphere,
     // There could be lanes that even though overlap with the object, their closest point to the vertex is outside the
     // bounding region, leading to not tracking those lanes. Therefore, once the lanes located in the sphere are
@@ -76,29 +157,44 @@ std::vector<const maliput::api::Lane*> SimpleObjectQuery::DoFindOverlappingLanes
         continue;
       }
       const maliput::api::Lane* lane = road_position_result.road_position.lane;
-      const maliput::api::LanePositionResult closest_lane_position_result =
-          lane->ToLanePosition(maliput::api::InertialPosition::FromXyz(object->position()));
-      // The lane position result will contain lane position that could lay outside the lane boundary(always within the
-      // segment bounds). Therefore, the lane position is compared with the lane bounds of the lane. In case the lane
-      // position is outside the lane bounds, the lane position and nearest position are recomputed with the boundary
-      // r-coordinate.
-      maliput::api::LanePosition lane_pos = closest_lane_position_result.lane_position;
-      maliput::api::InertialPosition neareast_pos = closest_lane_position_result.nearest_position;
-      const auto lane_bounds = lane->lane_bounds(lane_pos.s());
-      if (lane_pos.r() > lane_bounds.max() || lane_pos.r() < lane_bounds.min()) {
-        lane_pos.set_r(std::clamp(lane_pos.r(), lane_bounds.min(), lane_bounds.max()));
-        neareast_pos = lane->ToInertialPosition(lane_pos);
+      maliput::api::InertialPosition neareast_pos;
+      {
+        MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::ToLanePosition");
+        const maliput::api::LanePositionResult closest_lane_position_result =
+            lane->ToLanePosition(maliput::api::InertialPosition::FromXyz(object->position()));
+        // The lane position result will contain lane position that could lay outside the lane boundary(always within
+        // the segment bounds). Therefore, the lane position is compared with the lane bounds of the lane. In case the
+        // lane position is outside the lane bounds, the lane position and nearest position are recomputed with the
+        // boundary r-coordinate.
+        maliput::api::LanePosition lane_pos = closest_lane_position_result.lane_position;
+        neareast_pos = closest_lane_position_result.nearest_position;
+        const auto lane_bounds = lane->lane_bounds(lane_pos.s());
+        if (lane_pos.r() > lane_bounds.max() || lane_pos.r() < lane_bounds.min()) {
+          lane_pos.set_r(std::clamp(lane_pos.r(), lane_bounds.min(), lane_bounds.max()));
+          neareast_pos = lane->ToInertialPosition(lane_pos);
+        }
       }
 
       // Check if the lane's closest point is within the bounding region.
+      MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::ContainmentCheck");
       if (object->bounding_region().Contains(neareast_pos.xyz())) {
         overlapping_lanes.push_back(lane);
       }
     }
   }
+  return overlapping_lanes;
+}
+
+std::vector<const maliput::api::Lane*> SimpleObjectQuery::DoFindOverlappingLanesIn(
+    const api::Object<maliput::math::Vector3>* object, const maliput::math::OverlappingType& overlapping_type) const {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::FindOverlappingLanesIn");
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindOverlappingLanesIn);
+  const std::vector<const maliput::api::Lane*> overlapping_lanes = FindIntersectedLanes(object, &statistics);
 
   switch (overlapping_type) {
     case maliput::math::OverlappingType::kIntersected: {
+      statistics.SetResults(overlapping_lanes.size());
       return overlapping_lanes;
       break;
     }
@@ -116,6 +212,7 @@ std::vector<const maliput::api::Lane*> SimpleObjectQuery::DoFindOverlappingLanes
                         disjointed_lanes.push_back(lane_id_lane.second);
                       }
                     });
+      statistics.SetResults(disjointed_lanes.size());
       return disjointed_lanes;
       break;
     }
@@ -129,18 +226,47 @@ std::vector<const maliput::api::Lane*> SimpleObjectQuery::DoFindOverlappingLanes
   }
 }
 
-std::optional<const maliput::api::LaneSRoute> SimpleObjectQuery::DoRoute(
+void SimpleObjectQuery::DoVisitOverlappingLanesIn(
+    const api::Object<maliput::math::Vector3>* object, const maliput::math::OverlappingType& overlapping_type,
+    const std::function<void(const maliput::api::Lane*)>& visitor) const {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  if (overlapping_type == maliput::math::OverlappingType::kIntersected && precomputed_lanes_ != nullptr) {
+    const auto it = precomputed_lanes_->find(object->id());
+    if (it != precomputed_lanes_->end()) {
+      QueryStatisticsScope statistics(QueryRecord::Method::kFindOverlappingLanesIn);
+      statistics.AddCacheLookup(true);
+      statistics.SetResults(it->second.size());
+      for (const maliput::api::Lane* lane : it->second) {
+        visitor(lane);
+      }
+      return;
+    }
+  }
+  for (const maliput::api::Lane* lane : DoFindOverlappingLanesIn(object, overlapping_type)) {
+    visitor(lane);
+  }
+}
+
+std::vector<maliput::api::LaneSRoute> SimpleObjectQuery::DeriveRoutes(
     const api::Object<maliput::math::Vector3>* origin, const api::Object<maliput::math::Vector3>* target) const {
   const auto origin_road_pos_result =
       road_network_->road_geometry()->ToRoadPosition(maliput::api::InertialPosition::FromXyz(origin->position()));
   const auto target_road_pos_result =
       road_network_->road_geometry()->ToRoadPosition(maliput::api::InertialPosition::FromXyz(target->position()));
-  const auto lane_s_route =
-      maliput::routing::DeriveLaneSRoutes(origin_road_pos_result.road_position, target_road_pos_result.road_position,
-                                          std::numeric_limits<double>::infinity());
+  return maliput::routing::DeriveLaneSRoutes(origin_road_pos_result.road_position, target_road_pos_result.road_position,
+                                             std::numeric_limits<double>::infinity());
+}
+
+std::optional<const maliput::api::LaneSRoute> SimpleObjectQuery::DoRoute(
+    const api::Object<maliput::math::Vector3>* origin, const api::Object<maliput::math::Vector3>* target) const {
+  MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::Route");
+  QueryStatisticsScope statistics(QueryRecord::Method::kRoute);
+  const auto lane_s_route = DeriveRoutes(origin, target);
+  statistics.AddCandidates(lane_s_route.size());
   if (lane_s_route.empty()) {
     return std::nullopt;
   }
+  statistics.SetResults(1);
   const auto min_route =
       std::min_element(lane_s_route.begin(), lane_s_route.end(),
                        [](const maliput::api::LaneSRoute& left, const maliput::api::LaneSRoute& right) {
@@ -148,6 +274,345 @@ std::optional<const maliput::api::LaneSRoute> SimpleObjectQuery::DoRoute(
                        });
   return std::make_optional(*min_route);
 }
+
+std::optional<const maliput::api::LaneSRoute> SimpleObjectQuery::DoRoute(
+    const api::Object<maliput::math::Vector3>* origin, const api::Object<maliput::math::Vector3>* target,
+    const api::RouteAvoidance& avoidance) const {
+  MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::RouteAvoiding");
+  QueryStatisticsScope statistics(QueryRecord::Method::kRouteAvoiding);
+  const std::shared_ptr<const BlockedLanes> blocked_lanes = FindBlockedLanes(avoidance, &statistics);
+  const maliput::api::RoadGeometry* road_geometry = road_network_->road_geometry();
+  const std::optional<const maliput::api::LaneSRoute> route = FindRouteAvoiding(
+      road_geometry->ToRoadPosition(maliput::api::InertialPosition::FromXyz(origin->position())).road_position,
+      road_geometry->ToRoadPosition(maliput::api::InertialPosition::FromXyz(target->position())).road_position,
+      blocked_lanes->lanes, avoidance);
+  statistics.SetResults(route.has_value() ? 1 : 0);
+  return route;
+}
+
+std::shared_ptr<const SimpleObjectQuery::BlockedLanes> SimpleObjectQuery::FindBlockedLanes(
+    const api::RouteAvoidance& avoidance, QueryStatisticsScope* statistics) const {
+  // Finding the blocking Objects is cheap compared to finding their Lanes, so it is done on every call to check that
+  // the cached entry is up to date.
+  std::vector<const api::Object<maliput::math::Vector3>*> objects;
+  object_book_->VisitByPredicate(avoidance.predicate, [&objects](const api::Object<maliput::math::Vector3>* object) {
+    objects.push_back(object);
+  });
+  if (!avoidance.cache_key.empty()) {
+    std::lock_guard<std::mutex> lock(blocked_lanes_cache_->mutex);
+    const auto it = blocked_lanes_cache_->blocked_lanes.find(avoidance.cache_key);
+    const bool is_up_to_date =
+        it != blocked_lanes_cache_->blocked_lanes.end() && it->second->objects.size() == objects.size() &&
+        std::all_of(objects.begin(), objects.end(), [&it](const api::Object<maliput::math::Vector3>* object) {
+          const auto snapshot = it->second->objects.find(object->id());
+          return snapshot != it->second->objects.end() && snapshot->second.Matches(object->bounding_region());
+        });
+    statistics->AddCacheLookup(is_up_to_date);
+    if (is_up_to_date) {
+      return it->second;
+    }
+  }
+  auto blocked_lanes = std::make_shared<BlockedLanes>();
+  for (const api::Object<maliput::math::Vector3>* object : objects) {
+    blocked_lanes->objects.emplace(object->id(), BoundingRegionSnapshot(object->bounding_region()));
+    DoVisitOverlappingLanesIn(object, maliput::math::OverlappingType::kIntersected,
+                              [&blocked_lanes](const maliput::api::Lane* lane) {
+                                blocked_lanes->lanes.insert(lane->id());
+                              });
+  }
+  if (!avoidance.cache_key.empty()) {
+    std::lock_guard<std::mutex> lock(blocked_lanes_cache_->mutex);
+    blocked_lanes_cache_->blocked_lanes[avoidance.cache_key] = blocked_lanes;
+  }
+  return blocked_lanes;
+}
+
+void SimpleObjectQuery::ClearBlockedLanesCache() const {
+  std::lock_guard<std::mutex> lock(blocked_lanes_cache_->mutex);
+  blocked_lanes_cache_->blocked_lanes.clear();
+}
+
+void SimpleObjectQuery::VisitIntervalsOnLane(const maliput::api::LaneId& lane_id, double s_min, double s_max,
+                                             QueryStatisticsScope* statistics,
+                                             const std::function<void(const LaneObjectInterval&)>& visitor) const {
+  if (lane_object_index_ != nullptr) {
+    lane_object_index_->VisitIntervalsOnLane(lane_id, maliput::api::SRange(s_min, s_max), visitor);
+    return;
+  }
+  const maliput::api::Lane* lane = road_network_->road_geometry()->ById().GetLane(lane_id);
+  if (lane == nullptr) {
+    return;
+  }
+  std::vector<LaneObjectInterval> intervals;
+  for (const auto& id_object : object_book_->objects()) {
+    statistics->AddCandidates(1);
+    const std::vector<const maliput::api::Lane*> lanes = FindIntersectedLanes(id_object.second, statistics);
+    if (std::find(lanes.begin(), lanes.end(), lane) == lanes.end()) {
+      continue;
+    }
+    const LaneFootprint footprint = ComputeLaneFootprint(lane, id_object.second);
+    if (footprint.s_min <= s_max && footprint.s_max >= s_min) {
+      intervals.push_back({id_object.second, footprint.s_min, footprint.s_max, footprint.r_min, footprint.r_max});
+    }
+  }
+  std::sort(intervals.begin(), intervals.end(), [](const LaneObjectInterval& lhs, const LaneObjectInterval& rhs) {
+    return lhs.s_min != rhs.s_min ? lhs.s_min < rhs.s_min : lhs.object->id().string() < rhs.object->id().string();
+  });
+  std::for_each(intervals.begin(), intervals.end(), visitor);
+}
+
+std::vector<const api::Object<maliput::math::Vector3>*> SimpleObjectQuery::DoFindObjectsOnLane(
+    const maliput::api::LaneId& lane_id, const maliput::api::SRange& s_range) const {
+  MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::FindObjectsOnLane");
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindObjectsOnLane);
+  std::vector<const api::Object<maliput::math::Vector3>*> objects;
+  VisitIntervalsOnLane(lane_id, std::min(s_range.s0(), s_range.s1()), std::max(s_range.s0(), s_range.s1()),
+                       &statistics,
+                       [&objects](const LaneObjectInterval& interval) { objects.push_back(interval.object); });
+  statistics.SetResults(objects.size());
+  return objects;
+}
+
+std::vector<maliput::api::SRange> SimpleObjectQuery::DoFindFreeGaps(const maliput::api::LaneId& lane_id,
+                                                                    const maliput::api::SRange& s_range,
+                                                                    double min_gap_length) const {
+  MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::FindFreeGaps");
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindFreeGaps);
+  const double s_min = std::min(s_range.s0(), s_range.s1());
+  const double s_max = std::max(s_range.s0(), s_range.s1());
+  std::vector<maliput::api::SRange> gaps;
+  // Intervals come sorted by their s_min, so a single pass merges the overlapping ones: the Lane is blocked up to
+  // gap_start by the intervals visited so far.
+  double gap_start = s_min;
+  const auto add_gap = [&gaps, &gap_start, min_gap_length](double gap_end) {
+    if (gap_end > gap_start && gap_end - gap_start >= min_gap_length) {
+      gaps.emplace_back(gap_start, gap_end);
+    }
+  };
+  VisitIntervalsOnLane(lane_id, s_min, s_max, &statistics, [&add_gap, &gap_start](const LaneObjectInterval& interval) {
+    add_gap(interval.s_min);
+    gap_start = std::max(gap_start, interval.s_max);
+  });
+  add_gap(s_max);
+  statistics.SetResults(gaps.size());
+  return gaps;
+}
+
+std::vector<api::ObjectAlongRoute> SimpleObjectQuery::DoFindObjectsAlongRoute(const maliput::api::LaneSRoute& route,
+                                                                              double lateral_margin) const {
+  MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::FindObjectsAlongRoute");
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindObjectsAlongRoute);
+  // Smallest route s of every Object found so far.
+  std::unordered_map<const api::Object<maliput::math::Vector3>*, double> route_s;
+  const auto offer = [&route_s](const api::Object<maliput::math::Vector3>* object, double s) {
+    const auto it = route_s.emplace(object, s).first;
+    it->second = std::min(it->second, s);
+  };
+  double range_start_s{0.};
+  for (const maliput::api::LaneSRange& range : route.ranges()) {
+    const double s0 = range.s_range().s0();
+    const double s1 = range.s_range().s1();
+    const double s_min = std::min(s0, s1);
+    const double s_max = std::max(s0, s1);
+    // Distance along the route to the first point of [@p interval_s_min, @p interval_s_max] within the range, which is
+    // travelled from s0 to s1.
+    const auto to_route_s = [range_start_s, s0, s1, s_min, s_max](double interval_s_min, double interval_s_max) {
+      return range_start_s + (s0 <= s1 ? std::clamp(interval_s_min, s_min, s_max) - s0
+                                       : s0 - std::clamp(interval_s_max, s_min, s_max));
+    };
+    VisitIntervalsOnLane(range.lane_id(), s_min, s_max, &statistics,
+                         [&offer, &to_route_s](const LaneObjectInterval& interval) {
+                           offer(interval.object, to_route_s(interval.s_min, interval.s_max));
+                         });
+
+    // Objects on the adjacent Lanes the margin reaches are projected onto the Lane of the range.
+    const maliput::api::Lane* lane =
+        lateral_margin > 0. ? road_network_->road_geometry()->ById().GetLane(range.lane_id()) : nullptr;
+    if (lane != nullptr) {
+      // Ends of the range on the centerline of the Lane, which are mapped onto every adjacent Lane.
+      const maliput::api::InertialPosition range_start = lane->ToInertialPosition({s_min, 0., 0.});
+      const maliput::api::InertialPosition range_end = lane->ToInertialPosition({s_max, 0., 0.});
+      for (const bool to_left : {true, false}) {
+        double width{0.};
+        for (const maliput::api::Lane* adjacent = to_left ? lane->to_left() : lane->to_right();
+             adjacent != nullptr && width < lateral_margin;
+             adjacent = to_left ? adjacent->to_left() : adjacent->to_right()) {
+          const double adjacent_s0 = adjacent->ToLanePosition(range_start).lane_position.s();
+          const double adjacent_s1 = adjacent->ToLanePosition(range_end).lane_position.s();
+          VisitIntervalsOnLane(
+              adjacent->id(), std::min(adjacent_s0, adjacent_s1), std::max(adjacent_s0, adjacent_s1), &statistics,
+              [&route_s, &offer, &to_route_s, lane, s_min, s_max, lateral_margin](const LaneObjectInterval& interval) {
+                // Objects already found on the route are not projected again, they cannot come earlier.
+                if (route_s.count(interval.object) != 0) {
+                  return;
+                }
+                const LaneFootprint footprint = ComputeLaneFootprint(lane, interval.object);
+                if (footprint.s_min > s_max || footprint.s_max < s_min) {
+                  return;
+                }
+                // The lane bounds over the s-coordinates the Object covers within the range.
+                const maliput::api::RBounds start_bounds = lane->lane_bounds(std::max(footprint.s_min, s_min));
+                const maliput::api::RBounds end_bounds = lane->lane_bounds(std::min(footprint.s_max, s_max));
+                if (footprint.r_min <= std::max(start_bounds.max(), end_bounds.max()) + lateral_margin &&
+                    footprint.r_max >= std::min(start_bounds.min(), end_bounds.min()) - lateral_margin) {
+                  offer(interval.object, to_route_s(footprint.s_min, footprint.s_max));
+                }
+              });
+          const maliput::api::RBounds adjacent_bounds = adjacent->lane_bounds((adjacent_s0 + adjacent_s1) / 2.);
+          width += adjacent_bounds.max() - adjacent_bounds.min();
+        }
+      }
+    }
+    range_start_s += s_max - s_min;
+  }
+  std::vector<api::ObjectAlongRoute> objects;
+  objects.reserve(route_s.size());
+  for (const auto& object_s : route_s) {
+    objects.push_back({object_s.first, object_s.second});
+  }
+  std::sort(objects.begin(), objects.end(), [](const api::ObjectAlongRoute& lhs, const api::ObjectAlongRoute& rhs) {
+    return lhs.route_s != rhs.route_s ? lhs.route_s < rhs.route_s
+                                      : lhs.object->id().string() < rhs.object->id().string();
+  });
+  statistics.SetResults(objects.size());
+  return objects;
+}
+
+std::vector<api::ObjectAhead> SimpleObjectQuery::DoFindNextObjectsAhead(
+    const maliput::api::RoadPosition& road_position, double horizon,
+    const std::function<bool(const api::Object<maliput::math::Vector3>*)>& predicate) const {
+  MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::FindNextObjectsAhead");
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindNextObjectsAhead);
+  // A Lane to look ahead on: the s-coordinate it is entered at, whether it is travelled towards increasing s and the
+  // distance travelled before entering it.
+  struct Step {
+    const maliput::api::Lane* lane;
+    double s;
+    bool increasing;
+    double distance;
+  };
+  std::vector<Step> pending{{road_position.lane,
+                             std::clamp(road_position.pos.s(), 0., road_position.lane->length()), true, 0.}};
+  // Shortest distance every Lane was entered at one of its ends, per direction of travel. Lanes entered again farther
+  // away are not walked again, which also ends cycles of the Lane graph. The Lane of @p road_position is entered
+  // midway, so a cycle may still lead back to the part behind it.
+  std::map<std::pair<const maliput::api::Lane*, bool>, double> entered;
+  std::unordered_map<const api::Object<maliput::math::Vector3>*, api::ObjectAhead> closest;
+  for (bool first_step = true; !pending.empty(); first_step = false) {
+    const Step step = pending.back();
+    pending.pop_back();
+    const auto [it, inserted] = first_step ? std::make_pair(entered.end(), true)
+                                           : entered.emplace(std::make_pair(step.lane, step.increasing), step.distance);
+    if (!inserted) {
+      if (it->second <= step.distance) {
+        continue;
+      }
+      it->second = step.distance;
+    }
+    const double remaining = horizon - step.distance;
+    const double length = step.lane->length();
+    const double s_min = step.increasing ? step.s : std::max(step.s - remaining, 0.);
+    const double s_max = step.increasing ? std::min(step.s + remaining, length) : step.s;
+    std::optional<api::ObjectAhead> found;
+    VisitIntervalsOnLane(step.lane->id(), s_min, s_max, &statistics,
+                         [&found, &predicate, &step](const LaneObjectInterval& interval) {
+                           if (predicate && !predicate(interval.object)) {
+                             return;
+                           }
+                           const double gap = step.distance + std::max(0., step.increasing ? interval.s_min - step.s
+                                                                                           : step.s - interval.s_max);
+                           if (!found.has_value() || gap < found->gap ||
+                               (gap == found->gap && interval.object->id().string() < found->object->id().string())) {
+                             found = api::ObjectAhead{interval.object, gap, step.lane};
+                           }
+                         });
+    if (found.has_value()) {
+      const auto closest_it = closest.emplace(found->object, *found).first;
+      if (found->gap < closest_it->second.gap) {
+        closest_it->second = *found;
+      }
+      continue;
+    }
+    const double distance_to_end = step.increasing ? length - step.s : step.s;
+    if (step.distance + distance_to_end > horizon) {
+      continue;
+    }
+    const maliput::api::LaneEndSet* ongoing_branches = step.lane->GetOngoingBranches(
+        step.increasing ? maliput::api::LaneEnd::kFinish : maliput::api::LaneEnd::kStart);
+    if (ongoing_branches == nullptr) {
+      continue;
+    }
+    for (int i = 0; i < ongoing_branches->size(); ++i) {
+      const maliput::api::LaneEnd& lane_end = ongoing_branches->get(i);
+      const bool increasing = lane_end.end == maliput::api::LaneEnd::kStart;
+      pending.push_back(
+          {lane_end.lane, increasing ? 0. : lane_end.lane->length(), increasing, step.distance + distance_to_end});
+    }
+  }
+  std::vector<api::ObjectAhead> objects;
+  objects.reserve(closest.size());
+  for (const auto& object_ahead : closest) {
+    objects.push_back(object_ahead.second);
+  }
+  std::sort(objects.begin(), objects.end(), [](const api::ObjectAhead& lhs, const api::ObjectAhead& rhs) {
+    return lhs.gap != rhs.gap ? lhs.gap < rhs.gap : lhs.object->id().string() < rhs.object->id().string();
+  });
+  statistics.SetResults(objects.size());
+  return objects;
+}
+
+std::vector<std::vector<api::ObjectDistance>> SimpleObjectQuery::DoFindNearestNeighbors(
+    const std::vector<const api::Object<maliput::math::Vector3>*>& objects, int k, double max_distance) const {
+  MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::FindNearestNeighbors");
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindNearestNeighbors);
+  std::vector<std::vector<api::ObjectDistance>> neighbors;
+  neighbors.reserve(objects.size());
+  std::size_t num_results{0};
+  for (const api::Object<maliput::math::Vector3>* object : objects) {
+    // Every point of the region of a box is within half its diagonal of its position, so the Objects within
+    // max_distance of the region are within max_distance plus half the diagonal of the position.
+    const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&object->bounding_region());
+    const double radius = bounding_box != nullptr ? bounding_box->box_size().norm() / 2. : 0.;
+    const std::vector<api::Object<maliput::math::Vector3>*> candidates =
+        object_book_->FindWithinDistance(object->position(), max_distance + radius);
+    statistics.AddCandidates(candidates.size());
+    NearestObjects<maliput::math::Vector3> nearest(k);
+    for (api::Object<maliput::math::Vector3>* candidate : candidates) {
+      if (candidate->id() == object->id()) {
+        continue;
+      }
+      const double distance = api::ComputeDistance(object->bounding_region(), candidate->bounding_region());
+      if (distance <= max_distance) {
+        nearest.Offer(candidate, distance);
+      }
+    }
+    std::vector<api::ObjectDistance>& object_neighbors = neighbors.emplace_back();
+    for (const auto& distance_object : nearest.SortedWithDistances()) {
+      object_neighbors.push_back({distance_object.second, distance_object.first});
+    }
+    num_results += object_neighbors.size();
+  }
+  statistics.SetResults(num_results);
+  return neighbors;
+}
+
+std::vector<std::vector<api::LaneClearance>> SimpleObjectQuery::DoFindLaneClearances(
+    const std::vector<const api::Object<maliput::math::Vector3>*>& objects, double max_distance) const {
+  MALIPUT_OBJECT_TRACE_SPAN("SimpleObjectQuery::FindLaneClearances");
+  QueryStatisticsScope statistics(QueryRecord::Method::kFindLaneClearances);
+  std::vector<std::vector<api::LaneClearance>> clearances;
+  clearances.reserve(objects.size());
+  std::size_t num_results{0};
+  for (const api::Object<maliput::math::Vector3>* object : objects) {
+    std::size_t num_lanes{0};
+    clearances.push_back(FindLaneClearancesNear(object, max_distance, &num_lanes));
+    statistics.AddCandidates(num_lanes);
+    num_results += clearances.back().size();
+  }
+  statistics.SetResults(num_results);
+  return clearances;
+}
+
 const api::ObjectBook<maliput::math::Vector3>* SimpleObjectQuery::do_object_book() const { return object_book_; }
 const maliput::api::RoadNetwork* SimpleObjectQuery::do_road_network() const { return {road_network_}; }
 
@@ -0,0 +1,258 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/spatial_join.h"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/base/tracing.h"
+
+namespace maliput {
+namespace object {
+namespace {
+
+template <typename Coordinate>
+using ObjectPairs = std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>>;
+
+// Number of pairs of subtrees per thread the top of the traversal is split into, so that threads stay busy when the
+// subtrees are unbalanced.
+constexpr std::size_t kNodePairsPerThread{4};
+
+// A node of the left hierarchy and a node of the right one, whose boxes overlap.
+struct NodePair {
+  int lhs{};
+  int rhs{};
+};
+
+template <typename Coordinate>
+double Volume(const AxisAlignedBox<Coordinate>& box) {
+  const Coordinate size = box.max_corner - box.min_corner;
+  return size[0] * size[1] * size[2];
+}
+
+// Joins the subtrees of two hierarchies.
+template <typename Coordinate>
+class Join {
+ public:
+  Join(const BoundingVolumeHierarchy<Coordinate>& lhs, const BoundingVolumeHierarchy<Coordinate>& rhs,
+       const maliput::math::OverlappingType& overlapping_type)
+      : lhs_(lhs), rhs_(rhs), overlapping_type_(overlapping_type) {}
+
+  // Joins @p pair when both nodes are leaves. Otherwise appends to @p pending the pairs of the children of the larger
+  // node and the other node whose boxes overlap.
+  void Expand(const NodePair& pair, std::vector<NodePair>* pending, ObjectPairs<Coordinate>* pairs) const {
+    const auto& lhs_node = lhs_.nodes()[pair.lhs];
+    const auto& rhs_node = rhs_.nodes()[pair.rhs];
+    if (lhs_node.is_leaf && rhs_node.is_leaf) {
+      for (int i = lhs_node.first; i < lhs_node.first + lhs_node.count; ++i) {
+        const auto& lhs_entry = lhs_.entries()[i];
+        if (lhs_entry.object == nullptr) {
+          continue;
+        }
+        for (int j = rhs_node.first; j < rhs_node.first + rhs_node.count; ++j) {
+          const auto& rhs_entry = rhs_.entries()[j];
+          if (rhs_entry.object != nullptr && lhs_entry.box.Overlaps(rhs_entry.box)) {
+            Confirm(lhs_entry.object, rhs_entry.object, pairs);
+          }
+        }
+      }
+      return;
+    }
+    if (rhs_node.is_leaf || (!lhs_node.is_leaf && Volume(lhs_node.box) >= Volume(rhs_node.box))) {
+      for (int child = lhs_node.first; child < lhs_node.first + lhs_node.count; ++child) {
+        if (lhs_.nodes()[child].box.Overlaps(rhs_node.box)) {
+          pending->push_back({child, pair.rhs});
+        }
+      }
+    } else {
+      for (int child = rhs_node.first; child < rhs_node.first + rhs_node.count; ++child) {
+        if (rhs_.nodes()[child].box.Overlaps(lhs_node.box)) {
+          pending->push_back({pair.lhs, child});
+        }
+      }
+    }
+  }
+
+  // Appends @p lhs and @p rhs to @p pairs when their regions overlap.
+  void Confirm(api::Object<Coordinate>* lhs, api::Object<Coordinate>* rhs, ObjectPairs<Coordinate>* pairs) const {
+    if ((rhs->bounding_region().Overlaps(lhs->bounding_region()) & overlapping_type_) == overlapping_type_) {
+      pairs->emplace_back(lhs, rhs);
+    }
+  }
+
+ private:
+  const BoundingVolumeHierarchy<Coordinate>& lhs_;
+  const BoundingVolumeHierarchy<Coordinate>& rhs_;
+  const maliput::math::OverlappingType& overlapping_type_;
+};
+
+// Calls @p visitor with every object of @p hierarchy.
+template <typename Coordinate, typename Visitor>
+void VisitObjects(const BoundingVolumeHierarchy<Coordinate>& hierarchy, const Visitor& visitor) {
+  for (const auto& entry : hierarchy.entries()) {
+    if (entry.object != nullptr) {
+      visitor(entry.object);
+    }
+  }
+  for (api::Object<Coordinate>* object : hierarchy.unbounded()) {
+    visitor(object);
+  }
+}
+
+// @returns The spatial index of @p book when it is a ManualObjectBook whose index holds every object, or a new
+//          hierarchy of the objects of @p book otherwise.
+template <typename Coordinate>
+std::shared_ptr<const BoundingVolumeHierarchy<Coordinate>> GetOrBuildIndex(const api::ObjectBook<Coordinate>& book,
+                                                                          double tolerance) {
+  const auto* manual_book = dynamic_cast<const ManualObjectBook<Coordinate>*>(&book);
+  if (manual_book != nullptr) {
+    std::shared_ptr<const BoundingVolumeHierarchy<Coordinate>> index = manual_book->index();
+    if (index != nullptr) {
+      return index;
+    }
+  }
+  std::vector<api::Object<Coordinate>*> objects;
+  for (const auto& id_object : book.objects()) {
+    objects.push_back(id_object.second);
+  }
+  return std::make_shared<const BoundingVolumeHierarchy<Coordinate>>(objects, tolerance);
+}
+
+}  // namespace
+
+template <typename Coordinate>
+std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> SpatialJoin(
+    const BoundingVolumeHierarchy<Coordinate>& lhs, const BoundingVolumeHierarchy<Coordinate>& rhs,
+    const maliput::math::OverlappingType& overlapping_type, int num_threads) {
+  MALIPUT_THROW_UNLESS(num_threads >= 0);
+  MALIPUT_OBJECT_TRACE_SPAN("SpatialJoin");
+  if (num_threads == 0) {
+    num_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+  const Join<Coordinate> join(lhs, rhs, overlapping_type);
+  ObjectPairs<Coordinate> pairs;
+  if (overlapping_type == maliput::math::OverlappingType::kDisjointed) {
+    // Objects that are disjointed from each other cannot be pruned.
+    VisitObjects(lhs, [&rhs, &join, &pairs](api::Object<Coordinate>* lhs_object) {
+      VisitObjects(rhs, [lhs_object, &join, &pairs](api::Object<Coordinate>* rhs_object) {
+        join.Confirm(lhs_object, rhs_object, &pairs);
+      });
+    });
+  } else {
+    for (api::Object<Coordinate>* lhs_object : lhs.unbounded()) {
+      VisitObjects(rhs, [lhs_object, &join, &pairs](api::Object<Coordinate>* rhs_object) {
+        join.Confirm(lhs_object, rhs_object, &pairs);
+      });
+    }
+    for (api::Object<Coordinate>* rhs_object : rhs.unbounded()) {
+      for (const auto& lhs_entry : lhs.entries()) {
+        if (lhs_entry.object != nullptr) {
+          join.Confirm(lhs_entry.object, rhs_object, &pairs);
+        }
+      }
+    }
+  }
+  if (overlapping_type != maliput::math::OverlappingType::kDisjointed && !lhs.nodes().empty() &&
+      !rhs.nodes().empty() && lhs.nodes().back().box.Overlaps(rhs.nodes().back().box)) {
+    // Splits the top of the traversal breadth-first into enough pairs of subtrees to keep every thread busy.
+    std::vector<NodePair> subtrees{
+        {static_cast<int>(lhs.nodes().size()) - 1, static_cast<int>(rhs.nodes().size()) - 1}};
+    const std::size_t min_num_subtrees = kNodePairsPerThread * static_cast<std::size_t>(num_threads);
+    while (num_threads > 1 && !subtrees.empty() && subtrees.size() < min_num_subtrees) {
+      std::vector<NodePair> children;
+      for (const NodePair& pair : subtrees) {
+        join.Expand(pair, &children, &pairs);
+      }
+      subtrees = std::move(children);
+    }
+    // Workers join interleaved pairs of subtrees into buffers of their own, which are merged once they are all done.
+    const std::size_t num_workers = std::min(subtrees.size(), static_cast<std::size_t>(num_threads));
+    std::vector<ObjectPairs<Coordinate>> worker_pairs(num_workers);
+    const auto join_subtrees = [&join, &subtrees, &worker_pairs, num_workers](std::size_t worker) {
+      std::vector<NodePair> pending;
+      for (std::size_t i = worker; i < subtrees.size(); i += num_workers) {
+        pending.push_back(subtrees[i]);
+        while (!pending.empty()) {
+          const NodePair pair = pending.back();
+          pending.pop_back();
+          join.Expand(pair, &pending, &worker_pairs[worker]);
+        }
+      }
+    };
+    std::vector<std::future<void>> workers;
+    for (std::size_t worker = 1; worker < num_workers; ++worker) {
+      workers.push_back(std::async(std::launch::async, join_subtrees, worker));
+    }
+    if (num_workers > 0) {
+      join_subtrees(0);
+    }
+    for (std::future<void>& worker : workers) {
+      worker.get();
+    }
+    for (const ObjectPairs<Coordinate>& joined : worker_pairs) {
+      pairs.insert(pairs.end(), joined.begin(), joined.end());
+    }
+  }
+  std::sort(pairs.begin(), pairs.end(), [](const auto& lhs_pair, const auto& rhs_pair) {
+    if (lhs_pair.first->id() != rhs_pair.first->id()) {
+      return lhs_pair.first->id().string() < rhs_pair.first->id().string();
+    }
+    return lhs_pair.second->id().string() < rhs_pair.second->id().string();
+  });
+  return pairs;
+}
+
+template <typename Coordinate>
+std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> SpatialJoin(
+    const api::ObjectBook<Coordinate>& lhs, const api::ObjectBook<Coordinate>& rhs,
+    const maliput::math::OverlappingType& overlapping_type, int num_threads, double tolerance) {
+  MALIPUT_THROW_UNLESS(num_threads >= 0);
+  MALIPUT_THROW_UNLESS(tolerance >= 0.);
+  const std::shared_ptr<const BoundingVolumeHierarchy<Coordinate>> lhs_index = GetOrBuildIndex(lhs, tolerance);
+  const std::shared_ptr<const BoundingVolumeHierarchy<Coordinate>> rhs_index = GetOrBuildIndex(rhs, tolerance);
+  return SpatialJoin(*lhs_index, *rhs_index, overlapping_type, num_threads);
+}
+
+template std::vector<std::pair<api::Object<maliput::math::Vector3>*, api::Object<maliput::math::Vector3>*>>
+SpatialJoin(const BoundingVolumeHierarchy<maliput::math::Vector3>& lhs,
+            const BoundingVolumeHierarchy<maliput::math::Vector3>& rhs,
+            const maliput::math::OverlappingType& overlapping_type, int num_threads);
+template std::vector<std::pair<api::Object<maliput::math::Vector3>*, api::Object<maliput::math::Vector3>*>>
+SpatialJoin(const api::ObjectBook<maliput::math::Vector3>& lhs, const api::ObjectBook<maliput::math::Vector3>& rhs,
+            const maliput::math::OverlappingType& overlapping_type, int num_threads, double tolerance);
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,238 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/sweep_and_prune.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace object {
+namespace {
+
+constexpr int kDimensions{3};
+
+}  // namespace
+
+template <typename Coordinate>
+SweepAndPrune<Coordinate>::SweepAndPrune(double tolerance) : tolerance_(tolerance) {
+  MALIPUT_THROW_UNLESS(tolerance_ >= 0.);
+}
+
+template <typename Coordinate>
+void SweepAndPrune<Coordinate>::Update(const std::vector<api::Object<Coordinate>*>& objects) {
+  std::unordered_map<typename api::Object<Coordinate>::Id, api::Object<Coordinate>*> pending;
+  pending.reserve(objects.size());
+  for (api::Object<Coordinate>* object : objects) {
+    MALIPUT_THROW_UNLESS(object != nullptr);
+    pending.emplace(object->id(), object);
+  }
+  // Refreshes the entries of the objects that are still bounded, keeping their order.
+  std::size_t num_kept{0};
+  for (std::size_t i = 0; i < entries_.size(); ++i) {
+    Entry& entry = entries_[i];
+    const auto it = pending.find(entry.id);
+    if (it == pending.end()) {
+      continue;
+    }
+    const auto box = ComputeAxisAlignedBox(it->second->bounding_region(), tolerance_);
+    if (!box.has_value()) {
+      continue;
+    }
+    entry.box = box.value();
+    entry.object = it->second;
+    pending.erase(it);
+    if (num_kept != i) {
+      entries_[num_kept] = std::move(entry);
+    }
+    ++num_kept;
+  }
+  entries_.erase(entries_.begin() + num_kept, entries_.end());
+  unbounded_.clear();
+  for (const auto& id_object : pending) {
+    const auto box = ComputeAxisAlignedBox(id_object.second->bounding_region(), tolerance_);
+    if (box.has_value()) {
+      entries_.push_back(Entry{box.value(), id_object.second, id_object.first});
+    } else {
+      unbounded_.push_back(id_object.second);
+    }
+  }
+  // Insertion sort only pays off when most of the entries are already in place.
+  if (4 * (entries_.size() - num_kept) > num_kept) {
+    Sort();
+    return;
+  }
+  for (std::size_t i = 1; i < entries_.size(); ++i) {
+    Entry entry = std::move(entries_[i]);
+    std::size_t j = i;
+    for (; j > 0 && entries_[j - 1].box.min_corner[axis_] > entry.box.min_corner[axis_]; --j) {
+      entries_[j] = std::move(entries_[j - 1]);
+    }
+    entries_[j] = std::move(entry);
+  }
+}
+
+template <typename Coordinate>
+void SweepAndPrune<Coordinate>::Insert(api::Object<Coordinate>* object) {
+  MALIPUT_THROW_UNLESS(object != nullptr);
+  const auto box = ComputeAxisAlignedBox(object->bounding_region(), tolerance_);
+  if (!box.has_value()) {
+    unbounded_.push_back(object);
+    return;
+  }
+  const auto it = std::upper_bound(entries_.begin(), entries_.end(), box->min_corner[axis_],
+                                   [axis = axis_](double min_corner, const Entry& entry) {
+                                     return min_corner < entry.box.min_corner[axis];
+                                   });
+  entries_.insert(it, Entry{box.value(), object, object->id()});
+}
+
+template <typename Coordinate>
+bool SweepAndPrune<Coordinate>::Remove(const typename api::Object<Coordinate>::Id& id) {
+  const auto entry =
+      std::find_if(entries_.begin(), entries_.end(), [&id](const Entry& entry) { return entry.id == id; });
+  if (entry != entries_.end()) {
+    entries_.erase(entry);
+    return true;
+  }
+  const auto unbounded = std::find_if(unbounded_.begin(), unbounded_.end(),
+                                      [&id](const api::Object<Coordinate>* object) { return object->id() == id; });
+  if (unbounded != unbounded_.end()) {
+    unbounded_.erase(unbounded);
+    return true;
+  }
+  return false;
+}
+
+template <typename Coordinate>
+void SweepAndPrune<Coordinate>::VisitCandidatePairs(
+    const std::function<void(api::Object<Coordinate>*, api::Object<Coordinate>*)>& visitor) const {
+  for (std::size_t i = 0; i < entries_.size(); ++i) {
+    const Entry& lhs = entries_[i];
+    for (std::size_t j = i + 1; j < entries_.size() && entries_[j].box.min_corner[axis_] <= lhs.box.max_corner[axis_];
+         ++j) {
+      if (lhs.box.Overlaps(entries_[j].box)) {
+        visitor(lhs.object, entries_[j].object);
+      }
+    }
+  }
+  for (std::size_t i = 0; i < unbounded_.size(); ++i) {
+    for (const Entry& entry : entries_) {
+      visitor(unbounded_[i], entry.object);
+    }
+    for (std::size_t j = i + 1; j < unbounded_.size(); ++j) {
+      visitor(unbounded_[i], unbounded_[j]);
+    }
+  }
+}
+
+template <typename Coordinate>
+std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>>
+SweepAndPrune<Coordinate>::FindOverlappingPairs(std::size_t* num_candidates) const {
+  if (num_candidates != nullptr) {
+    *num_candidates = 0;
+  }
+  std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> pairs;
+  VisitCandidatePairs([&pairs, num_candidates](api::Object<Coordinate>* lhs, api::Object<Coordinate>* rhs) {
+    if (num_candidates != nullptr) {
+      ++*num_candidates;
+    }
+    if ((lhs->bounding_region().Overlaps(rhs->bounding_region()) & maliput::math::OverlappingType::kIntersected) !=
+        maliput::math::OverlappingType::kIntersected) {
+      return;
+    }
+    if (rhs->id().string() < lhs->id().string()) {
+      std::swap(lhs, rhs);
+    }
+    pairs.emplace_back(lhs, rhs);
+  });
+  std::sort(pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) {
+    if (lhs.first->id() != rhs.first->id()) {
+      return lhs.first->id().string() < rhs.first->id().string();
+    }
+    return lhs.second->id().string() < rhs.second->id().string();
+  });
+  return pairs;
+}
+
+template <typename Coordinate>
+MemoryUsageReport SweepAndPrune<Coordinate>::MemoryUsage() const {
+  MemoryUsageReport report;
+  report.index = sizeof(*this) + entries_.capacity() * sizeof(Entry) +
+                 unbounded_.capacity() * sizeof(api::Object<Coordinate>*);
+  for (const Entry& entry : entries_) {
+    report.index += EstimateHeapSize(entry.id.string());
+  }
+  return report;
+}
+
+template <typename Coordinate>
+void SweepAndPrune<Coordinate>::Sort() {
+  // Picks the axis with the largest variance of the centers.
+  double max_variance{-1.};
+  for (int axis = 0; axis < kDimensions; ++axis) {
+    double sum{0.};
+    double squared_sum{0.};
+    for (const Entry& entry : entries_) {
+      const double center = entry.box.center()[axis];
+      sum += center;
+      squared_sum += center * center;
+    }
+    const double count = static_cast<double>(std::max<std::size_t>(entries_.size(), 1));
+    const double variance = squared_sum / count - (sum / count) * (sum / count);
+    if (variance > max_variance) {
+      max_variance = variance;
+      axis_ = axis;
+    }
+  }
+  std::sort(entries_.begin(), entries_.end(), [axis = axis_](const Entry& lhs, const Entry& rhs) {
+    return lhs.box.min_corner[axis] < rhs.box.min_corner[axis];
+  });
+}
+
+template <typename Coordinate>
+std::vector<std::pair<api::Object<Coordinate>*, api::Object<Coordinate>*>> FindOverlappingPairs(
+    const std::vector<api::Object<Coordinate>*>& objects, double tolerance) {
+  SweepAndPrune<Coordinate> sweep_and_prune(tolerance);
+  sweep_and_prune.Update(objects);
+  return sweep_and_prune.FindOverlappingPairs();
+}
+
+template class SweepAndPrune<maliput::math::Vector3>;
+template std::vector<std::pair<api::Object<maliput::math::Vector3>*, api::Object<maliput::math::Vector3>*>>
+FindOverlappingPairs(const std::vector<api::Object<maliput::math::Vector3>*>& objects, double tolerance);
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/tracing.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <vector>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace object {
+namespace {
+
+struct TraceEvent {
+  const char* name;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::nanoseconds duration;
+  std::uint32_t thread_id;
+};
+
+// Collects the events of the trace in progress.
+class Tracer {
+ public:
+  // The tracer is never destroyed, so spans can end during static destruction.
+  static Tracer& Get() {
+    static Tracer* tracer = new Tracer();
+    return *tracer;
+  }
+
+  void Start(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    MALIPUT_VALIDATE(!active_.load(), "Tracing already started.");
+    file_.open(filename, std::ios::trunc);
+    MALIPUT_VALIDATE(file_.is_open(), "Unable to open " + filename);
+    start_ = std::chrono::steady_clock::now();
+    events_.clear();
+    active_.store(true);
+  }
+
+  void Stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    MALIPUT_VALIDATE(active_.load(), "Tracing did not start.");
+    active_.store(false);
+    const auto to_us = [](std::chrono::nanoseconds duration) { return duration.count() / 1000.; };
+    const int pid = static_cast<int>(::getpid());
+    file_ << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (std::size_t i = 0; i < events_.size(); ++i) {
+      const TraceEvent& event = events_[i];
+      file_ << (i == 0 ? "" : ",") << "\n{\"name\":\"";
+      for (const char* c = event.name; *c != '\0'; ++c) {
+        file_ << (*c == '"' || *c == '\\' ? "\\" : "") << *c;
+      }
+      file_ << "\",\"cat\":\"maliput_object\",\"ph\":\"X\",\"ts\":" << to_us(event.start - start_)
+            << ",\"dur\":" << to_us(event.duration) << ",\"pid\":" << pid << ",\"tid\":" << event.thread_id << "}";
+    }
+    file_ << "\n]}\n";
+    file_.close();
+    events_.clear();
+  }
+
+  bool active() const { return active_.load(std::memory_order_relaxed); }
+
+  void Add(const TraceEvent& event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Tracing may have stopped, or restarted, while the span was open.
+    if (active_.load() && event.start >= start_) {
+      events_.push_back(event);
+    }
+  }
+
+ private:
+  Tracer() = default;
+
+  std::mutex mutex_;
+  std::atomic<bool> active_{false};
+  std::ofstream file_;
+  std::chrono::steady_clock::time_point start_;
+  std::vector<TraceEvent> events_;
+};
+
+// @returns A small integer that identifies the calling thread in the trace.
+std::uint32_t GetThreadId() {
+  static std::atomic<std::uint32_t> next_thread_id{1};
+  thread_local const std::uint32_t thread_id = next_thread_id.fetch_add(1);
+  return thread_id;
+}
+
+}  // namespace
+
+void StartTracing(const std::string& filename) { Tracer::Get().Start(filename); }
+
+void StopTracing() { Tracer::Get().Stop(); }
+
+bool TracingActive() { return Tracer::Get().active(); }
+
+TraceSpan::TraceSpan(const char* name) : name_(name), active_(TracingActive()) {
+  if (active_) {
+    start_ = std::chrono::steady_clock::now();
+  }
+}
+
+TraceSpan::~TraceSpan() {
+  if (active_) {
+    Tracer::Get().Add({name_, start_, std::chrono::steady_clock::now() - start_, GetThreadId()});
+  }
+}
+
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,214 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/generator/generator.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <random>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <yaml-cpp/yaml.h>
+
+namespace maliput {
+namespace object {
+namespace generator {
+namespace {
+
+using maliput::math::Vector3;
+
+bool IsValidRange(const Vector3& min, const Vector3& max) {
+  for (std::size_t i = 0; i < 3; ++i) {
+    if (min[i] > max[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Vector3 UniformIn(const Vector3& min, const Vector3& max, std::mt19937* generator) {
+  Vector3 result;
+  for (std::size_t i = 0; i < 3; ++i) {
+    result[i] = std::uniform_real_distribution<double>(min[i], max[i])(*generator);
+  }
+  return result;
+}
+
+// Position and yaw angle of an object.
+struct Pose {
+  Vector3 position;
+  double yaw{};
+};
+
+// Draws the poses of the objects according to the spatial distribution of @p config. @p box_sizes are used to rest
+// objects on the road when they are placed along lanes.
+std::vector<Pose> GeneratePoses(const GeneratorConfig& config, const std::vector<Vector3>& box_sizes,
+                                std::mt19937* generator) {
+  std::uniform_real_distribution<double> yaw_distribution(-config.max_yaw, config.max_yaw);
+  std::vector<Pose> poses;
+  poses.reserve(config.num_objects);
+  switch (config.spatial_distribution) {
+    case SpatialDistribution::kUniform:
+      for (int i = 0; i < config.num_objects; ++i) {
+        poses.push_back({UniformIn(config.region_min, config.region_max, generator), yaw_distribution(*generator)});
+      }
+      break;
+    case SpatialDistribution::kClustered: {
+      std::vector<Vector3> centers;
+      for (int i = 0; i < config.num_clusters; ++i) {
+        centers.push_back(UniformIn(config.region_min, config.region_max, generator));
+      }
+      std::uniform_int_distribution<int> cluster_distribution(0, config.num_clusters - 1);
+      std::normal_distribution<double> offset_distribution(0., config.cluster_radius);
+      for (int i = 0; i < config.num_objects; ++i) {
+        const Vector3& center = centers[cluster_distribution(*generator)];
+        Vector3 position;
+        for (std::size_t j = 0; j < 3; ++j) {
+          const double offset = config.region_min[j] < config.region_max[j] ? offset_distribution(*generator) : 0.;
+          position[j] = std::clamp(center[j] + offset, config.region_min[j], config.region_max[j]);
+        }
+        poses.push_back({position, yaw_distribution(*generator)});
+      }
+      break;
+    }
+    case SpatialDistribution::kAlongLanes: {
+      std::vector<const maliput::api::Lane*> lanes;
+      std::vector<double> lengths;
+      for (const auto& lane_id_lane : config.road_geometry->ById().GetLanes()) {
+        lanes.push_back(lane_id_lane.second);
+      }
+      // Sorts the lanes so that the result does not depend on the iteration order of the road geometry.
+      std::sort(lanes.begin(), lanes.end(), [](const maliput::api::Lane* lhs, const maliput::api::Lane* rhs) {
+        return lhs->id().string() < rhs->id().string();
+      });
+      std::transform(lanes.begin(), lanes.end(), std::back_inserter(lengths),
+                     [](const maliput::api::Lane* lane) { return lane->length(); });
+      std::discrete_distribution<std::size_t> lane_distribution(lengths.begin(), lengths.end());
+      for (int i = 0; i < config.num_objects; ++i) {
+        const maliput::api::Lane* lane = lanes[lane_distribution(*generator)];
+        const double s = std::uniform_real_distribution<double>(0., lane->length())(*generator);
+        const maliput::api::RBounds lane_bounds = lane->lane_bounds(s);
+        const double r = std::uniform_real_distribution<double>(lane_bounds.min(), lane_bounds.max())(*generator);
+        const maliput::api::LanePosition lane_position(s, r, box_sizes[i].z() / 2.);
+        poses.push_back({lane->ToInertialPosition(lane_position).xyz(),
+                         lane->GetOrientation(lane_position).yaw() + yaw_distribution(*generator)});
+      }
+      break;
+    }
+  }
+  return poses;
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<api::Object<Vector3>>> GenerateObjects(const GeneratorConfig& config) {
+  MALIPUT_THROW_UNLESS(config.num_objects >= 0);
+  MALIPUT_THROW_UNLESS(IsValidRange(config.region_min, config.region_max));
+  MALIPUT_THROW_UNLESS(IsValidRange(config.min_box_size, config.max_box_size));
+  MALIPUT_THROW_UNLESS(config.min_box_size.x() >= 0. && config.min_box_size.y() >= 0. && config.min_box_size.z() >= 0.);
+  MALIPUT_THROW_UNLESS(config.max_yaw >= 0.);
+  MALIPUT_THROW_UNLESS(config.tolerance >= 0.);
+  MALIPUT_THROW_UNLESS(config.num_properties >= 0);
+  MALIPUT_THROW_UNLESS(config.property_cardinality > 0);
+  if (config.spatial_distribution == SpatialDistribution::kClustered) {
+    MALIPUT_THROW_UNLESS(config.num_clusters > 0);
+    MALIPUT_THROW_UNLESS(config.cluster_radius >= 0.);
+  }
+  if (config.spatial_distribution == SpatialDistribution::kAlongLanes) {
+    MALIPUT_THROW_UNLESS(config.road_geometry != nullptr);
+    MALIPUT_THROW_UNLESS(!config.road_geometry->ById().GetLanes().empty());
+  }
+
+  std::mt19937 generator(config.seed);
+  std::vector<Vector3> box_sizes;
+  box_sizes.reserve(config.num_objects);
+  for (int i = 0; i < config.num_objects; ++i) {
+    box_sizes.push_back(UniformIn(config.min_box_size, config.max_box_size, &generator));
+  }
+  const std::vector<Pose> poses = GeneratePoses(config, box_sizes, &generator);
+  std::uniform_int_distribution<int> value_distribution(0, config.property_cardinality - 1);
+
+  std::vector<std::unique_ptr<api::Object<Vector3>>> objects;
+  objects.reserve(config.num_objects);
+  for (int i = 0; i < config.num_objects; ++i) {
+    std::map<std::string, std::string> properties;
+    for (int k = 0; k < config.num_properties; ++k) {
+      properties.emplace("property_" + std::to_string(k), "value_" + std::to_string(value_distribution(generator)));
+    }
+    objects.push_back(std::make_unique<api::Object<Vector3>>(
+        api::Object<Vector3>::Id("object_" + std::to_string(i)), properties,
+        std::make_unique<maliput::math::BoundingBox>(poses[i].position, box_sizes[i],
+                                                     maliput::math::RollPitchYaw(0., 0., poses[i].yaw),
+                                                     config.tolerance)));
+  }
+  return objects;
+}
+
+std::string ToYamlDocument(const std::vector<const api::Object<Vector3>*>& objects) {
+  YAML::Emitter emitter;
+  emitter.SetDoublePrecision(std::numeric_limits<double>::max_digits10);
+  const auto emit_sequence = [&emitter](double x, double y, double z) {
+    emitter << YAML::Flow << YAML::BeginSeq << x << y << z << YAML::EndSeq;
+  };
+  emitter << YAML::BeginMap << YAML::Key << "maliput_objects" << YAML::Value << YAML::BeginMap;
+  for (const api::Object<Vector3>* object : objects) {
+    MALIPUT_THROW_UNLESS(object != nullptr);
+    const auto* bounding_box = dynamic_cast<const maliput::math::BoundingBox*>(&object->bounding_region());
+    MALIPUT_THROW_UNLESS(bounding_box != nullptr);
+    const Vector3& position = bounding_box->position();
+    const maliput::math::RollPitchYaw& rotation = bounding_box->get_orientation();
+    const Vector3& box_size = bounding_box->box_size();
+    emitter << YAML::Key << object->id().string() << YAML::Value << YAML::BeginMap;
+    emitter << YAML::Key << "bounding_region" << YAML::Value << YAML::BeginMap;
+    emitter << YAML::Key << "position" << YAML::Value;
+    emit_sequence(position.x(), position.y(), position.z());
+    emitter << YAML::Key << "rotation" << YAML::Value;
+    emit_sequence(rotation.roll_angle(), rotation.pitch_angle(), rotation.yaw_angle());
+    emitter << YAML::Key << "type" << YAML::Value << "box";
+    emitter << YAML::Key << "box_size" << YAML::Value;
+    emit_sequence(box_size.x(), box_size.y(), box_size.z());
+    emitter << YAML::EndMap;
+    emitter << YAML::Key << "properties" << YAML::Value << YAML::BeginMap;
+    for (const auto& property : object->get_properties()) {
+      emitter << YAML::Key << property.first << YAML::Value << property.second;
+    }
+    emitter << YAML::EndMap << YAML::EndMap;
+  }
+  emitter << YAML::EndMap << YAML::EndMap;
+  return emitter.c_str();
+}
+
+}  // namespace generator
+}  // namespace object
+}  // namespace maliput
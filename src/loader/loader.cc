@@ -29,16 +29,22 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_object/loader/loader.h"
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include <maliput/api/lane_data.h>
 #include <maliput/common/maliput_throw.h>
 #include <maliput/math/bounding_box.h>
 #include <yaml-cpp/yaml.h>
 
 #include "maliput_object/api/object.h"
+#include "maliput_object/base/bounding_region_snapshot.h"
 #include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/base/tracing.h"
 
 namespace YAML {
 
@@ -80,6 +86,18 @@ struct convert<maliput::math::RollPitchYaw> {
   }
 };
 
+template <>
+struct convert<maliput::api::LanePosition> {
+  static Node encode(const maliput::api::LanePosition& rhs) {
+    return convert<maliput::math::Vector3>::encode(rhs.srh());
+  }
+
+  static bool decode(const Node& node, maliput::api::LanePosition& rhs) {
+    rhs = maliput::api::LanePosition::FromSrh(node.as<maliput::math::Vector3>());
+    return true;
+  }
+};
+
 }  // namespace YAML
 
 namespace maliput {
@@ -89,6 +107,106 @@ namespace {
 // TODO(#15): Decide to pass it as a construction argument or read it from the input file.
 constexpr const double kTolerance{1e-3};
 
+constexpr const char* kLaneAssociationsKey{"maliput_objects_lane_associations"};
+
+// Reload() rebuilds the spatial index once the objects it is out of date by exceed this fraction of the book.
+constexpr double kMaxStaleIndexFraction{0.25};
+
+// Parses a [min, max] sequence.
+std::pair<double, double> ParseRange(const YAML::Node& node) {
+  MALIPUT_THROW_UNLESS(node.IsSequence());
+  MALIPUT_THROW_UNLESS(node.size() == 2);
+  const std::pair<double, double> range{node[0].as<double>(), node[1].as<double>()};
+  MALIPUT_THROW_UNLESS(range.first <= range.second);
+  return range;
+}
+
+LaneFootprint ParseLaneFootprint(const YAML::Node& node) {
+  MALIPUT_THROW_UNLESS(node.IsMap());
+  MALIPUT_THROW_UNLESS(node["lane_id"].IsDefined());
+  MALIPUT_THROW_UNLESS(node["lane_position"].IsDefined());
+  MALIPUT_THROW_UNLESS(node["s_range"].IsDefined());
+  MALIPUT_THROW_UNLESS(node["r_range"].IsDefined());
+  const std::pair<double, double> s_range = ParseRange(node["s_range"]);
+  const std::pair<double, double> r_range = ParseRange(node["r_range"]);
+  return LaneFootprint{maliput::api::LaneId(node["lane_id"].as<std::string>()),
+                       node["lane_position"].as<maliput::api::LanePosition>(),
+                       s_range.first,
+                       s_range.second,
+                       r_range.first,
+                       r_range.second};
+}
+
+std::optional<ObjectLaneAssociations> ParseLaneAssociations(const YAML::Node& node) {
+  MALIPUT_THROW_UNLESS(node.IsMap());
+  const YAML::Node& lane_associations_node = node[kLaneAssociationsKey];
+  if (!lane_associations_node.IsDefined()) {
+    return std::nullopt;
+  }
+  MALIPUT_THROW_UNLESS(lane_associations_node.IsMap());
+  MALIPUT_THROW_UNLESS(lane_associations_node["road_network_hash"].IsDefined());
+  MALIPUT_THROW_UNLESS(lane_associations_node["objects"].IsDefined());
+  MALIPUT_THROW_UNLESS(lane_associations_node["objects"].IsMap());
+  ObjectLaneAssociations lane_associations{lane_associations_node["road_network_hash"].as<std::string>(), {}, {}};
+  for (const auto& object_node : lane_associations_node["objects"]) {
+    MALIPUT_THROW_UNLESS(object_node.second.IsSequence());
+    std::vector<LaneFootprint>& footprints =
+        lane_associations.footprints[api::Object<maliput::math::Vector3>::Id(object_node.first.as<std::string>())];
+    for (const auto& footprint_node : object_node.second) {
+      footprints.push_back(ParseLaneFootprint(footprint_node));
+    }
+  }
+  // Documents written by previous versions carry no object hashes.
+  const YAML::Node& object_hashes_node = lane_associations_node["object_hashes"];
+  if (object_hashes_node.IsDefined()) {
+    MALIPUT_THROW_UNLESS(object_hashes_node.IsMap());
+    for (const auto& object_hash_node : object_hashes_node) {
+      lane_associations.object_hashes.emplace(
+          api::Object<maliput::math::Vector3>::Id(object_hash_node.first.as<std::string>()),
+          object_hash_node.second.as<std::string>());
+    }
+  }
+  return lane_associations;
+}
+
+YAML::Node EncodeLaneAssociations(const ObjectLaneAssociations& lane_associations) {
+  // Objects are sorted by id to emit the same document for the same associations.
+  std::map<std::string, const std::vector<LaneFootprint>*> sorted_footprints;
+  for (const auto& id_footprints : lane_associations.footprints) {
+    sorted_footprints.emplace(id_footprints.first.string(), &id_footprints.second);
+  }
+  YAML::Node objects_node(YAML::NodeType::Map);
+  for (const auto& id_footprints : sorted_footprints) {
+    YAML::Node footprints_node(YAML::NodeType::Sequence);
+    for (const LaneFootprint& footprint : *id_footprints.second) {
+      YAML::Node footprint_node;
+      footprint_node["lane_id"] = footprint.lane_id.string();
+      footprint_node["lane_position"] = footprint.lane_position;
+      footprint_node["s_range"].push_back(footprint.s_min);
+      footprint_node["s_range"].push_back(footprint.s_max);
+      footprint_node["r_range"].push_back(footprint.r_min);
+      footprint_node["r_range"].push_back(footprint.r_max);
+      footprints_node.push_back(footprint_node);
+    }
+    objects_node[id_footprints.first] = footprints_node;
+  }
+  std::map<std::string, std::string> sorted_object_hashes;
+  for (const auto& id_hash : lane_associations.object_hashes) {
+    sorted_object_hashes.emplace(id_hash.first.string(), id_hash.second);
+  }
+  YAML::Node node;
+  node["road_network_hash"] = lane_associations.road_network_hash;
+  node["objects"] = objects_node;
+  if (!sorted_object_hashes.empty()) {
+    YAML::Node object_hashes_node(YAML::NodeType::Map);
+    for (const auto& id_hash : sorted_object_hashes) {
+      object_hashes_node[id_hash.first] = id_hash.second;
+    }
+    node["object_hashes"] = object_hashes_node;
+  }
+  return node;
+}
+
 std::unique_ptr<maliput::math::BoundingBox> ParseBoundingBox(const YAML::Node& node, double tolerance) {
   MALIPUT_THROW_UNLESS(node.IsMap());
   MALIPUT_THROW_UNLESS(node["position"].IsDefined());
@@ -124,14 +242,96 @@ std::unique_ptr<api::Object<maliput::math::Vector3>> ParseObject(const std::stri
                                                                std::move(bounding_box));
 }
 
-std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> BuildFrom(const YAML::Node& node) {
+std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> ParseObjects(const YAML::Node& node) {
+  MALIPUT_OBJECT_TRACE_SPAN("loader::ParseObjects");
   MALIPUT_THROW_UNLESS(node.IsMap());
   const YAML::Node& objects_node = node["maliput_objects"];
   MALIPUT_THROW_UNLESS(objects_node.IsDefined());
   MALIPUT_THROW_UNLESS(objects_node.IsMap());
-  auto object_book = std::make_unique<ManualObjectBook<maliput::math::Vector3>>();
+  std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> objects;
+  objects.reserve(objects_node.size());
   for (const auto& object_node : objects_node) {
-    object_book->AddObject(ParseObject(object_node.first.as<std::string>(), object_node.second, kTolerance));
+    objects.push_back(ParseObject(object_node.first.as<std::string>(), object_node.second, kTolerance));
+  }
+  return objects;
+}
+
+// @returns Whether @p lhs and @p rhs have the same bounding region and properties, which are the contents described by
+// the document.
+bool HaveSameContents(const api::Object<maliput::math::Vector3>& lhs, const api::Object<maliput::math::Vector3>& rhs) {
+  return BoundingRegionSnapshot(lhs.bounding_region()).Matches(rhs.bounding_region()) &&
+         lhs.get_properties() == rhs.get_properties();
+}
+
+YAML::Node ParseYaml(const std::string& input) {
+  MALIPUT_OBJECT_TRACE_SPAN("loader::ParseYaml");
+  return YAML::Load(input);
+}
+
+YAML::Node ParseYamlFile(const std::string& filename) {
+  MALIPUT_OBJECT_TRACE_SPAN("loader::ParseYaml");
+  return YAML::LoadFile(filename);
+}
+
+ReloadResult ReloadFrom(const YAML::Node& node, maliput::object::api::ObjectBook<maliput::math::Vector3>* object_book) {
+  MALIPUT_OBJECT_TRACE_SPAN("loader::Reload");
+  MALIPUT_THROW_UNLESS(object_book != nullptr);
+  auto* manual_object_book = dynamic_cast<ManualObjectBook<maliput::math::Vector3>*>(object_book);
+  MALIPUT_THROW_UNLESS(manual_object_book != nullptr);
+  // Parses the whole document before touching the book so that schema errors leave it untouched.
+  std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> objects = ParseObjects(node);
+
+  MALIPUT_OBJECT_TRACE_SPAN("loader::ApplyDifferences");
+  ReloadResult result;
+  std::unordered_set<api::Object<maliput::math::Vector3>::Id> ids;
+  for (const auto& object : objects) {
+    ids.insert(object->id());
+  }
+  for (const auto& id_object : object_book->objects()) {
+    if (ids.find(id_object.first) == ids.end()) {
+      result.removed.push_back(id_object.first);
+      manual_object_book->RemoveObject(id_object.first);
+    }
+  }
+  for (auto& object : objects) {
+    const api::Object<maliput::math::Vector3>* current_object = object_book->FindById(object->id());
+    if (current_object == nullptr) {
+      result.added.push_back(object->id());
+    } else if (!HaveSameContents(*current_object, *object)) {
+      result.changed.push_back(object->id());
+      manual_object_book->RemoveObject(object->id());
+    } else {
+      continue;
+    }
+    manual_object_book->AddObject(std::move(object));
+  }
+  // Objects added one at a time are checked linearly and removed ones are kept in the index, so it is rebuilt once
+  // they make up a large enough part of the book.
+  if (manual_object_book->num_stale_index_entries() > kMaxStaleIndexFraction * object_book->objects().size()) {
+    MALIPUT_OBJECT_TRACE_SPAN("loader::RebuildIndex");
+    manual_object_book->AddObjects({});
+  }
+
+  const auto by_id = [](const auto& lhs, const auto& rhs) { return lhs.string() < rhs.string(); };
+  std::sort(result.added.begin(), result.added.end(), by_id);
+  std::sort(result.removed.begin(), result.removed.end(), by_id);
+  std::sort(result.changed.begin(), result.changed.end(), by_id);
+  return result;
+}
+
+std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> BuildFrom(const YAML::Node& node,
+                                                                                    const LoadOptions& options) {
+  MALIPUT_OBJECT_TRACE_SPAN("loader::Build");
+  std::vector<std::unique_ptr<api::Object<maliput::math::Vector3>>> objects = ParseObjects(node);
+  auto object_book = std::make_unique<ManualObjectBook<maliput::math::Vector3>>(kTolerance);
+  // Bulk loads the spatial index once every object is available.
+  if (options.build_index_in_background) {
+    object_book->AddObjectsAsync(std::move(objects), options.on_index_ready);
+  } else {
+    object_book->AddObjects(std::move(objects));
+    if (options.on_index_ready) {
+      options.on_index_ready();
+    }
   }
   return object_book;
 }
@@ -139,11 +339,47 @@ std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> BuildF
 }  // namespace
 
 std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> Load(const std::string& input) {
-  return BuildFrom(YAML::Load(input));
+  return Load(input, LoadOptions{});
+}
+
+std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> Load(const std::string& input,
+                                                                               const LoadOptions& options) {
+  return BuildFrom(ParseYaml(input), options);
 }
 
 std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> LoadFile(const std::string& filename) {
-  return BuildFrom(YAML::LoadFile(filename));
+  return LoadFile(filename, LoadOptions{});
+}
+
+std::unique_ptr<maliput::object::api::ObjectBook<maliput::math::Vector3>> LoadFile(const std::string& filename,
+                                                                                   const LoadOptions& options) {
+  return BuildFrom(ParseYamlFile(filename), options);
+}
+
+ReloadResult Reload(const std::string& input, maliput::object::api::ObjectBook<maliput::math::Vector3>* object_book) {
+  return ReloadFrom(ParseYaml(input), object_book);
+}
+
+ReloadResult ReloadFile(const std::string& filename,
+                        maliput::object::api::ObjectBook<maliput::math::Vector3>* object_book) {
+  return ReloadFrom(ParseYamlFile(filename), object_book);
+}
+
+std::optional<ObjectLaneAssociations> LoadLaneAssociations(const std::string& input) {
+  return ParseLaneAssociations(ParseYaml(input));
+}
+
+std::optional<ObjectLaneAssociations> LoadLaneAssociationsFile(const std::string& filename) {
+  return ParseLaneAssociations(ParseYamlFile(filename));
+}
+
+std::string AddLaneAssociations(const std::string& input, const ObjectLaneAssociations& lane_associations) {
+  YAML::Node node = YAML::Load(input);
+  MALIPUT_THROW_UNLESS(node.IsMap());
+  node[kLaneAssociationsKey] = EncodeLaneAssociations(lane_associations);
+  YAML::Emitter emitter;
+  emitter << node;
+  return emitter.c_str();
 }
 
 }  // namespace loader
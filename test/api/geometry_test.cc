@@ -0,0 +1,133 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/api/geometry.h"
+
+#include <cmath>
+#include <optional>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/test_utilities/mock_math.h"
+
+namespace maliput {
+namespace object {
+namespace api {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+TEST(ComputeDistanceTest, BoundingBox) {
+  const BoundingBox rotated_box{Vector3{1., 2., 3.}, Vector3{2., 4., 2.}, RollPitchYaw{0., 0., M_PI / 2.}, kTolerance};
+  EXPECT_DOUBLE_EQ(0., ComputeDistance<Vector3>(rotated_box, Vector3{1.5, 2.5, 3.}));
+  // The box spans 4 meters along the x axis and 2 meters along the y axis once rotated.
+  EXPECT_NEAR(1., ComputeDistance<Vector3>(rotated_box, Vector3{4., 2., 3.}), 1e-12);
+  EXPECT_NEAR(2., ComputeDistance<Vector3>(rotated_box, Vector3{1., 5., 3.}), 1e-12);
+  EXPECT_NEAR(std::sqrt(2.), ComputeDistance<Vector3>(rotated_box, Vector3{4., 4., 3.}), 1e-12);
+}
+
+TEST(ComputeDistanceTest, UnsupportedRegion) {
+  const Vector3 kPosition{1., 2., 3.};
+  test_utilities::MockBoundingRegion region;
+  EXPECT_CALL(region, do_position()).WillRepeatedly(::testing::ReturnRef(kPosition));
+  EXPECT_DOUBLE_EQ(5., ComputeDistance<Vector3>(region, Vector3{1., 5., 7.}));
+}
+
+TEST(ComputeDistanceTest, BoundingBoxes) {
+  const BoundingBox box{Vector3{0., 0., 0.}, Vector3{1., 1., 1.}, RollPitchYaw{0., 0., 0.}, kTolerance};
+  // Face to face, edge to edge along z and overlapping.
+  EXPECT_NEAR(1., ComputeDistance<Vector3>(box, BoundingBox{{2., 0., 0.}, {1., 1., 1.}, {0., 0., 0.}, kTolerance}),
+              1e-12);
+  EXPECT_NEAR(std::sqrt(2.),
+              ComputeDistance<Vector3>(box, BoundingBox{{2., 2., 0.}, {1., 1., 1.}, {0., 0., 0.}, kTolerance}), 1e-12);
+  EXPECT_DOUBLE_EQ(0.,
+                   ComputeDistance<Vector3>(box, BoundingBox{{0.8, 0., 0.}, {1., 1., 1.}, {0., 0., 0.}, kTolerance}));
+  // A vertex of the rotated box faces a face of the other one.
+  const BoundingBox yawed{Vector3{2., 0., 0.}, Vector3{1., 1., 1.}, RollPitchYaw{0., 0., M_PI / 4.}, kTolerance};
+  EXPECT_NEAR(1.5 - std::sqrt(0.5), ComputeDistance<Vector3>(box, yawed), 1e-12);
+  EXPECT_NEAR(1.5 - std::sqrt(0.5), ComputeDistance<Vector3>(yawed, box), 1e-12);
+  // The closest points lie in the middle of crossing edges: the top edge of the rolled box runs along x and the bottom
+  // edge of the pitched box runs along y.
+  const BoundingBox rolled{Vector3{0., 0., 0.}, Vector3{1., 1., 1.}, RollPitchYaw{M_PI / 4., 0., 0.}, kTolerance};
+  const BoundingBox pitched{Vector3{0., 0., 2.}, Vector3{1., 1., 1.}, RollPitchYaw{0., M_PI / 4., 0.}, kTolerance};
+  EXPECT_NEAR(2. - std::sqrt(2.), ComputeDistance<Vector3>(rolled, pitched), 1e-12);
+}
+
+TEST(ComputeRayIntersectionTest, BoundingBox) {
+  // A 2 x 2 x 2 box rotated 45 degrees around z, whose closest vertex along the x axis is at x = 5 - sqrt(2).
+  const BoundingBox box{{5., 0., 0.}, {2., 2., 2.}, {0., 0., M_PI / 4.}, kTolerance};
+  const std::optional<double> distance = ComputeRayIntersection<Vector3>(box, {{0., 0., 0.}, {1., 0., 0.}, 10.});
+  ASSERT_TRUE(distance.has_value());
+  EXPECT_NEAR(5. - std::sqrt(2.), distance.value(), 1e-12);
+  EXPECT_EQ(std::nullopt, ComputeRayIntersection<Vector3>(box, {{0., 0., 0.}, {1., 0., 0.}, 3.}));
+  // Along x + y = 3, which runs parallel to one of the faces of the box without reaching it.
+  const Vector3 kDirection = Vector3{1., -1., 0.}.normalized();
+  EXPECT_EQ(std::nullopt, ComputeRayIntersection<Vector3>(box, {{2.8, 0.2, 0.}, kDirection, 10.}));
+  // A ray starting inside the box hits it at its origin.
+  EXPECT_EQ(0., ComputeRayIntersection<Vector3>(box, {{5., 0., 0.}, {0., 1., 0.}, 10.}));
+}
+
+TEST(ComputeRayIntersectionTest, UnsupportedRegion) {
+  const test_utilities::MockBoundingRegion region;
+  EXPECT_EQ(std::nullopt, ComputeRayIntersection<Vector3>(region, {{0., 0., 0.}, {1., 0., 0.}, 10.}));
+}
+
+TEST(OverlapsFrustumTest, BoundingBox) {
+  // The half space x + y >= 4.7, which the rotated box reaches up to x + y = 3 + sqrt(2) and the aligned one up to 5.
+  const Frustum<Vector3> kFrustum{{{Vector3{1., 1., 0.}.normalized(), -4.7 / std::sqrt(2.)}}};
+  const BoundingBox kRotated{{1.5, 1.5, 0.}, {2., 2., 2.}, {0., 0., M_PI / 4.}, kTolerance};
+  const BoundingBox kAligned{{1.5, 1.5, 0.}, {2., 2., 2.}, {0., 0., 0.}, kTolerance};
+  EXPECT_FALSE(OverlapsFrustum<Vector3>(kRotated, kFrustum));
+  EXPECT_TRUE(OverlapsFrustum<Vector3>(kAligned, kFrustum));
+}
+
+TEST(OverlapsFrustumTest, UnsupportedRegion) {
+  const Frustum<Vector3> kFrustum{{{{1., 0., 0.}, -5.}}};
+  const Vector3 kInside{6., 0., 0.};
+  const Vector3 kOutside{4., 0., 0.};
+  test_utilities::MockBoundingRegion region;
+  EXPECT_CALL(region, do_position()).WillOnce(::testing::ReturnRef(kInside)).WillOnce(::testing::ReturnRef(kOutside));
+  EXPECT_TRUE(OverlapsFrustum<Vector3>(region, kFrustum));
+  EXPECT_FALSE(OverlapsFrustum<Vector3>(region, kFrustum));
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace api
+}  // namespace object
+}  // namespace maliput
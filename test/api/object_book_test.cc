@@ -29,15 +29,21 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_object/api/object_book.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
 #include <maliput/math/bounding_region.h>
+#include <maliput/math/roll_pitch_yaw.h>
 #include <maliput/math/vector.h>
 
 #include "maliput_object/api/object.h"
@@ -52,6 +58,67 @@ namespace {
 
 using maliput::math::Vector3;
 
+// Implements only the methods without a default implementation, checking every Object.
+class MinimalObjectBook : public ObjectBook<Vector3> {
+ public:
+  explicit MinimalObjectBook(std::vector<std::unique_ptr<Object<Vector3>>> objects) : objects_(std::move(objects)) {}
+
+ private:
+  std::unordered_map<Object<Vector3>::Id, Object<Vector3>*> do_objects() const override {
+    std::unordered_map<Object<Vector3>::Id, Object<Vector3>*> objects;
+    for (const auto& object : objects_) {
+      objects.emplace(object->id(), object.get());
+    }
+    return objects;
+  }
+  Object<Vector3>* DoFindById(const Object<Vector3>::Id& object_id) const override {
+    for (const auto& object : objects_) {
+      if (object->id() == object_id) {
+        return object.get();
+      }
+    }
+    return nullptr;
+  }
+  std::vector<Object<Vector3>*> DoFindByPredicate(
+      std::function<bool(const Object<Vector3>*)> predicate) const override {
+    std::vector<Object<Vector3>*> objects;
+    for (const auto& object : objects_) {
+      if (predicate(object.get())) {
+        objects.push_back(object.get());
+      }
+    }
+    return objects;
+  }
+  std::vector<Object<Vector3>*> DoFindOverlappingIn(
+      const maliput::math::BoundingRegion<Vector3>& region,
+      const maliput::math::OverlappingType& overlapping_type) const override {
+    std::vector<Object<Vector3>*> objects;
+    for (const auto& object : objects_) {
+      if ((region.Overlaps(object->bounding_region()) & overlapping_type) !=
+          maliput::math::OverlappingType::kDisjointed) {
+        objects.push_back(object.get());
+      }
+    }
+    return objects;
+  }
+
+  std::vector<std::unique_ptr<Object<Vector3>>> objects_;
+};
+
+std::unique_ptr<Object<Vector3>> MakeBoxObject(const std::string& id, const Vector3& position) {
+  return std::make_unique<Object<Vector3>>(
+      Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+      std::make_unique<maliput::math::BoundingBox>(position, Vector3{2., 2., 2.}, maliput::math::RollPitchYaw{}, 1e-3));
+}
+
+std::vector<std::string> ToIds(const std::vector<Object<Vector3>*>& objects) {
+  std::vector<std::string> ids;
+  for (const Object<Vector3>* object : objects) {
+    ids.push_back(object->id().string());
+  }
+  return ids;
+}
+
 TEST(ObjectBookTest, API) {
   test_utilities::MockObjectBook<Vector3> dut;
   const api::Object<Vector3>::Id kId{"id"};
@@ -76,6 +143,159 @@ TEST(ObjectBookTest, API) {
   EXPECT_EQ(kExpectedObjectsByOverlapping, dut.FindOverlappingIn(kBoundingRegion, kOverlappingType));
 }
 
+TEST(ObjectBookTest, DistanceQueries) {
+  test_utilities::MockObjectBook<Vector3> dut;
+  const Vector3 kPosition{1., 2., 3.};
+  std::unique_ptr<api::Object<Vector3>> object = std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id("id"), std::map<std::string, std::string>{},
+      std::make_unique<test_utilities::MockBoundingRegion>());
+  const std::vector<api::Object<Vector3>*> kExpectedObjects{object.get()};
+  EXPECT_CALL(dut, DoFindNearest(kPosition, 3, ::testing::_)).Times(1).WillOnce(::testing::Return(kExpectedObjects));
+  EXPECT_CALL(dut, DoFindWithinDistance(kPosition, 10.)).Times(1).WillOnce(::testing::Return(kExpectedObjects));
+  EXPECT_EQ(kExpectedObjects, dut.FindNearest(kPosition, 3));
+  EXPECT_EQ(kExpectedObjects, dut.FindWithinDistance(kPosition, 10.));
+  EXPECT_THROW(dut.FindNearest(kPosition, -1), maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindWithinDistance(kPosition, -1.), maliput::common::assertion_error);
+}
+
+// Distance queries check every Object by default.
+TEST(ObjectBookTest, DefaultDistanceQueries) {
+  std::vector<std::unique_ptr<Object<Vector3>>> objects;
+  objects.push_back(MakeBoxObject("far", {20., 0., 0.}));
+  objects.push_back(MakeBoxObject("b", {5., 0., 0.}));
+  objects.push_back(MakeBoxObject("a", {-5., 0., 0.}));
+  objects.push_back(MakeBoxObject("containing", {0.5, 0., 0.}));
+  const MinimalObjectBook dut(std::move(objects));
+  const Vector3 kPosition{0., 0., 0.};
+  EXPECT_EQ((std::vector<std::string>{"containing", "a", "b"}), ToIds(dut.FindNearest(kPosition, 3)));
+  EXPECT_EQ((std::vector<std::string>{"a", "b", "far"}),
+            ToIds(dut.FindNearest(kPosition, 5, [](const Object<Vector3>* object) {
+              return object->id().string() != "containing";
+            })));
+  EXPECT_TRUE(dut.FindNearest(kPosition, 0).empty());
+  // "a" and "b" are 4 meters away, ties are sorted by id.
+  EXPECT_EQ((std::vector<std::string>{"containing", "a", "b"}), ToIds(dut.FindWithinDistance(kPosition, 4.)));
+  EXPECT_EQ((std::vector<std::string>{"containing"}), ToIds(dut.FindWithinDistance(kPosition, 3.9)));
+}
+
+TEST(ObjectBookTest, DefaultRayAndFrustumQueries) {
+  std::vector<std::unique_ptr<Object<Vector3>>> objects;
+  objects.push_back(MakeBoxObject("near", Vector3{4., 0., 0.}));
+  objects.push_back(MakeBoxObject("b", Vector3{8., 0., 0.}));
+  objects.push_back(MakeBoxObject("a", Vector3{8., 0., 1.}));
+  objects.push_back(MakeBoxObject("off_axis", Vector3{4., 5., 0.}));
+  const MinimalObjectBook dut(std::move(objects));
+  const std::vector<RayHit<Vector3>> hits = dut.RayCastAll({0., 0., 0.}, {2., 0., 0.}, 20.);
+  ASSERT_EQ(3u, hits.size());
+  EXPECT_EQ("near", hits[0].object->id().string());
+  EXPECT_NEAR(3., hits[0].distance, 1e-12);
+  // "a" and "b" are both hit 7 meters away, ties are sorted by id.
+  EXPECT_EQ("a", hits[1].object->id().string());
+  EXPECT_EQ("b", hits[2].object->id().string());
+  EXPECT_TRUE(dut.RayCastAll({0., 0., 0.}, {1., 0., 0.}, 2.).empty());
+  const std::vector<std::optional<RayHit<Vector3>>> closest_hits =
+      dut.RayCast(std::vector<Ray<Vector3>>{{{10., 0., 0.}, {-1., 0., 0.}, 20.}, {{0., 0., 0.}, {0., 0., 1.}, 20.}});
+  ASSERT_EQ(2u, closest_hits.size());
+  ASSERT_TRUE(closest_hits[0].has_value());
+  EXPECT_EQ("a", closest_hits[0]->object->id().string());
+  EXPECT_NEAR(1., closest_hits[0]->distance, 1e-12);
+  EXPECT_EQ(std::nullopt, closest_hits[1]);
+  // The half space x >= 6.
+  const Frustum<Vector3> kFrustum{{{{1., 0., 0.}, -6.}}};
+  std::vector<std::string> ids = ToIds(dut.FindInFrustum(kFrustum));
+  std::sort(ids.begin(), ids.end());
+  EXPECT_EQ((std::vector<std::string>{"a", "b"}), ids);
+}
+
+TEST(ObjectBookTest, RayAndFrustumQueries) {
+  test_utilities::MockObjectBook<Vector3> dut;
+  std::unique_ptr<api::Object<Vector3>> object = std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id("id"), std::map<std::string, std::string>{},
+      std::make_unique<test_utilities::MockBoundingRegion>());
+  const std::vector<api::RayHit<Vector3>> kExpectedHits{{object.get(), 2.}};
+  const std::vector<api::Object<Vector3>*> kExpectedObjects{object.get()};
+  const api::Frustum<Vector3> kFrustum{{{{1., 0., 0.}, -1.}}};
+  // Directions are normalized before reaching the implementation.
+  const auto is_unit_x = [](const api::Ray<Vector3>& ray) {
+    return ray.direction == Vector3{1., 0., 0.} && ray.max_range == 10.;
+  };
+  EXPECT_CALL(dut, DoRayCastAll(::testing::Truly(is_unit_x))).Times(1).WillOnce(::testing::Return(kExpectedHits));
+  EXPECT_CALL(dut, DoRayCast(::testing::_, ::testing::_))
+      .Times(1)
+      .WillOnce([&is_unit_x, &object](const std::vector<api::Ray<Vector3>>& rays,
+                                      std::vector<std::optional<api::RayHit<Vector3>>>* hits) {
+        ASSERT_EQ(1u, rays.size());
+        EXPECT_TRUE(is_unit_x(rays.front()));
+        ASSERT_EQ(1u, hits->size());
+        hits->front() = api::RayHit<Vector3>{object.get(), 2.};
+      });
+  EXPECT_CALL(dut, DoFindInFrustum(::testing::_)).Times(1).WillOnce(::testing::Return(kExpectedObjects));
+  const std::vector<api::RayHit<Vector3>> hits = dut.RayCastAll({0., 0., 0.}, {5., 0., 0.}, 10.);
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(object.get(), hits.front().object);
+  const std::optional<api::RayHit<Vector3>> hit = dut.RayCast({0., 0., 0.}, {5., 0., 0.}, 10.);
+  ASSERT_TRUE(hit.has_value());
+  EXPECT_EQ(2., hit->distance);
+  EXPECT_EQ(kExpectedObjects, dut.FindInFrustum(kFrustum));
+  EXPECT_THROW(dut.RayCast({0., 0., 0.}, {0., 0., 0.}, 10.), maliput::common::assertion_error);
+  EXPECT_THROW(dut.RayCastAll({0., 0., 0.}, {1., 0., 0.}, -1.), maliput::common::assertion_error);
+  const std::vector<api::Ray<Vector3>> kRaysWithZeroDirection{{{0., 0., 0.}, {1., 0., 0.}, 1.},
+                                                              {{0., 0., 0.}, {0., 0., 0.}, 1.}};
+  EXPECT_THROW(dut.RayCast(kRaysWithZeroDirection), maliput::common::assertion_error);
+}
+
+// Buffer and visitor overloads fall back to the allocating methods by default.
+TEST(ObjectBookTest, BufferAndVisitorOverloads) {
+  test_utilities::MockObjectBook<Vector3> dut;
+  const test_utilities::MockBoundingRegion kBoundingRegion{};
+  const maliput::math::OverlappingType kOverlappingType{maliput::math::OverlappingType::kIntersected};
+  std::unique_ptr<api::Object<Vector3>> object = std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id("id"), std::map<std::string, std::string>{},
+      std::make_unique<test_utilities::MockBoundingRegion>());
+  const std::vector<api::Object<Vector3>*> kExpectedObjects{object.get()};
+  const std::function<bool(const api::Object<Vector3>*)> kPredicate = [](const api::Object<Vector3>*) { return true; };
+  EXPECT_CALL(dut, DoFindByPredicate(::testing::_)).Times(2).WillRepeatedly(::testing::Return(kExpectedObjects));
+  EXPECT_CALL(dut, DoFindOverlappingIn(::testing::_, kOverlappingType))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(kExpectedObjects));
+
+  // Results are appended to the buffer.
+  std::vector<api::Object<Vector3>*> result{nullptr};
+  dut.FindByPredicate(kPredicate, &result);
+  dut.FindOverlappingIn(kBoundingRegion, kOverlappingType, &result);
+  EXPECT_EQ((std::vector<api::Object<Vector3>*>{nullptr, object.get(), object.get()}), result);
+
+  std::vector<api::Object<Vector3>*> visited;
+  const auto visitor = [&visited](api::Object<Vector3>* object) { visited.push_back(object); };
+  dut.VisitByPredicate(kPredicate, visitor);
+  dut.VisitOverlappingIn(kBoundingRegion, kOverlappingType, visitor);
+  EXPECT_EQ((std::vector<api::Object<Vector3>*>{object.get(), object.get()}), visited);
+
+  EXPECT_THROW(dut.FindByPredicate(kPredicate, nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindOverlappingIn(kBoundingRegion, kOverlappingType, nullptr), maliput::common::assertion_error);
+}
+
+// FindAllOverlappingPairs() looks up the Objects overlapping with every Object by default.
+TEST(ObjectBookTest, FindAllOverlappingPairs) {
+  test_utilities::MockObjectBook<Vector3> dut;
+  std::unique_ptr<api::Object<Vector3>> object_a = std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id("a"), std::map<std::string, std::string>{},
+      std::make_unique<test_utilities::MockBoundingRegion>());
+  std::unique_ptr<api::Object<Vector3>> object_b = std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id("b"), std::map<std::string, std::string>{},
+      std::make_unique<test_utilities::MockBoundingRegion>());
+  const std::unordered_map<api::Object<Vector3>::Id, api::Object<Vector3>*> kObjects{{object_a->id(), object_a.get()},
+                                                                                      {object_b->id(), object_b.get()}};
+  EXPECT_CALL(dut, do_objects()).Times(1).WillOnce(::testing::Return(kObjects));
+  EXPECT_CALL(dut, DoFindOverlappingIn(::testing::_, maliput::math::OverlappingType::kIntersected))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(std::vector<api::Object<Vector3>*>{object_a.get(), object_b.get()}));
+  const auto pairs = dut.FindAllOverlappingPairs();
+  ASSERT_EQ(1u, pairs.size());
+  EXPECT_EQ(object_a.get(), pairs.front().first);
+  EXPECT_EQ(object_b.get(), pairs.front().second);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace api
@@ -29,15 +29,24 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_object/api/object_query.h"
 
+#include <cmath>
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
 #include <maliput/api/lane.h>
 #include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
 #include <maliput/api/road_network.h>
+#include <maliput/math/bounding_box.h>
 #include <maliput/math/bounding_region.h>
+#include <maliput/math/roll_pitch_yaw.h>
 #include <maliput/math/vector.h>
 #include <maliput/test_utilities/mock.h>
 
@@ -51,6 +60,8 @@ namespace api {
 namespace test {
 namespace {
 
+using maliput::math::BoundingBox;
+using maliput::math::RollPitchYaw;
 using maliput::math::Vector3;
 
 class ObjectQueryTest : public ::testing::Test {
@@ -70,6 +81,21 @@ class ObjectQueryTest : public ::testing::Test {
       std::make_optional<>(maliput::api::test::CreateLaneSRoute())};
 };
 
+// Implements only the pure virtual methods of ObjectQuery, to test its default implementations.
+class MinimalObjectQuery : public ObjectQuery {
+ public:
+  MOCK_METHOD((std::vector<const maliput::api::Lane*>), DoFindOverlappingLanesIn, (const Object<Vector3>*),
+              (const, override));
+  MOCK_METHOD((std::vector<const maliput::api::Lane*>), DoFindOverlappingLanesIn,
+              (const Object<Vector3>*, const maliput::math::OverlappingType&), (const, override));
+  MOCK_METHOD((std::optional<const maliput::api::LaneSRoute>), DoRoute,
+              (const Object<Vector3>*, const Object<Vector3>*), (const, override));
+  MOCK_METHOD((const ObjectBook<Vector3>*), do_object_book, (), (const, override));
+  MOCK_METHOD((const maliput::api::RoadNetwork*), do_road_network, (), (const, override));
+
+  using ObjectQuery::ComputeLaneClearance;
+};
+
 // Tests ObjectBook API.
 TEST_F(ObjectQueryTest, API) {
   const test_utilities::MockObjectQuery dut;
@@ -90,6 +116,220 @@ TEST_F(ObjectQueryTest, API) {
   EXPECT_EQ(kExpectedRoute.value().length(), dut.Route(&kObject, &kObject).value().length());
 }
 
+TEST_F(ObjectQueryTest, RouteAvoiding) {
+  const test_utilities::MockObjectQuery dut;
+  const RouteAvoidance kAvoidance{[](const Object<Vector3>*) { return true; }, "all", RouteAvoidance::Mode::kPenalize,
+                                  100.};
+  EXPECT_CALL(dut, DoRoute(&kObject, &kObject, ::testing::_)).Times(1).WillOnce(::testing::Return(kExpectedRoute));
+  EXPECT_EQ(kExpectedRoute.value().length(), dut.Route(&kObject, &kObject, kAvoidance).value().length());
+  EXPECT_THROW(dut.Route(&kObject, &kObject, RouteAvoidance{}), maliput::common::assertion_error);
+  RouteAvoidance negative_penalty{kAvoidance};
+  negative_penalty.penalty = -1.;
+  EXPECT_THROW(dut.Route(&kObject, &kObject, negative_penalty), maliput::common::assertion_error);
+}
+
+TEST_F(ObjectQueryTest, FindObjectsOnLane) {
+  const test_utilities::MockObjectQuery dut;
+  const maliput::api::LaneId kLaneId{"lane_1"};
+  const std::vector<const Object<Vector3>*> kExpectedObjects{&kObject};
+  EXPECT_CALL(dut, DoFindObjectsOnLane(kLaneId, ::testing::_)).Times(1).WillOnce(::testing::Return(kExpectedObjects));
+  EXPECT_EQ(kExpectedObjects, dut.FindObjectsOnLane(kLaneId, maliput::api::SRange(10., 20.)));
+}
+
+TEST_F(ObjectQueryTest, DefaultFindObjectsOnLane) {
+  test_utilities::MockObjectBook<Vector3> object_book;
+  Object<Vector3> object{Object<Vector3>::Id{"off_lane"}, {}, std::make_unique<test_utilities::MockBoundingRegion>()};
+  const std::unordered_map<Object<Vector3>::Id, Object<Vector3>*> kObjects{{object.id(), &object}};
+  EXPECT_CALL(object_book, do_objects()).WillRepeatedly(::testing::Return(kObjects));
+  const MinimalObjectQuery dut;
+  EXPECT_CALL(dut, do_object_book()).WillRepeatedly(::testing::Return(&object_book));
+  // Every Object is checked against the Lane.
+  EXPECT_CALL(dut, DoFindOverlappingLanesIn(&object, maliput::math::OverlappingType::kIntersected))
+      .Times(1)
+      .WillOnce(::testing::Return(std::vector<const maliput::api::Lane*>{}));
+  EXPECT_TRUE(dut.FindObjectsOnLane(maliput::api::LaneId{"lane_1"}, maliput::api::SRange(10., 20.)).empty());
+}
+
+TEST_F(ObjectQueryTest, DefaultFindFreeGaps) {
+  test_utilities::MockObjectBook<Vector3> object_book;
+  EXPECT_CALL(object_book, do_objects())
+      .WillRepeatedly(::testing::Return(std::unordered_map<Object<Vector3>::Id, Object<Vector3>*>{}));
+  const MinimalObjectQuery dut;
+  EXPECT_CALL(dut, do_object_book()).WillRepeatedly(::testing::Return(&object_book));
+  const std::vector<maliput::api::SRange> gaps =
+      dut.FindFreeGaps(maliput::api::LaneId{"lane_1"}, maliput::api::SRange(20., 10.), 5.);
+  // The whole range is free, as a range of increasing s-coordinates.
+  ASSERT_EQ(1u, gaps.size());
+  EXPECT_EQ(10., gaps.front().s0());
+  EXPECT_EQ(20., gaps.front().s1());
+  EXPECT_TRUE(dut.FindFreeGaps(maliput::api::LaneId{"lane_1"}, maliput::api::SRange(10., 20.), 11.).empty());
+}
+
+TEST_F(ObjectQueryTest, DefaultFindObjectsAlongRoute) {
+  test_utilities::MockObjectBook<Vector3> object_book;
+  Object<Vector3> object{Object<Vector3>::Id{"off_lane"}, {}, std::make_unique<test_utilities::MockBoundingRegion>()};
+  const std::unordered_map<Object<Vector3>::Id, Object<Vector3>*> kObjects{{object.id(), &object}};
+  EXPECT_CALL(object_book, do_objects()).WillRepeatedly(::testing::Return(kObjects));
+  const MinimalObjectQuery dut;
+  EXPECT_CALL(dut, do_object_book()).WillRepeatedly(::testing::Return(&object_book));
+  // The Lanes of every Object are found once, whatever the number of ranges.
+  EXPECT_CALL(dut, DoFindOverlappingLanesIn(&object, maliput::math::OverlappingType::kIntersected))
+      .Times(1)
+      .WillOnce(::testing::Return(std::vector<const maliput::api::Lane*>{}));
+  EXPECT_TRUE(dut.FindObjectsAlongRoute(maliput::api::LaneSRoute{}, 1.).empty());
+}
+
+TEST_F(ObjectQueryTest, DefaultFindNearestNeighbors) {
+  test_utilities::MockObjectBook<Vector3> object_book;
+  Object<Vector3> object{Object<Vector3>::Id{"object"}, {},
+                         std::make_unique<BoundingBox>(Vector3{0., 0., 0.}, Vector3{2., 2., 2.}, RollPitchYaw{}, 1e-3)};
+  Object<Vector3> near{Object<Vector3>::Id{"near"}, {},
+                       std::make_unique<BoundingBox>(Vector3{3., 0., 0.}, Vector3{2., 2., 2.}, RollPitchYaw{}, 1e-3)};
+  Object<Vector3> far{Object<Vector3>::Id{"far"}, {},
+                      std::make_unique<BoundingBox>(Vector3{0., 4., 0.}, Vector3{2., 2., 2.}, RollPitchYaw{}, 1e-3)};
+  Object<Vector3> beyond{Object<Vector3>::Id{"beyond"}, {},
+                         std::make_unique<BoundingBox>(Vector3{0., 0., 6.}, Vector3{2., 2., 2.}, RollPitchYaw{}, 1e-3)};
+  // The search radius is widened by half the diagonal of the box of the Object.
+  EXPECT_CALL(object_book, DoFindWithinDistance(Vector3{0., 0., 0.}, ::testing::DoubleEq(3. + std::sqrt(3.))))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(std::vector<Object<Vector3>*>{&beyond, &far, &object, &near}));
+  const MinimalObjectQuery dut;
+  EXPECT_CALL(dut, do_object_book()).WillRepeatedly(::testing::Return(&object_book));
+  // The Object itself and the Objects farther than the maximum distance are skipped.
+  const std::vector<ObjectDistance> neighbors = dut.FindNearestNeighbors(&object, 3, 3.);
+  ASSERT_EQ(2u, neighbors.size());
+  EXPECT_EQ(&near, neighbors[0].object);
+  EXPECT_NEAR(1., neighbors[0].distance, 1e-12);
+  EXPECT_EQ(&far, neighbors[1].object);
+  EXPECT_NEAR(2., neighbors[1].distance, 1e-12);
+  ASSERT_EQ(1u, dut.FindNearestNeighbors(&object, 1, 3.).size());
+}
+
+// ComputeLaneClearance() only reports the Lane back, it does not query it.
+TEST_F(ObjectQueryTest, ComputeLaneClearance) {
+  const maliput::api::RBounds kBounds{-2., 2.};
+  EXPECT_THROW(MinimalObjectQuery::ComputeLaneClearance(lane_.get(), {}, 1.), maliput::common::assertion_error);
+
+  // Within the Lane.
+  const std::vector<std::pair<double, maliput::api::RBounds>> kWithin{{0.5, kBounds}, {1., kBounds}, {0.75, kBounds}};
+  std::optional<LaneClearance> clearance = MinimalObjectQuery::ComputeLaneClearance(lane_.get(), kWithin, 1.5);
+  ASSERT_TRUE(clearance.has_value());
+  EXPECT_EQ(lane_.get(), clearance->lane);
+  EXPECT_NEAR(1., clearance->left, 1e-12);
+  EXPECT_NEAR(2.5, clearance->right, 1e-12);
+  // Both lane bounds are farther than the maximum distance.
+  EXPECT_FALSE(MinimalObjectQuery::ComputeLaneClearance(lane_.get(), kWithin, 0.5).has_value());
+
+  // Crossing the left lane bound, which is wider at the second sample.
+  const std::vector<std::pair<double, maliput::api::RBounds>> kCrossing{{2.5, kBounds},
+                                                                       {2.5, maliput::api::RBounds{-3., 3.}}};
+  clearance = MinimalObjectQuery::ComputeLaneClearance(lane_.get(), kCrossing, 0.);
+  ASSERT_TRUE(clearance.has_value());
+  EXPECT_NEAR(-0.5, clearance->left, 1e-12);
+  EXPECT_NEAR(4.5, clearance->right, 1e-12);
+
+  // Beside the Lane, 1 beyond the right lane bound.
+  const std::vector<std::pair<double, maliput::api::RBounds>> kBeside{{-3., kBounds}, {-4., kBounds}};
+  clearance = MinimalObjectQuery::ComputeLaneClearance(lane_.get(), kBeside, 1.);
+  ASSERT_TRUE(clearance.has_value());
+  EXPECT_NEAR(5., clearance->left, 1e-12);
+  EXPECT_NEAR(-2., clearance->right, 1e-12);
+  // The Lane is farther than the maximum distance.
+  EXPECT_FALSE(MinimalObjectQuery::ComputeLaneClearance(lane_.get(), kBeside, 0.99).has_value());
+}
+
+TEST_F(ObjectQueryTest, FindFreeGaps) {
+  const test_utilities::MockObjectQuery dut;
+  const maliput::api::LaneId kLaneId{"lane_1"};
+  const std::vector<maliput::api::SRange> kExpectedGaps{maliput::api::SRange(10., 20.)};
+  EXPECT_CALL(dut, DoFindFreeGaps(kLaneId, ::testing::_, 5.)).Times(1).WillOnce(::testing::Return(kExpectedGaps));
+  const std::vector<maliput::api::SRange> gaps = dut.FindFreeGaps(kLaneId, maliput::api::SRange(0., 30.), 5.);
+  ASSERT_EQ(1u, gaps.size());
+  EXPECT_EQ(10., gaps.front().s0());
+  EXPECT_EQ(20., gaps.front().s1());
+  EXPECT_THROW(dut.FindFreeGaps(kLaneId, maliput::api::SRange(0., 30.), -1.), maliput::common::assertion_error);
+}
+
+TEST_F(ObjectQueryTest, FindObjectsAlongRoute) {
+  const test_utilities::MockObjectQuery dut;
+  const std::vector<ObjectAlongRoute> kExpectedObjects{{&kObject, 12.}};
+  EXPECT_CALL(dut, DoFindObjectsAlongRoute(::testing::_, 1.5)).Times(1).WillOnce(::testing::Return(kExpectedObjects));
+  const std::vector<ObjectAlongRoute> objects = dut.FindObjectsAlongRoute(kExpectedRoute.value(), 1.5);
+  ASSERT_EQ(1u, objects.size());
+  EXPECT_EQ(&kObject, objects.front().object);
+  EXPECT_EQ(12., objects.front().route_s);
+  EXPECT_THROW(dut.FindObjectsAlongRoute(kExpectedRoute.value(), -1.), maliput::common::assertion_error);
+}
+
+TEST_F(ObjectQueryTest, FindNextObjectsAhead) {
+  const test_utilities::MockObjectQuery dut;
+  const maliput::api::RoadPosition kRoadPosition{lane_.get(), maliput::api::LanePosition(5., 0., 0.)};
+  const std::vector<ObjectAhead> kExpectedObjects{{&kObject, 25., lane_.get()}};
+  EXPECT_CALL(dut, DoFindNextObjectsAhead(::testing::_, 100., ::testing::_))
+      .Times(1)
+      .WillOnce(::testing::Return(kExpectedObjects));
+  const std::vector<ObjectAhead> objects = dut.FindNextObjectsAhead(kRoadPosition, 100.);
+  ASSERT_EQ(1u, objects.size());
+  EXPECT_EQ(&kObject, objects.front().object);
+  EXPECT_EQ(25., objects.front().gap);
+  EXPECT_EQ(lane_.get(), objects.front().lane);
+  EXPECT_THROW(dut.FindNextObjectsAhead(kRoadPosition, -1.), maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindNextObjectsAhead(maliput::api::RoadPosition(), 100.), maliput::common::assertion_error);
+}
+
+TEST_F(ObjectQueryTest, FindNearestNeighbors) {
+  const test_utilities::MockObjectQuery dut;
+  const std::vector<const Object<Vector3>*> kObjects{&kObject};
+  const std::vector<std::vector<ObjectDistance>> kExpectedNeighbors{{{&kObject, 2.5}}};
+  EXPECT_CALL(dut, DoFindNearestNeighbors(kObjects, 3, 10.))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(kExpectedNeighbors));
+  const std::vector<ObjectDistance> neighbors = dut.FindNearestNeighbors(&kObject, 3, 10.);
+  ASSERT_EQ(1u, neighbors.size());
+  EXPECT_EQ(&kObject, neighbors.front().object);
+  EXPECT_EQ(2.5, neighbors.front().distance);
+  EXPECT_EQ(1u, dut.FindNearestNeighbors(kObjects, 3, 10.).size());
+  EXPECT_THROW(dut.FindNearestNeighbors(nullptr, 3, 10.), maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindNearestNeighbors(&kObject, -1, 10.), maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindNearestNeighbors(&kObject, 3, -1.), maliput::common::assertion_error);
+}
+
+TEST_F(ObjectQueryTest, FindLaneClearances) {
+  const test_utilities::MockObjectQuery dut;
+  const std::vector<const Object<Vector3>*> kObjects{&kObject};
+  const std::vector<std::vector<LaneClearance>> kExpectedClearances{{{lane_.get(), 1.5, -0.5}}};
+  EXPECT_CALL(dut, DoFindLaneClearances(kObjects, 2.))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(kExpectedClearances));
+  const std::vector<LaneClearance> clearances = dut.FindLaneClearances(&kObject, 2.);
+  ASSERT_EQ(1u, clearances.size());
+  EXPECT_EQ(lane_.get(), clearances.front().lane);
+  EXPECT_EQ(1.5, clearances.front().left);
+  EXPECT_EQ(-0.5, clearances.front().right);
+  EXPECT_EQ(1u, dut.FindLaneClearances(kObjects, 2.).size());
+  EXPECT_THROW(dut.FindLaneClearances(nullptr, 2.), maliput::common::assertion_error);
+  EXPECT_THROW(dut.FindLaneClearances(&kObject, -1.), maliput::common::assertion_error);
+}
+
+// Buffer and visitor overloads fall back to the allocating method by default.
+TEST_F(ObjectQueryTest, BufferAndVisitorOverloads) {
+  const test_utilities::MockObjectQuery dut;
+  EXPECT_CALL(dut, DoFindOverlappingLanesIn(&kObject, kOverlappingType))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(kExpectedOverlappingsLanesInByType));
+
+  std::vector<const maliput::api::Lane*> result{nullptr};
+  dut.FindOverlappingLanesIn(&kObject, kOverlappingType, &result);
+  EXPECT_EQ((std::vector<const maliput::api::Lane*>{nullptr, lane_.get()}), result);
+
+  std::vector<const maliput::api::Lane*> visited;
+  dut.VisitOverlappingLanesIn(&kObject, kOverlappingType,
+                              [&visited](const maliput::api::Lane* lane) { visited.push_back(lane); });
+  EXPECT_EQ(kExpectedOverlappingsLanesInByType, visited);
+
+  EXPECT_THROW(dut.FindOverlappingLanesIn(&kObject, kOverlappingType, nullptr), maliput::common::assertion_error);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace api
@@ -0,0 +1,294 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_network.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+#include <maliput/test_utilities/mock.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_book.h"
+#include "maliput_object/api/object_query.h"
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+#include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/base/shared_memory_object_book.h"
+
+namespace {
+
+// Number of calls to the global operator new since the process started.
+std::atomic<std::size_t> num_allocations{0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::BoundingRegion;
+using maliput::math::OverlappingType;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+constexpr int kGridSize{10};
+
+// A sphere whose queries do not allocate, unlike maliput::math::BoundingBox, whose vertices are computed into a
+// std::vector.
+class Sphere : public BoundingRegion<Vector3> {
+ public:
+  Sphere(const Vector3& center, double radius) : center_(center), radius_(radius) {}
+
+ private:
+  const Vector3& do_position() const override { return center_; }
+
+  bool DoContains(const Vector3& position) const override { return (position - center_).norm() <= radius_; }
+
+  OverlappingType DoOverlaps(const BoundingRegion<Vector3>& other) const override {
+    const auto* sphere = dynamic_cast<const Sphere*>(&other);
+    if (sphere == nullptr) {
+      return OverlappingType::kDisjointed;
+    }
+    const double distance = (sphere->center_ - center_).norm();
+    if (distance + sphere->radius_ <= radius_) {
+      return OverlappingType::kContained;
+    }
+    return distance <= radius_ + sphere->radius_ ? OverlappingType::kIntersected : OverlappingType::kDisjointed;
+  }
+
+  Vector3 center_;
+  double radius_{};
+};
+
+// Serves the lanes of every Object from a precomputed map, as implementations with precomputed lane associations do,
+// so that the tests measure the allocations of the buffer and visitor overloads of api::ObjectQuery only.
+class PrecomputedObjectQuery : public api::ObjectQuery {
+ public:
+  explicit PrecomputedObjectQuery(std::map<api::Object<Vector3>::Id, std::vector<const maliput::api::Lane*>> lanes)
+      : lanes_(std::move(lanes)) {}
+
+  MOCK_METHOD((std::vector<const maliput::api::Lane*>), DoFindOverlappingLanesIn, (const api::Object<Vector3>*),
+              (const, override));
+  MOCK_METHOD((std::vector<const maliput::api::Lane*>), DoFindOverlappingLanesIn,
+              (const api::Object<Vector3>*, const OverlappingType&), (const, override));
+  MOCK_METHOD((std::optional<const maliput::api::LaneSRoute>), DoRoute,
+              (const api::Object<Vector3>*, const api::Object<Vector3>*), (const, override));
+  MOCK_METHOD((const api::ObjectBook<Vector3>*), do_object_book, (), (const, override));
+  MOCK_METHOD((const maliput::api::RoadNetwork*), do_road_network, (), (const, override));
+
+ private:
+  void DoVisitOverlappingLanesIn(const api::Object<Vector3>* object, const OverlappingType&,
+                                 const std::function<void(const maliput::api::Lane*)>& visitor) const override {
+    for (const maliput::api::Lane* lane : lanes_.at(object->id())) {
+      visitor(lane);
+    }
+  }
+
+  const std::map<api::Object<Vector3>::Id, std::vector<const maliput::api::Lane*>> lanes_;
+};
+
+// Returns the number of allocations made by @p function.
+std::size_t CountAllocations(const std::function<void()>& function) {
+  const std::size_t start = num_allocations.load();
+  function();
+  return num_allocations.load() - start;
+}
+
+class AllocationFreeQueryTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // A 10 x 10 grid of unit spheres, 2 meters apart from each other.
+    std::vector<std::unique_ptr<api::Object<Vector3>>> objects;
+    for (int i = 0; i < kGridSize; ++i) {
+      for (int j = 0; j < kGridSize; ++j) {
+        objects.push_back(std::make_unique<api::Object<Vector3>>(
+            api::Object<Vector3>::Id(std::to_string(i) + "_" + std::to_string(j)),
+            std::map<std::string, std::string>{{"row", std::to_string(i)}},
+            std::make_unique<Sphere>(Vector3(2. * i, 2. * j, 0.), 0.5)));
+      }
+    }
+    object_book_.AddObjects(std::move(objects));
+  }
+
+  const Sphere region_{Vector3(5., 5., 0.), 2.};
+  const std::function<bool(const api::Object<Vector3>*)> predicate_ = [](const api::Object<Vector3>* object) {
+    return object->position().x() < 4.;
+  };
+  ManualObjectBook<Vector3> object_book_{kTolerance};
+};
+
+TEST_F(AllocationFreeQueryTest, ManualObjectBook) {
+  std::vector<api::Object<Vector3>*> result;
+  result.reserve(kGridSize * kGridSize);
+  std::size_t num_visited{0};
+  const std::function<void(api::Object<Vector3>*)> visitor = [&num_visited](api::Object<Vector3>*) { ++num_visited; };
+  const auto find_by_predicate = [&]() { object_book_.FindByPredicate(predicate_, &result); };
+  const auto find_overlapping_in = [&]() {
+    object_book_.FindOverlappingIn(region_, OverlappingType::kIntersected, &result);
+  };
+  const auto visit_by_predicate = [&]() { object_book_.VisitByPredicate(predicate_, visitor); };
+  const auto visit_overlapping_in = [&]() {
+    object_book_.VisitOverlappingIn(region_, OverlappingType::kIntersected, visitor);
+  };
+  // Warms up lazily initialized state, e.g. thread local statistics.
+  find_by_predicate();
+  find_overlapping_in();
+
+  result.clear();
+  EXPECT_EQ(0u, CountAllocations(find_by_predicate));
+  EXPECT_EQ(2u * kGridSize, result.size());
+  result.clear();
+  EXPECT_EQ(0u, CountAllocations(find_overlapping_in));
+  EXPECT_EQ(4u, result.size());
+  EXPECT_EQ(0u, CountAllocations(visit_by_predicate));
+  EXPECT_EQ(2u * kGridSize, num_visited);
+  num_visited = 0;
+  EXPECT_EQ(0u, CountAllocations(visit_overlapping_in));
+  EXPECT_EQ(4u, num_visited);
+
+  // The overloads that return a new vector do allocate.
+  EXPECT_GT(CountAllocations([&]() { object_book_.FindOverlappingIn(region_, OverlappingType::kIntersected); }), 0u);
+}
+
+// Box regions are bounded without computing their vertices, so the index is traversed without allocating. The exact
+// check of the candidates against a maliput::math::BoundingBox region is done by maliput, which does allocate.
+TEST(AllocationFreeBoundingVolumeHierarchyTest, BoundingBoxes) {
+  std::vector<std::unique_ptr<api::Object<Vector3>>> owned_objects;
+  std::vector<api::Object<Vector3>*> objects;
+  for (int i = 0; i < kGridSize; ++i) {
+    for (int j = 0; j < kGridSize; ++j) {
+      owned_objects.push_back(std::make_unique<api::Object<Vector3>>(
+          api::Object<Vector3>::Id(std::to_string(i) + "_" + std::to_string(j)), std::map<std::string, std::string>{},
+          std::make_unique<BoundingBox>(Vector3(2. * i, 2. * j, 0.), Vector3(1., 1., 1.), RollPitchYaw(0., 0., 0.3),
+                                        kTolerance)));
+      objects.push_back(owned_objects.back().get());
+    }
+  }
+  const BoundingVolumeHierarchy<Vector3> dut(objects, kTolerance);
+  const BoundingBox region{Vector3(5., 5., 0.), Vector3(4., 4., 4.), RollPitchYaw(0., 0., 0.2), kTolerance};
+  std::size_t num_candidates{0};
+  const std::function<void(api::Object<Vector3>*)> visitor = [&num_candidates](api::Object<Vector3>*) {
+    ++num_candidates;
+  };
+  const auto visit_candidates = [&]() {
+    const std::optional<AxisAlignedBox<Vector3>> box = ComputeAxisAlignedBox<Vector3>(region, kTolerance);
+    dut.VisitCandidates(box.value(), visitor);
+  };
+  EXPECT_EQ(0u, CountAllocations(visit_candidates));
+  // The rotated region spans the objects of rows and columns 2 and 3.
+  EXPECT_EQ(4u, num_candidates);
+}
+
+TEST(AllocationFreeObjectQueryTest, FindOverlappingLanesIn) {
+  const std::unique_ptr<maliput::api::Lane> lane = maliput::api::test::CreateLane(maliput::api::LaneId{"lane"});
+  const api::Object<Vector3> object{
+      api::Object<Vector3>::Id("object"), {}, std::make_unique<Sphere>(Vector3(0., 0., 0.), 1.)};
+  const PrecomputedObjectQuery dut({{object.id(), {lane.get(), lane.get()}}});
+  std::vector<const maliput::api::Lane*> result;
+  result.reserve(2);
+  std::size_t num_visited{0};
+  const std::function<void(const maliput::api::Lane*)> visitor = [&num_visited](const maliput::api::Lane*) {
+    ++num_visited;
+  };
+
+  const auto find_overlapping_lanes_in = [&]() {
+    dut.FindOverlappingLanesIn(&object, OverlappingType::kIntersected, &result);
+  };
+  const auto visit_overlapping_lanes_in = [&]() {
+    dut.VisitOverlappingLanesIn(&object, OverlappingType::kIntersected, visitor);
+  };
+  EXPECT_EQ(0u, CountAllocations(find_overlapping_lanes_in));
+  EXPECT_EQ(2u, result.size());
+  EXPECT_EQ(0u, CountAllocations(visit_overlapping_lanes_in));
+  EXPECT_EQ(2u, num_visited);
+}
+
+TEST_F(AllocationFreeQueryTest, SharedMemoryObjectBook) {
+  ManualObjectBook<Vector3> box_book{kTolerance};
+  std::vector<std::unique_ptr<api::Object<Vector3>>> objects;
+  for (int i = 0; i < kGridSize; ++i) {
+    objects.push_back(std::make_unique<api::Object<Vector3>>(
+        api::Object<Vector3>::Id(std::to_string(i)), std::map<std::string, std::string>{},
+        std::make_unique<BoundingBox>(Vector3(2. * i, 0., 0.), Vector3(1., 1., 1.), RollPitchYaw(0., 0., 0.),
+                                      kTolerance)));
+  }
+  box_book.AddObjects(std::move(objects));
+  const std::string filename = ::testing::TempDir() + "allocation_free_query_test.bin";
+  SharedMemoryObjectBook::Write(filename, box_book, kTolerance);
+  {
+    const SharedMemoryObjectBook dut(filename);
+    std::vector<api::Object<Vector3>*> result;
+    result.reserve(kGridSize);
+    const auto find_by_predicate = [&]() { dut.FindByPredicate(predicate_, &result); };
+    // Materializes the objects of the book.
+    find_by_predicate();
+
+    result.clear();
+    EXPECT_EQ(0u, CountAllocations(find_by_predicate));
+    EXPECT_EQ(2u, result.size());
+  }
+  std::remove(filename.c_str());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
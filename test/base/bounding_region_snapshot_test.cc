@@ -0,0 +1,89 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/bounding_region_snapshot.h"
+
+#include <array>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/test_utilities/mock_math.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+TEST(BoundingRegionSnapshotTest, BoundingBox) {
+  const BoundingBox box{{1., 2., 3.}, {4., 5., 6.}, {0.1, 0.2, 0.3}, kTolerance};
+  const BoundingRegionSnapshot dut(box);
+  EXPECT_TRUE(dut.is_box());
+  EXPECT_EQ((std::array<double, 9>{1., 2., 3., 4., 5., 6., 0.1, 0.2, 0.3}), dut.parameters());
+  EXPECT_TRUE(dut.Matches(box));
+  EXPECT_TRUE(dut.Matches(BoundingBox{{1., 2., 3.}, {4., 5., 6.}, {0.1, 0.2, 0.3}, kTolerance}));
+  EXPECT_FALSE(dut.Matches(BoundingBox{{1., 2., 4.}, {4., 5., 6.}, {0.1, 0.2, 0.3}, kTolerance}));
+  EXPECT_FALSE(dut.Matches(BoundingBox{{1., 2., 3.}, {4., 5., 7.}, {0.1, 0.2, 0.3}, kTolerance}));
+  EXPECT_FALSE(dut.Matches(BoundingBox{{1., 2., 3.}, {4., 5., 6.}, {0.1, 0.2, 0.4}, kTolerance}));
+  const BoundingRegionSnapshot copy{dut};
+  EXPECT_EQ(dut, copy);
+  EXPECT_NE(dut, BoundingRegionSnapshot(BoundingBox{{1., 2., 3.}, {1., 1., 1.}, RollPitchYaw{}, kTolerance}));
+}
+
+TEST(BoundingRegionSnapshotTest, UnsupportedRegion) {
+  const Vector3 kPosition{1., 2., 3.};
+  const Vector3 kOtherPosition{1., 2., 4.};
+  test_utilities::MockBoundingRegion region;
+  EXPECT_CALL(region, do_position())
+      .WillOnce(::testing::ReturnRef(kPosition))
+      .WillOnce(::testing::ReturnRef(kPosition))
+      .WillOnce(::testing::ReturnRef(kOtherPosition));
+  const BoundingRegionSnapshot dut(region);
+  EXPECT_FALSE(dut.is_box());
+  EXPECT_EQ((std::array<double, 9>{1., 2., 3., 0., 0., 0., 0., 0., 0.}), dut.parameters());
+  EXPECT_TRUE(dut.Matches(region));
+  EXPECT_FALSE(dut.Matches(region));
+  // A box at the same position is a different region.
+  EXPECT_FALSE(dut.Matches(BoundingBox{kPosition, {0., 0., 0.}, RollPitchYaw{}, kTolerance}));
+  EXPECT_NE(dut, BoundingRegionSnapshot(BoundingBox{kPosition, {0., 0., 0.}, RollPitchYaw{}, kTolerance}));
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,374 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/test_utilities/mock_math.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+std::unique_ptr<api::Object<Vector3>> MakeBoxObject(const std::string& id, const Vector3& position,
+                                                    const Vector3& box_size, const RollPitchYaw& rpy) {
+  return std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+      std::make_unique<BoundingBox>(position, box_size, rpy, kTolerance));
+}
+
+std::vector<std::string> SortedIds(const std::vector<api::Object<Vector3>*>& objects) {
+  std::vector<std::string> ids;
+  std::transform(objects.begin(), objects.end(), std::back_inserter(ids),
+                 [](const api::Object<Vector3>* object) { return object->id().string(); });
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+TEST(AxisAlignedBoxTest, Operations) {
+  const AxisAlignedBox<Vector3> box_a{{0., 0., 0.}, {1., 1., 1.}};
+  const AxisAlignedBox<Vector3> box_b{{1., 0.5, 0.5}, {2., 2., 2.}};
+  const AxisAlignedBox<Vector3> box_c{{1.5, 0., 0.}, {2., 1., 1.}};
+  EXPECT_TRUE(box_a.Overlaps(box_b));
+  EXPECT_TRUE(box_b.Overlaps(box_a));
+  EXPECT_FALSE(box_a.Overlaps(box_c));
+
+  const AxisAlignedBox<Vector3> merged = box_a.Merge(box_c);
+  EXPECT_EQ(Vector3(0., 0., 0.), merged.min_corner);
+  EXPECT_EQ(Vector3(2., 1., 1.), merged.max_corner);
+  EXPECT_EQ(Vector3(1., 0.5, 0.5), merged.center());
+}
+
+TEST(AxisAlignedBoxTest, IntersectRay) {
+  const AxisAlignedBox<Vector3> dut{{0., 0., 0.}, {1., 1., 1.}};
+  const Vector3 kInverseX = ComputeInverseDirection(Vector3{1., 0., 0.});
+  EXPECT_TRUE(std::isinf(kInverseX.y()));
+  EXPECT_EQ(std::optional<double>(1.), dut.IntersectRay({-1., 0.5, 0.5}, kInverseX, 10.));
+  EXPECT_EQ(std::optional<double>(0.), dut.IntersectRay({0.5, 0.5, 0.5}, kInverseX, 10.));
+  // Too short, pointing away and parallel to a slab it is outside of.
+  EXPECT_EQ(std::nullopt, dut.IntersectRay({-1., 0.5, 0.5}, kInverseX, 0.5));
+  EXPECT_EQ(std::nullopt, dut.IntersectRay({2., 0.5, 0.5}, kInverseX, 10.));
+  EXPECT_EQ(std::nullopt, dut.IntersectRay({-1., 2., 0.5}, kInverseX, 10.));
+  const Vector3 kDiagonal = Vector3{1., 1., 0.}.normalized();
+  const std::optional<double> distance = dut.IntersectRay({-1., -1., 0.5}, ComputeInverseDirection(kDiagonal), 10.);
+  ASSERT_TRUE(distance.has_value());
+  EXPECT_NEAR(std::sqrt(2.), distance.value(), 1e-12);
+}
+
+TEST(AxisAlignedBoxTest, IsOutside) {
+  // The half space x >= 5 and the slab 0 <= y <= 10.
+  const api::Frustum<Vector3> kFrustum{{{{1., 0., 0.}, -5.}, {{0., 1., 0.}, 0.}, {{0., -1., 0.}, 10.}}};
+  EXPECT_TRUE((AxisAlignedBox<Vector3>{{0., 0., 0.}, {1., 1., 1.}}.IsOutside(kFrustum)));
+  EXPECT_FALSE((AxisAlignedBox<Vector3>{{4., 0., 0.}, {6., 1., 1.}}.IsOutside(kFrustum)));
+  EXPECT_TRUE((AxisAlignedBox<Vector3>{{6., 11., 0.}, {7., 12., 1.}}.IsOutside(kFrustum)));
+  EXPECT_FALSE((AxisAlignedBox<Vector3>{{6., 1., 0.}, {7., 2., 1.}}.IsOutside(api::Frustum<Vector3>{})));
+}
+
+TEST(ComputeAxisAlignedBoxTest, BoundingBox) {
+  const BoundingBox rotated_box{Vector3{1., 2., 3.}, Vector3{2., 2., 2.}, RollPitchYaw{0., 0., M_PI / 4.}, kTolerance};
+  const auto dut = ComputeAxisAlignedBox(rotated_box, 0.5);
+  ASSERT_TRUE(dut.has_value());
+  EXPECT_NEAR(1. - std::sqrt(2.) - 0.5, dut->min_corner.x(), 1e-12);
+  EXPECT_NEAR(2. - std::sqrt(2.) - 0.5, dut->min_corner.y(), 1e-12);
+  EXPECT_NEAR(3. - 1. - 0.5, dut->min_corner.z(), 1e-12);
+  EXPECT_NEAR(1. + std::sqrt(2.) + 0.5, dut->max_corner.x(), 1e-12);
+  EXPECT_NEAR(2. + std::sqrt(2.) + 0.5, dut->max_corner.y(), 1e-12);
+  EXPECT_NEAR(3. + 1. + 0.5, dut->max_corner.z(), 1e-12);
+}
+
+TEST(ComputeAxisAlignedBoxTest, UnsupportedRegion) {
+  const test_utilities::MockBoundingRegion region;
+  EXPECT_FALSE(ComputeAxisAlignedBox<Vector3>(region, kTolerance).has_value());
+}
+
+TEST(AxisAlignedBoxTest, SquaredDistanceTo) {
+  const AxisAlignedBox<Vector3> box{{0., 0., 0.}, {1., 1., 1.}};
+  EXPECT_DOUBLE_EQ(0., box.SquaredDistanceTo({0.5, 0.5, 0.5}));
+  EXPECT_DOUBLE_EQ(5., box.SquaredDistanceTo({-1., 3., 0.5}));
+  const AxisAlignedBox<Vector3> inflated = box.Inflate(0.5);
+  EXPECT_EQ(Vector3(-0.5, -0.5, -0.5), inflated.min_corner);
+  EXPECT_EQ(Vector3(1.5, 1.5, 1.5), inflated.max_corner);
+}
+
+TEST(ComputeAxisAlignedBoxTest, IsConservativeForRays) {
+  // A 2 x 2 x 2 box rotated 45 degrees around z. The ray along x + y = 3 crosses its axis-aligned box but runs parallel
+  // to one of its faces, so the region itself is missed.
+  const BoundingBox box{{5., 0., 0.}, {2., 2., 2.}, {0., 0., M_PI / 4.}, kTolerance};
+  const Vector3 kDirection = Vector3{1., -1., 0.}.normalized();
+  EXPECT_EQ(std::nullopt, api::ComputeRayIntersection<Vector3>(box, {{2.8, 0.2, 0.}, kDirection, 10.}));
+  EXPECT_TRUE(ComputeAxisAlignedBox<Vector3>(box, kTolerance)
+                  ->IntersectRay({2.8, 0.2, 0.}, ComputeInverseDirection(kDirection), 10.)
+                  .has_value());
+}
+
+TEST(NearestObjectsTest, KeepsTheClosestObjects) {
+  EXPECT_THROW(NearestObjects<Vector3>(-1), maliput::common::assertion_error);
+  std::vector<std::unique_ptr<api::Object<Vector3>>> objects;
+  for (const std::string& id : {"a", "b", "c", "d"}) {
+    objects.push_back(MakeBoxObject(id, Vector3{0., 0., 0.}, Vector3{1., 1., 1.}, RollPitchYaw{0., 0., 0.}));
+  }
+  NearestObjects<Vector3> dut(3);
+  EXPECT_TRUE(std::isinf(dut.max_distance()));
+  dut.Offer(objects[3].get(), 4.);
+  dut.Offer(objects[2].get(), 1.);
+  dut.Offer(objects[1].get(), 2.);
+  EXPECT_EQ(4., dut.max_distance());
+  dut.Offer(objects[0].get(), 2.);
+  EXPECT_EQ(2., dut.max_distance());
+  // Ties are broken by id.
+  EXPECT_EQ(std::vector<api::Object<Vector3>*>({objects[2].get(), objects[0].get(), objects[1].get()}), dut.Sorted());
+
+  NearestObjects<Vector3> empty(0);
+  empty.Offer(objects[0].get(), 0.);
+  EXPECT_TRUE(empty.Sorted().empty());
+}
+
+class BoundingVolumeHierarchyTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // A 20 x 20 grid of unit boxes, 2 meters apart from each other, that spans several levels of the tree.
+    for (int i = 0; i < kGridSize; ++i) {
+      for (int j = 0; j < kGridSize; ++j) {
+        owned_objects_.push_back(MakeBoxObject(std::to_string(i) + "_" + std::to_string(j), Vector3(2. * i, 2. * j, 0.),
+                                               Vector3(1., 1., 1.), RollPitchYaw(0., 0., 0.)));
+        objects_.push_back(owned_objects_.back().get());
+      }
+    }
+  }
+
+  std::vector<api::Object<Vector3>*> BruteForce(const AxisAlignedBox<Vector3>& box) const {
+    std::vector<api::Object<Vector3>*> result;
+    std::copy_if(objects_.begin(), objects_.end(), std::back_inserter(result), [&box](api::Object<Vector3>* object) {
+      return ComputeAxisAlignedBox(object->bounding_region(), kTolerance)->Overlaps(box);
+    });
+    return result;
+  }
+
+  static constexpr int kGridSize{20};
+  std::vector<std::unique_ptr<api::Object<Vector3>>> owned_objects_;
+  std::vector<api::Object<Vector3>*> objects_;
+};
+
+TEST_F(BoundingVolumeHierarchyTest, Constructor) {
+  EXPECT_THROW(BoundingVolumeHierarchy<Vector3>(objects_, -1.), maliput::common::assertion_error);
+  EXPECT_THROW(BoundingVolumeHierarchy<Vector3>({nullptr}, kTolerance), maliput::common::assertion_error);
+  const BoundingVolumeHierarchy<Vector3> dut(objects_, kTolerance);
+  EXPECT_EQ(kGridSize * kGridSize, dut.size());
+  EXPECT_EQ(kTolerance, dut.tolerance());
+}
+
+TEST_F(BoundingVolumeHierarchyTest, EmptyHierarchy) {
+  const BoundingVolumeHierarchy<Vector3> dut({}, kTolerance);
+  EXPECT_EQ(0, dut.size());
+  int visited{0};
+  dut.VisitCandidates({{-1., -1., -1.}, {1., 1., 1.}}, [&visited](api::Object<Vector3>*) { ++visited; });
+  EXPECT_EQ(0, visited);
+}
+
+TEST_F(BoundingVolumeHierarchyTest, VisitCandidatesMatchesBruteForce) {
+  const BoundingVolumeHierarchy<Vector3> dut(objects_, kTolerance);
+  const std::vector<AxisAlignedBox<Vector3>> query_boxes{
+      {{-10., -10., -10.}, {100., 100., 100.}},  // Everything.
+      {{100., 100., 100.}, {101., 101., 101.}},  // Nothing.
+      {{3., 3., -1.}, {9.2, 5., 1.}},            // A patch of the grid.
+      {{1.6, 1.6, -1.}, {2.4, 2.4, 1.}},         // A single box.
+      {{0.7, 0.7, -1.}, {1.3, 1.3, 1.}},         // In between boxes.
+  };
+  for (const auto& query_box : query_boxes) {
+    std::vector<api::Object<Vector3>*> candidates;
+    dut.VisitCandidates(query_box, [&candidates](api::Object<Vector3>* object) { candidates.push_back(object); });
+    EXPECT_EQ(SortedIds(BruteForce(query_box)), SortedIds(candidates));
+  }
+}
+
+TEST_F(BoundingVolumeHierarchyTest, VisitNearest) {
+  const BoundingVolumeHierarchy<Vector3> dut(objects_, kTolerance);
+  const Vector3 kPosition{7.2, 13.9, 0.};
+  std::vector<std::pair<double, api::Object<Vector3>*>> visited;
+  dut.VisitNearest(kPosition, [&visited](api::Object<Vector3>* object, double lower_bound) {
+    visited.emplace_back(lower_bound, object);
+    return true;
+  });
+  ASSERT_EQ(objects_.size(), visited.size());
+  EXPECT_TRUE(std::is_sorted(visited.begin(), visited.end(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }));
+  for (const auto& lower_bound_object : visited) {
+    EXPECT_LE(lower_bound_object.first, api::ComputeDistance(lower_bound_object.second->bounding_region(), kPosition));
+  }
+  EXPECT_EQ("4_7", visited.front().second->id().string());
+
+  // The traversal stops when the visitor returns false.
+  int num_visited{0};
+  dut.VisitNearest(kPosition, [&num_visited](api::Object<Vector3>*, double) { return ++num_visited < 3; });
+  EXPECT_EQ(3, num_visited);
+}
+
+TEST_F(BoundingVolumeHierarchyTest, VisitRayCandidates) {
+  const BoundingVolumeHierarchy<Vector3> dut(objects_, kTolerance);
+  // Along the row of boxes with j = 3, stopping inside the box 5_3.
+  const api::Ray<Vector3> kRay{{-3., 6., 0.}, {1., 0., 0.}, 12.8};
+  std::vector<std::pair<double, api::Object<Vector3>*>> visited;
+  dut.VisitRayCandidates(kRay, [&visited](api::Object<Vector3>* object, double distance) {
+    visited.emplace_back(distance, object);
+    return true;
+  });
+  std::vector<std::string> ids;
+  for (const auto& distance_object : visited) {
+    ids.push_back(distance_object.second->id().string());
+    EXPECT_LE(distance_object.first,
+              api::ComputeRayIntersection(distance_object.second->bounding_region(), kRay).value());
+  }
+  EXPECT_EQ((std::vector<std::string>{"0_3", "1_3", "2_3", "3_3", "4_3", "5_3"}), ids);
+
+  int num_visited{0};
+  dut.VisitRayCandidates(kRay, [&num_visited](api::Object<Vector3>*, double) { return ++num_visited < 2; });
+  EXPECT_EQ(2, num_visited);
+}
+
+TEST_F(BoundingVolumeHierarchyTest, VisitRayPacketCandidatesMatchesSingleRays) {
+  const BoundingVolumeHierarchy<Vector3> dut(objects_, kTolerance);
+  // More rays than fit in a packet, fanning out from a corner of the grid.
+  std::vector<api::Ray<Vector3>> rays;
+  for (int i = 0; i < 100; ++i) {
+    const double angle = M_PI / 2. * i / 99.;
+    rays.push_back({{-1., -1., 0.}, {std::cos(angle), std::sin(angle), 0.}, 10. + 0.2 * i});
+  }
+  std::vector<double> ranges;
+  std::transform(rays.begin(), rays.end(), std::back_inserter(ranges),
+                 [](const api::Ray<Vector3>& ray) { return ray.max_range; });
+  std::vector<std::set<std::string>> packet_candidates(rays.size());
+  dut.VisitRayPacketCandidates(rays, &ranges,
+                               [&packet_candidates](std::size_t ray_index, api::Object<Vector3>* object) {
+                                 EXPECT_TRUE(packet_candidates[ray_index].insert(object->id().string()).second);
+                               });
+  for (std::size_t i = 0; i < rays.size(); ++i) {
+    std::set<std::string> candidates;
+    dut.VisitRayCandidates(rays[i], [&candidates](api::Object<Vector3>* object, double) {
+      candidates.insert(object->id().string());
+      return true;
+    });
+    EXPECT_EQ(candidates, packet_candidates[i]);
+  }
+
+  EXPECT_THROW(dut.VisitRayPacketCandidates(rays, nullptr, [](std::size_t, api::Object<Vector3>*) {}),
+               maliput::common::assertion_error);
+  std::vector<double> too_few_ranges(1, 10.);
+  EXPECT_THROW(dut.VisitRayPacketCandidates(rays, &too_few_ranges, [](std::size_t, api::Object<Vector3>*) {}),
+               maliput::common::assertion_error);
+}
+
+TEST_F(BoundingVolumeHierarchyTest, VisitRayPacketCandidatesShrinksRanges) {
+  const BoundingVolumeHierarchy<Vector3> dut(objects_, kTolerance);
+  const std::vector<api::Ray<Vector3>> kRays{{{-3., 6., 0.}, {1., 0., 0.}, 100.}};
+  std::vector<double> ranges{100.};
+  std::vector<std::string> ids;
+  // Stopping at the first hit prunes every box behind it.
+  dut.VisitRayPacketCandidates(kRays, &ranges, [&kRays, &ranges, &ids](std::size_t i, api::Object<Vector3>* object) {
+    ids.push_back(object->id().string());
+    ranges[i] = std::min(ranges[i], api::ComputeRayIntersection(object->bounding_region(), kRays[i]).value());
+  });
+  ASSERT_FALSE(ids.empty());
+  EXPECT_LT(ids.size(), static_cast<std::size_t>(kGridSize));
+  EXPECT_NE(ids.end(), std::find(ids.begin(), ids.end(), "0_3"));
+  EXPECT_EQ(2.5, ranges.front());
+}
+
+TEST_F(BoundingVolumeHierarchyTest, VisitFrustumCandidatesMatchesBruteForce) {
+  const BoundingVolumeHierarchy<Vector3> dut(objects_, kTolerance);
+  // A wedge that opens along the diagonal of the grid, cut at x + y <= 30.
+  const api::Frustum<Vector3> kFrustum{{{Vector3{-1., 2., 0.}.normalized(), 0.},
+                                        {Vector3{2., -1., 0.}.normalized(), 0.},
+                                        {Vector3{-1., -1., 0.}.normalized(), 30. / std::sqrt(2.)}}};
+  std::vector<api::Object<Vector3>*> candidates;
+  dut.VisitFrustumCandidates(kFrustum, [&candidates](api::Object<Vector3>* object) { candidates.push_back(object); });
+  std::vector<api::Object<Vector3>*> expected;
+  std::copy_if(objects_.begin(), objects_.end(), std::back_inserter(expected), [&kFrustum](api::Object<Vector3>* o) {
+    return !ComputeAxisAlignedBox(o->bounding_region(), kTolerance)->IsOutside(kFrustum);
+  });
+  EXPECT_FALSE(expected.empty());
+  EXPECT_LT(expected.size(), objects_.size());
+  EXPECT_EQ(SortedIds(expected), SortedIds(candidates));
+}
+
+TEST_F(BoundingVolumeHierarchyTest, Remove) {
+  BoundingVolumeHierarchy<Vector3> dut(objects_, kTolerance);
+  EXPECT_TRUE(dut.Remove(api::Object<Vector3>::Id("1_1")));
+  EXPECT_FALSE(dut.Remove(api::Object<Vector3>::Id("1_1")));
+  EXPECT_FALSE(dut.Remove(api::Object<Vector3>::Id("unknown")));
+  EXPECT_EQ(kGridSize * kGridSize - 1, dut.size());
+  std::vector<api::Object<Vector3>*> candidates;
+  dut.VisitCandidates({{1.6, 1.6, -1.}, {2.4, 2.4, 1.}},
+                      [&candidates](api::Object<Vector3>* object) { candidates.push_back(object); });
+  EXPECT_TRUE(candidates.empty());
+}
+
+TEST_F(BoundingVolumeHierarchyTest, UnboundedObjectsAreAlwaysCandidates) {
+  auto unbounded_object = std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id("unbounded"), std::map<std::string, std::string>{},
+      std::make_unique<test_utilities::MockBoundingRegion>());
+  objects_.push_back(unbounded_object.get());
+  BoundingVolumeHierarchy<Vector3> dut(objects_, kTolerance);
+  EXPECT_EQ(kGridSize * kGridSize + 1, dut.size());
+  std::vector<api::Object<Vector3>*> candidates;
+  dut.VisitCandidates({{100., 100., 100.}, {101., 101., 101.}},
+                      [&candidates](api::Object<Vector3>* object) { candidates.push_back(object); });
+  ASSERT_EQ(1u, candidates.size());
+  EXPECT_EQ(unbounded_object.get(), candidates.front());
+  EXPECT_TRUE(dut.Remove(unbounded_object->id()));
+  EXPECT_EQ(kGridSize * kGridSize, dut.size());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,197 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/federated_object_book.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::OverlappingType;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+std::unique_ptr<api::Object<Vector3>> MakeBoxObject(const std::string& id, const Vector3& position) {
+  return std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+      std::make_unique<BoundingBox>(position, Vector3{2., 2., 2.}, RollPitchYaw{}, kTolerance));
+}
+
+std::vector<std::string> ToIds(const std::vector<api::Object<Vector3>*>& objects) {
+  std::vector<std::string> ids;
+  for (const api::Object<Vector3>* object : objects) {
+    ids.push_back(object->id().string());
+  }
+  return ids;
+}
+
+// Static objects are indexed, dynamic ones are added one at a time and the mixed layer declares no properties.
+class FederatedObjectBookTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    std::vector<std::unique_ptr<api::Object<Vector3>>> static_objects;
+    static_objects.push_back(MakeBoxObject("s1", {0., 0., 0.}));
+    static_objects.push_back(MakeBoxObject("s2", {10., 0., 0.}));
+    static_book_.AddObjects(std::move(static_objects));
+    dynamic_book_.AddObject(MakeBoxObject("d1", {1.5, 0., 0.}));
+    dynamic_book_.AddObject(MakeBoxObject("d2", {10., 5., 0.}));
+    dynamic_book_.AddObject(MakeBoxObject("d3", {10., 6., 0.}));
+    mixed_book_.AddObject(MakeBoxObject("m1", {30., 0., 0.}));
+  }
+
+  std::vector<FederatedObjectBook<Vector3>::Layer> MakeLayers() const {
+    return {{"static", &static_book_, {{"kind", "static"}}},
+            {"dynamic", &dynamic_book_, {{"kind", "dynamic"}}},
+            {"mixed", &mixed_book_, {}}};
+  }
+
+  ManualObjectBook<Vector3> static_book_;
+  ManualObjectBook<Vector3> dynamic_book_;
+  ManualObjectBook<Vector3> mixed_book_;
+};
+
+TEST_F(FederatedObjectBookTest, Constructor) {
+  EXPECT_THROW(FederatedObjectBook<Vector3>({{"static", nullptr, {}}}), maliput::common::assertion_error);
+  EXPECT_THROW(FederatedObjectBook<Vector3>({{"static", &static_book_, {}}, {"static", &dynamic_book_, {}}}),
+               maliput::common::assertion_error);
+  const FederatedObjectBook<Vector3> dut(MakeLayers());
+  ASSERT_EQ(3u, dut.layers().size());
+  ASSERT_NE(nullptr, dut.FindLayer("dynamic"));
+  EXPECT_EQ(&dynamic_book_, dut.FindLayer("dynamic")->book);
+  EXPECT_EQ(nullptr, dut.FindLayer("unknown"));
+  EXPECT_TRUE(FederatedObjectBook<Vector3>({}).objects().empty());
+}
+
+TEST_F(FederatedObjectBookTest, FanOut) {
+  const FederatedObjectBook<Vector3> dut(MakeLayers());
+  EXPECT_EQ(6u, dut.objects().size());
+  EXPECT_EQ(dynamic_book_.FindById(api::Object<Vector3>::Id("d1")), dut.FindById(api::Object<Vector3>::Id("d1")));
+  EXPECT_EQ(mixed_book_.FindById(api::Object<Vector3>::Id("m1")), dut.FindById(api::Object<Vector3>::Id("m1")));
+  EXPECT_EQ(nullptr, dut.FindById(api::Object<Vector3>::Id("unknown")));
+
+  const auto is_on_x_axis = [](const api::Object<Vector3>* object) { return object->position().y() == 0.; };
+  EXPECT_THAT(ToIds(dut.FindByPredicate(is_on_x_axis)), ::testing::UnorderedElementsAre("s1", "s2", "d1", "m1"));
+  std::vector<api::Object<Vector3>*> buffer;
+  dut.FindByPredicate(is_on_x_axis, &buffer);
+  EXPECT_EQ(4u, buffer.size());
+
+  const BoundingBox region({0., 0., 0.}, {4., 4., 4.}, RollPitchYaw{}, kTolerance);
+  EXPECT_THAT(ToIds(dut.FindOverlappingIn(region, OverlappingType::kIntersected)),
+              ::testing::UnorderedElementsAre("s1", "d1"));
+  int num_visited{0};
+  dut.VisitOverlappingIn(region, OverlappingType::kIntersected, [&num_visited](api::Object<Vector3>*) {
+    ++num_visited;
+  });
+  EXPECT_EQ(2, num_visited);
+
+  const api::Frustum<Vector3> beyond_x_20{{{Vector3{1., 0., 0.}, -20.}}};
+  EXPECT_EQ(std::vector<std::string>{"m1"}, ToIds(dut.FindInFrustum(beyond_x_20)));
+}
+
+// Results of the layers are merged in the order the api::ObjectBook methods sort them in.
+TEST_F(FederatedObjectBookTest, MergedDistanceQueries) {
+  const FederatedObjectBook<Vector3> dut(MakeLayers());
+  EXPECT_EQ((std::vector<std::string>{"s1", "d1", "s2"}), ToIds(dut.FindNearest({0., 0., 0.}, 3)));
+  EXPECT_EQ((std::vector<std::string>{"d1"}),
+            ToIds(dut.FindNearest({0., 0., 0.}, 1, [](const api::Object<Vector3>* object) {
+              return object->id().string()[0] == 'd';
+            })));
+  // Both are 1.5 away, ties are sorted by id.
+  EXPECT_EQ((std::vector<std::string>{"d2", "s2"}), ToIds(dut.FindWithinDistance({10., 2.5, 0.}, 2.)));
+
+  const std::vector<api::RayHit<Vector3>> hits = dut.RayCastAll({-5., 0., 0.}, {1., 0., 0.}, 100.);
+  std::vector<std::string> hit_ids;
+  for (const api::RayHit<Vector3>& hit : hits) {
+    hit_ids.push_back(hit.object->id().string());
+  }
+  EXPECT_EQ((std::vector<std::string>{"s1", "d1", "s2", "m1"}), hit_ids);
+  const std::vector<std::optional<api::RayHit<Vector3>>> first_hits =
+      dut.RayCast({{{-5., 0., 0.}, {1., 0., 0.}, 100.},
+                   {{50., 0., 0.}, {-1., 0., 0.}, 100.},
+                   {{0., 50., 0.}, {1., 0., 0.}, 100.}});
+  ASSERT_EQ(3u, first_hits.size());
+  ASSERT_TRUE(first_hits[0].has_value());
+  EXPECT_EQ("s1", first_hits[0]->object->id().string());
+  ASSERT_TRUE(first_hits[1].has_value());
+  EXPECT_EQ("m1", first_hits[1]->object->id().string());
+  EXPECT_FALSE(first_hits[2].has_value());
+}
+
+TEST_F(FederatedObjectBookTest, FindAllOverlappingPairs) {
+  const FederatedObjectBook<Vector3> dut(MakeLayers());
+  std::vector<std::pair<std::string, std::string>> pair_ids;
+  for (const auto& pair : dut.FindAllOverlappingPairs()) {
+    pair_ids.emplace_back(pair.first->id().string(), pair.second->id().string());
+  }
+  // "d1" and "s1" overlap across layers, "d2" and "d3" within the dynamic one.
+  EXPECT_EQ((std::vector<std::pair<std::string, std::string>>{{"d1", "s1"}, {"d2", "d3"}}), pair_ids);
+}
+
+TEST_F(FederatedObjectBookTest, SelectLayers) {
+  const FederatedObjectBook<Vector3> dut(MakeLayers());
+  const std::unique_ptr<FederatedObjectBook<Vector3>> dynamic = dut.SelectLayers({{"kind", "dynamic"}});
+  ASSERT_EQ(2u, dynamic->layers().size());
+  EXPECT_EQ("dynamic", dynamic->layers()[0].name);
+  EXPECT_EQ("mixed", dynamic->layers()[1].name);
+  EXPECT_EQ(4u, dynamic->objects().size());
+  EXPECT_EQ(nullptr, dynamic->FindById(api::Object<Vector3>::Id("s1")));
+  EXPECT_EQ((std::vector<std::string>{"d1"}), ToIds(dynamic->FindNearest({0., 0., 0.}, 1)));
+  EXPECT_EQ(3u, dut.SelectLayers({})->layers().size());
+  EXPECT_EQ(3u, dut.SelectLayers({{"color", "red"}})->layers().size());
+  // Layers reflect the changes of their books.
+  dynamic_book_.RemoveObject(api::Object<Vector3>::Id("d1"));
+  EXPECT_EQ(3u, dynamic->objects().size());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
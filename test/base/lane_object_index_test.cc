@@ -0,0 +1,207 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/lane_object_index.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::api::LaneId;
+using maliput::api::SRange;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+std::vector<std::string> Ids(const std::vector<const api::Object<Vector3>*>& objects) {
+  std::vector<std::string> ids;
+  for (const auto* object : objects) {
+    ids.push_back(object->id().string());
+  }
+  return ids;
+}
+
+LaneFootprint MakeFootprint(const std::string& lane_id, double s_min, double s_max) {
+  return LaneFootprint{LaneId(lane_id), {}, s_min, s_max, -1., 1.};
+}
+
+class LaneObjectIndexTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // Objects of random length spread along "lane_a", some of them also overlapping with "lane_b".
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> start(0., 1000.);
+    std::uniform_real_distribution<double> length(0.5, 30.);
+    for (int i = 0; i < kNumObjects; ++i) {
+      const std::string id = "object_" + std::to_string(i);
+      object_book_.AddObject(std::make_unique<api::Object<Vector3>>(
+          api::Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+          std::make_unique<maliput::math::BoundingBox>(Vector3(i, 0., 0.), Vector3(1., 1., 1.),
+                                                       maliput::math::RollPitchYaw(0., 0., 0.), kTolerance)));
+      const double s_min = start(generator);
+      std::vector<LaneFootprint>& footprints = lane_associations_.footprints[api::Object<Vector3>::Id(id)];
+      footprints.push_back(MakeFootprint("lane_a", s_min, s_min + length(generator)));
+      if (i % 10 == 0) {
+        footprints.push_back(MakeFootprint("lane_b", s_min, s_min + 1.));
+      }
+    }
+  }
+
+  // @returns The ids of the objects whose footprint on @p lane_id overlaps with [@p s_min, @p s_max], sorted by the
+  //          start of their footprint.
+  std::vector<std::string> BruteForce(const std::string& lane_id, double s_min, double s_max) const {
+    std::vector<std::pair<double, std::string>> matches;
+    for (const auto& id_footprints : lane_associations_.footprints) {
+      for (const LaneFootprint& footprint : id_footprints.second) {
+        if (footprint.lane_id == LaneId(lane_id) && footprint.s_min <= s_max && footprint.s_max >= s_min) {
+          matches.emplace_back(footprint.s_min, id_footprints.first.string());
+        }
+      }
+    }
+    std::sort(matches.begin(), matches.end());
+    std::vector<std::string> ids;
+    for (const auto& match : matches) {
+      ids.push_back(match.second);
+    }
+    return ids;
+  }
+
+  static constexpr int kNumObjects{500};
+  ManualObjectBook<Vector3> object_book_;
+  ObjectLaneAssociations lane_associations_;
+};
+
+TEST_F(LaneObjectIndexTest, Constructor) {
+  EXPECT_THROW(LaneObjectIndex(nullptr, lane_associations_), maliput::common::assertion_error);
+  // Footprints of unknown objects are ignored.
+  lane_associations_.footprints[api::Object<Vector3>::Id("unknown")].push_back(MakeFootprint("lane_c", 0., 1.));
+  const LaneObjectIndex dut(&object_book_, lane_associations_);
+  EXPECT_EQ(kNumObjects, dut.num_objects());
+  EXPECT_EQ(nullptr, dut.GetIntervalsOnLane(LaneId("lane_c")));
+  ASSERT_NE(nullptr, dut.GetIntervalsOnLane(LaneId("lane_a")));
+  EXPECT_EQ(static_cast<std::size_t>(kNumObjects), dut.GetIntervalsOnLane(LaneId("lane_a"))->size());
+  EXPECT_GT(dut.MemoryUsage().index, 0u);
+  EXPECT_EQ(0, LaneObjectIndex().num_objects());
+}
+
+TEST_F(LaneObjectIndexTest, StaleFootprintsAreIgnored) {
+  const api::Object<Vector3>* changed = object_book_.FindById(api::Object<Vector3>::Id("object_0"));
+  const api::Object<Vector3>* unchanged = object_book_.FindById(api::Object<Vector3>::Id("object_1"));
+  const std::string changed_hash = ComputeObjectHash(changed);
+  EXPECT_EQ(16u, changed_hash.size());
+  EXPECT_EQ(changed_hash, ComputeObjectHash(changed));
+  EXPECT_NE(changed_hash, ComputeObjectHash(unchanged));
+  EXPECT_THROW(ComputeObjectHash(nullptr), maliput::common::assertion_error);
+
+  lane_associations_.object_hashes.emplace(changed->id(), ComputeObjectHash(unchanged));
+  lane_associations_.object_hashes.emplace(unchanged->id(), ComputeObjectHash(unchanged));
+  EXPECT_FALSE(AreFootprintsCurrent(lane_associations_, changed));
+  EXPECT_TRUE(AreFootprintsCurrent(lane_associations_, unchanged));
+  // Objects without a hash are assumed to be current.
+  EXPECT_TRUE(AreFootprintsCurrent(lane_associations_, object_book_.FindById(api::Object<Vector3>::Id("object_2"))));
+  EXPECT_THROW(AreFootprintsCurrent(lane_associations_, nullptr), maliput::common::assertion_error);
+
+  const LaneObjectIndex dut(&object_book_, lane_associations_);
+  EXPECT_EQ(kNumObjects - 1, dut.num_objects());
+  for (const LaneObjectInterval& interval : *dut.GetIntervalsOnLane(LaneId("lane_a"))) {
+    EXPECT_NE(changed, interval.object);
+  }
+}
+
+TEST_F(LaneObjectIndexTest, FindObjectsOnLaneMatchesBruteForce) {
+  const LaneObjectIndex dut(&object_book_, lane_associations_);
+  for (const std::string lane_id : {"lane_a", "lane_b"}) {
+    for (const auto& s_range : {std::make_pair(120., 180.), std::make_pair(0., 1000.), std::make_pair(500., 500.),
+                                std::make_pair(-10., -1.), std::make_pair(2000., 3000.)}) {
+      EXPECT_EQ(BruteForce(lane_id, s_range.first, s_range.second),
+                Ids(dut.FindObjectsOnLane(LaneId(lane_id), SRange(s_range.first, s_range.second))));
+    }
+  }
+  // Ranges in the opposite direction are equivalent.
+  EXPECT_EQ(Ids(dut.FindObjectsOnLane(LaneId("lane_a"), SRange(120., 180.))),
+            Ids(dut.FindObjectsOnLane(LaneId("lane_a"), SRange(180., 120.))));
+  EXPECT_TRUE(dut.FindObjectsOnLane(LaneId("unknown"), SRange(0., 1000.)).empty());
+  std::vector<LaneObjectInterval> intervals;
+  dut.VisitIntervalsOnLane(LaneId("lane_b"), SRange(0., 1000.),
+                           [&intervals](const LaneObjectInterval& interval) { intervals.push_back(interval); });
+  EXPECT_EQ(static_cast<std::size_t>(kNumObjects / 10), intervals.size());
+  for (const LaneObjectInterval& interval : intervals) {
+    EXPECT_DOUBLE_EQ(1., interval.s_max - interval.s_min);
+    EXPECT_EQ(-1., interval.r_min);
+    EXPECT_EQ(1., interval.r_max);
+  }
+}
+
+TEST_F(LaneObjectIndexTest, UpdateAndRemove) {
+  LaneObjectIndex dut(&object_book_, lane_associations_);
+  const api::Object<Vector3>* object = object_book_.FindById(api::Object<Vector3>::Id("object_0"));
+  EXPECT_THROW(dut.Update(nullptr, {}), maliput::common::assertion_error);
+
+  // Moves object_0 to a range of lane_a and to a new lane.
+  const std::vector<LaneFootprint> footprints{MakeFootprint("lane_a", 1500., 1510.), MakeFootprint("lane_c", 0., 5.)};
+  dut.Update(object, footprints);
+  lane_associations_.footprints.at(object->id()) = footprints;
+  EXPECT_EQ(kNumObjects, dut.num_objects());
+  EXPECT_EQ(std::vector<std::string>({"object_0"}), Ids(dut.FindObjectsOnLane(LaneId("lane_a"), SRange(1505., 2000.))));
+  EXPECT_EQ(std::vector<std::string>({"object_0"}), Ids(dut.FindObjectsOnLane(LaneId("lane_c"), SRange(1., 2.))));
+  for (const std::string lane_id : {"lane_a", "lane_b"}) {
+    EXPECT_EQ(BruteForce(lane_id, 0., 2000.), Ids(dut.FindObjectsOnLane(LaneId(lane_id), SRange(0., 2000.))));
+  }
+
+  EXPECT_TRUE(dut.Remove(object->id()));
+  EXPECT_FALSE(dut.Remove(object->id()));
+  lane_associations_.footprints.erase(object->id());
+  EXPECT_EQ(kNumObjects - 1, dut.num_objects());
+  EXPECT_EQ(nullptr, dut.GetIntervalsOnLane(LaneId("lane_c")));
+  EXPECT_EQ(BruteForce("lane_a", 0., 2000.), Ids(dut.FindObjectsOnLane(LaneId("lane_a"), SRange(0., 2000.))));
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,196 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/lane_occupancy_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/vector.h>
+#include <maliput/test_utilities/mock.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/test_utilities/mock.h"
+#include "maliput_object/test_utilities/mock_math.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::Vector3;
+
+std::unique_ptr<api::Object<Vector3>> MakeObject(const std::string& id) {
+  return std::make_unique<api::Object<Vector3>>(api::Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+                                                std::make_unique<test_utilities::MockBoundingRegion>());
+}
+
+class LaneOccupancyGridTest : public ::testing::Test {
+ public:
+  static constexpr double kLength{100.};
+  static constexpr double kRMin{-2.};
+  static constexpr double kRMax{6.};
+  static constexpr double kSResolution{0.5};
+  static constexpr double kRResolution{0.1};
+
+  // @returns Whether the cell of (@p s, @p r) overlaps with any of @p intervals.
+  static bool BruteForce(const std::map<std::string, LaneObjectInterval>& intervals, double s, double r) {
+    const auto cell = [](double coordinate, double resolution, int num_cells) {
+      return std::clamp(static_cast<int>(std::floor(coordinate / resolution)), 0, num_cells - 1);
+    };
+    const int num_s_cells = static_cast<int>(std::ceil(kLength / kSResolution));
+    const int num_r_cells = static_cast<int>(std::ceil((kRMax - kRMin) / kRResolution));
+    const int s_cell = cell(s, kSResolution, num_s_cells);
+    const int r_cell = cell(r - kRMin, kRResolution, num_r_cells);
+    for (const auto& id_interval : intervals) {
+      const LaneObjectInterval& interval = id_interval.second;
+      if (interval.s_max < 0. || interval.s_min > kLength || interval.r_max < kRMin || interval.r_min > kRMax) {
+        continue;
+      }
+      if (cell(interval.s_min, kSResolution, num_s_cells) <= s_cell &&
+          cell(interval.s_max, kSResolution, num_s_cells) >= s_cell &&
+          cell(interval.r_min - kRMin, kRResolution, num_r_cells) <= r_cell &&
+          cell(interval.r_max - kRMin, kRResolution, num_r_cells) >= r_cell) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+TEST_F(LaneOccupancyGridTest, Constructor) {
+  EXPECT_THROW(LaneOccupancyGrid(-1., kRMin, kRMax, kSResolution, kRResolution), maliput::common::assertion_error);
+  EXPECT_THROW(LaneOccupancyGrid(kLength, kRMax, kRMin, kSResolution, kRResolution), maliput::common::assertion_error);
+  EXPECT_THROW(LaneOccupancyGrid(kLength, kRMin, kRMax, 0., kRResolution), maliput::common::assertion_error);
+  EXPECT_THROW(LaneOccupancyGrid(kLength, kRMin, kRMax, kSResolution, -1.), maliput::common::assertion_error);
+  const LaneOccupancyGrid dut(kLength, kRMin, kRMax, kSResolution, kRResolution);
+  EXPECT_EQ(200, dut.num_s_cells());
+  EXPECT_EQ(80, dut.num_r_cells());
+  EXPECT_EQ(0, dut.num_objects());
+  EXPECT_FALSE(dut.IsOccupied(10., 0.));
+  EXPECT_GT(dut.MemoryUsage().index, 0u);
+}
+
+TEST_F(LaneOccupancyGridTest, UpdateAndRemove) {
+  const auto a = MakeObject("a");
+  const auto b = MakeObject("b");
+  LaneOccupancyGrid dut(kLength, kRMin, kRMax, kSResolution, kRResolution);
+  EXPECT_THROW(dut.Update(LaneObjectInterval{}), maliput::common::assertion_error);
+  dut.Update({a.get(), 10., 15., -1., 1.});
+  dut.Update({b.get(), 14., 20., 0.5, 3.});
+  EXPECT_EQ(2, dut.num_objects());
+  EXPECT_TRUE(dut.IsOccupied(12., 0.));
+  EXPECT_TRUE(dut.IsOccupied(14.2, 0.7));
+  EXPECT_TRUE(dut.IsOccupied(18., 2.5));
+  EXPECT_FALSE(dut.IsOccupied(25., 0.));
+  // Positions out of the grid are not occupied.
+  EXPECT_FALSE(dut.IsOccupied(-1., 0.));
+  EXPECT_FALSE(dut.IsOccupied(12., -3.));
+
+  // Moving "a" keeps the cells it shared with "b" occupied.
+  dut.Update({a.get(), 50., 55., -1., 1.});
+  EXPECT_FALSE(dut.IsOccupied(12., 0.));
+  EXPECT_TRUE(dut.IsOccupied(14.2, 0.7));
+  EXPECT_TRUE(dut.IsOccupied(52., 0.));
+
+  EXPECT_TRUE(dut.Remove(b->id()));
+  EXPECT_FALSE(dut.Remove(b->id()));
+  EXPECT_FALSE(dut.IsOccupied(14.2, 0.7));
+  EXPECT_EQ(1, dut.num_objects());
+}
+
+TEST_F(LaneOccupancyGridTest, MatchesBruteForce) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> s(-5., kLength + 5.);
+  std::uniform_real_distribution<double> r(kRMin - 1., kRMax + 1.);
+  std::uniform_real_distribution<double> size(0.1, 8.);
+  std::vector<std::unique_ptr<api::Object<Vector3>>> objects;
+  std::map<std::string, LaneObjectInterval> intervals;
+  LaneOccupancyGrid dut(kLength, kRMin, kRMax, kSResolution, kRResolution);
+  for (int i = 0; i < 100; ++i) {
+    objects.push_back(MakeObject("object_" + std::to_string(i)));
+  }
+  for (int step = 0; step < 300; ++step) {
+    const api::Object<Vector3>* object = objects[step % objects.size()].get();
+    if (step % 7 == 0) {
+      dut.Remove(object->id());
+      intervals.erase(object->id().string());
+    } else {
+      const double s_min = s(generator);
+      const double r_min = r(generator);
+      const LaneObjectInterval interval{object, s_min, s_min + size(generator), r_min, r_min + size(generator) / 4.};
+      dut.Update(interval);
+      intervals[object->id().string()] = interval;
+    }
+  }
+  ASSERT_EQ(static_cast<int>(intervals.size()), dut.num_objects());
+  for (int i = 0; i < 5000; ++i) {
+    const double query_s = s(generator);
+    const double query_r = r(generator);
+    const bool in_grid = query_s >= 0. && query_s <= kLength && query_r >= kRMin && query_r <= kRMax;
+    EXPECT_EQ(in_grid && BruteForce(intervals, query_s, query_r), dut.IsOccupied(query_s, query_r))
+        << "s: " << query_s << ", r: " << query_r;
+  }
+}
+
+TEST(LaneOccupancyGridsTest, Constructor) {
+  test_utilities::MockObjectQuery object_query;
+  test_utilities::MockObjectBook<Vector3> object_book;
+  EXPECT_CALL(object_query, do_object_book()).WillRepeatedly(::testing::Return(&object_book));
+  EXPECT_THROW(LaneOccupancyGrids(nullptr, 1., 1.), maliput::common::assertion_error);
+  EXPECT_THROW(LaneOccupancyGrids(&object_query, 0., 1.), maliput::common::assertion_error);
+  EXPECT_THROW(LaneOccupancyGrids(&object_query, 1., 0.), maliput::common::assertion_error);
+  LaneOccupancyGrids dut(&object_query, 1., 0.5);
+  EXPECT_THROW(dut.Update(nullptr), maliput::common::assertion_error);
+  EXPECT_FALSE(dut.Remove(api::Object<Vector3>::Id("unknown")));
+  EXPECT_GT(dut.MemoryUsage().index, 0u);
+
+  // Lanes without a grid are not occupied.
+  const std::unique_ptr<maliput::api::Lane> lane = maliput::api::test::CreateLane(maliput::api::LaneId("lane"));
+  EXPECT_EQ(nullptr, dut.GetGrid(lane.get()));
+  EXPECT_FALSE(dut.IsOccupied(lane.get(), 1., 0.));
+  const std::vector<maliput::api::RoadPosition> trajectory{
+      {lane.get(), maliput::api::LanePosition(1., 0., 0.)}, {lane.get(), maliput::api::LanePosition(2., 0., 0.)}};
+  EXPECT_EQ(std::vector<bool>({false, false}), dut.IsOccupied(trajectory));
+  EXPECT_FALSE(dut.FindFirstOccupied(trajectory).has_value());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,175 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/lane_projection_cache.h"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/test_utilities/mock.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::OverlappingType;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+std::unique_ptr<maliput::math::BoundingRegion<Vector3>> MakeBox(const Vector3& position) {
+  return std::make_unique<BoundingBox>(position, Vector3{1., 1., 1.}, RollPitchYaw{}, 1e-3);
+}
+
+std::unique_ptr<api::Object<Vector3>> MakeObject(const std::string& id, const Vector3& position = {0., 0., 0.}) {
+  return std::make_unique<api::Object<Vector3>>(api::Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+                                                MakeBox(position));
+}
+
+// Objects overlap with no Lane, so the tests count the projections the cache computes rather than check their values,
+// which are covered by the integration tests.
+class LaneProjectionCacheTest : public ::testing::Test {
+ public:
+  test_utilities::MockObjectQuery object_query_;
+};
+
+TEST_F(LaneProjectionCacheTest, Constructor) {
+  EXPECT_THROW(LaneProjectionCache(nullptr), maliput::common::assertion_error);
+  const LaneProjectionCache dut(&object_query_);
+  EXPECT_EQ(0, dut.size());
+}
+
+TEST_F(LaneProjectionCacheTest, GetComputesOnceAndInvalidates) {
+  const auto object = MakeObject("object");
+  EXPECT_CALL(object_query_, DoFindOverlappingLanesIn(object.get(), OverlappingType::kIntersected))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(std::vector<const maliput::api::Lane*>{}));
+  LaneProjectionCache dut(&object_query_);
+  EXPECT_EQ(nullptr, dut.Find(object.get()));
+  EXPECT_TRUE(dut.Get(object.get()).empty());
+  // Served from the cache.
+  EXPECT_TRUE(dut.Get(object.get()).empty());
+  ASSERT_NE(nullptr, dut.Find(object.get()));
+  EXPECT_EQ(1, dut.size());
+  EXPECT_GT(dut.MemoryUsage().caches, 0u);
+
+  EXPECT_TRUE(dut.Invalidate(object->id()));
+  EXPECT_FALSE(dut.Invalidate(object->id()));
+  EXPECT_EQ(nullptr, dut.Find(object.get()));
+  EXPECT_TRUE(dut.Get(object.get()).empty());
+  EXPECT_THROW(dut.Find(nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(dut.Get(nullptr), maliput::common::assertion_error);
+}
+
+TEST_F(LaneProjectionCacheTest, ReplacedObjectIsProjectedAgain) {
+  const auto object = MakeObject("object");
+  const auto moved = MakeObject("object", {1., 0., 0.});
+  EXPECT_CALL(object_query_, DoFindOverlappingLanesIn(object.get(), OverlappingType::kIntersected))
+      .Times(1)
+      .WillOnce(::testing::Return(std::vector<const maliput::api::Lane*>{}));
+  EXPECT_CALL(object_query_, DoFindOverlappingLanesIn(moved.get(), OverlappingType::kIntersected))
+      .Times(1)
+      .WillOnce(::testing::Return(std::vector<const maliput::api::Lane*>{}));
+  LaneProjectionCache dut(&object_query_);
+  dut.Get(object.get());
+  // A replacement with the same region has the same projections.
+  const auto same_region = MakeObject("object");
+  EXPECT_NE(nullptr, dut.Find(same_region.get()));
+  EXPECT_EQ(nullptr, dut.Find(moved.get()));
+  dut.Get(moved.get());
+  EXPECT_NE(nullptr, dut.Find(moved.get()));
+  EXPECT_EQ(nullptr, dut.Find(object.get()));
+  EXPECT_EQ(1, dut.size());
+}
+
+TEST_F(LaneProjectionCacheTest, ObjectAtReusedAddressIsProjectedAgain) {
+  // The replacement is built in the storage of the removed Object, so both have the same address and id.
+  std::optional<api::Object<Vector3>> storage;
+  const api::Object<Vector3>* object =
+      &storage.emplace(api::Object<Vector3>::Id("object"), std::map<std::string, std::string>{}, MakeBox({0., 0., 0.}));
+  EXPECT_CALL(object_query_, DoFindOverlappingLanesIn(object, OverlappingType::kIntersected))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(std::vector<const maliput::api::Lane*>{}));
+  LaneProjectionCache dut(&object_query_);
+  dut.Compute({object});
+  storage.reset();
+  const api::Object<Vector3>* replacement =
+      &storage.emplace(api::Object<Vector3>::Id("object"), std::map<std::string, std::string>{}, MakeBox({5., 0., 0.}));
+  ASSERT_EQ(object, replacement);
+  EXPECT_EQ(nullptr, dut.Find(replacement));
+  dut.Compute({replacement});
+  EXPECT_NE(nullptr, dut.Find(replacement));
+  EXPECT_EQ(1, dut.size());
+}
+
+TEST_F(LaneProjectionCacheTest, ComputeInParallel) {
+  constexpr int kNumObjects{50};
+  std::vector<std::unique_ptr<api::Object<Vector3>>> owned_objects;
+  std::vector<const api::Object<Vector3>*> objects;
+  for (int i = 0; i < kNumObjects; ++i) {
+    owned_objects.push_back(MakeObject("object_" + std::to_string(i)));
+    objects.push_back(owned_objects.back().get());
+  }
+  // Every Object is projected once, whatever the number of threads.
+  EXPECT_CALL(object_query_, DoFindOverlappingLanesIn(::testing::_, OverlappingType::kIntersected))
+      .Times(kNumObjects)
+      .WillRepeatedly(::testing::Return(std::vector<const maliput::api::Lane*>{}));
+  LaneProjectionCache dut(&object_query_);
+  EXPECT_THROW(dut.Compute(objects, -1), maliput::common::assertion_error);
+  dut.Compute(std::vector<const api::Object<Vector3>*>(objects.begin(), objects.begin() + 10), 1);
+  dut.Compute(objects, 4);
+  dut.Compute(objects);
+  EXPECT_EQ(kNumObjects, dut.size());
+  for (const api::Object<Vector3>* object : objects) {
+    EXPECT_NE(nullptr, dut.Find(object));
+  }
+  EXPECT_THROW(dut.Compute({nullptr}), maliput::common::assertion_error);
+  dut.Clear();
+  EXPECT_EQ(0, dut.size());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
@@ -29,15 +29,23 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_object/base/manual_object_book.h"
 
+#include <algorithm>
+#include <chrono>
+#include <future>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
 #include <maliput/math/bounding_region.h>
+#include <maliput/math/roll_pitch_yaw.h>
 #include <maliput/math/vector.h>
 
 #include "maliput_object/api/object.h"
@@ -104,6 +112,220 @@ TEST_F(ManualObjectBookTest, ManualObjectBook) {
   EXPECT_EQ(1, static_cast<int>(dut_.objects().size()));
 }
 
+TEST(ManualObjectBookConstructorTest, NegativeIndexTolerance) {
+  EXPECT_THROW(ManualObjectBook<Vector3>(-1.), maliput::common::assertion_error);
+}
+
+// Verifies that queries served by the spatial index built by AddObjects() match the ones of a linear search.
+class ManualObjectBookIndexTest : public ::testing::Test {
+ public:
+  static constexpr double kTolerance{1e-3};
+
+  static std::unique_ptr<api::Object<Vector3>> MakeBoxObject(const std::string& id, const Vector3& position) {
+    return std::make_unique<api::Object<Vector3>>(
+        api::Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+        std::make_unique<maliput::math::BoundingBox>(position, Vector3{1., 1., 1.},
+                                                     maliput::math::RollPitchYaw{0., 0., 0.}, kTolerance));
+  }
+
+  static std::vector<std::unique_ptr<api::Object<Vector3>>> MakeRowOfBoxes(int count) {
+    std::vector<std::unique_ptr<api::Object<Vector3>>> objects;
+    for (int i = 0; i < count; ++i) {
+      objects.push_back(MakeBoxObject("box_" + std::to_string(i), Vector3{2. * i, 0., 0.}));
+    }
+    return objects;
+  }
+
+  static std::vector<std::string> SortedIds(const std::vector<api::Object<Vector3>*>& objects) {
+    std::vector<std::string> ids;
+    for (const auto* object : objects) {
+      ids.push_back(object->id().string());
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  static constexpr int kNumObjects{100};
+  const maliput::math::BoundingBox kRegion{Vector3{10., 0., 0.}, Vector3{5., 1., 1.},
+                                           maliput::math::RollPitchYaw{0., 0., 0.}, kTolerance};
+};
+
+TEST_F(ManualObjectBookIndexTest, AddObjects) {
+  ManualObjectBook<Vector3> linear_book;
+  for (auto& object : MakeRowOfBoxes(kNumObjects)) {
+    linear_book.AddObject(std::move(object));
+  }
+  ManualObjectBook<Vector3> dut;
+  std::vector<std::unique_ptr<api::Object<Vector3>>> null_objects;
+  null_objects.push_back(nullptr);
+  EXPECT_THROW(dut.AddObjects(std::move(null_objects)), maliput::common::assertion_error);
+  dut.AddObjects(MakeRowOfBoxes(kNumObjects));
+  EXPECT_EQ(kNumObjects, static_cast<int>(dut.objects().size()));
+
+  for (const auto overlapping_type : {maliput::math::OverlappingType::kIntersected,
+                                      maliput::math::OverlappingType::kContained,
+                                      maliput::math::OverlappingType::kDisjointed}) {
+    EXPECT_EQ(SortedIds(linear_book.FindOverlappingIn(kRegion, overlapping_type)),
+              SortedIds(dut.FindOverlappingIn(kRegion, overlapping_type)));
+  }
+  EXPECT_EQ(std::vector<std::string>({"box_4", "box_5", "box_6"}),
+            SortedIds(dut.FindOverlappingIn(kRegion, maliput::math::OverlappingType::kIntersected)));
+}
+
+TEST_F(ManualObjectBookIndexTest, AddAndRemoveAfterAddObjects) {
+  ManualObjectBook<Vector3> dut;
+  dut.AddObjects(MakeRowOfBoxes(kNumObjects));
+  // Added after the index is built.
+  dut.AddObject(MakeBoxObject("late_box", Vector3{10., 1., 0.}));
+  dut.RemoveObject(api::Object<Vector3>::Id("box_5"));
+  EXPECT_EQ(std::vector<std::string>({"box_4", "box_6", "late_box"}),
+            SortedIds(dut.FindOverlappingIn(kRegion, maliput::math::OverlappingType::kIntersected)));
+  dut.RemoveObject(api::Object<Vector3>::Id("late_box"));
+  EXPECT_EQ(std::vector<std::string>({"box_4", "box_6"}),
+            SortedIds(dut.FindOverlappingIn(kRegion, maliput::math::OverlappingType::kIntersected)));
+  // Rebuilds the index with every object in the book.
+  dut.AddObjects({});
+  EXPECT_EQ(kNumObjects - 1, static_cast<int>(dut.objects().size()));
+  EXPECT_EQ(std::vector<std::string>({"box_4", "box_6"}),
+            SortedIds(dut.FindOverlappingIn(kRegion, maliput::math::OverlappingType::kIntersected)));
+}
+
+TEST_F(ManualObjectBookIndexTest, AddObjectsAsync) {
+  ManualObjectBook<Vector3> dut;
+  EXPECT_EQ(std::future_status::ready, dut.index_ready().wait_for(std::chrono::seconds(0)));
+  bool callback_called{false};
+  const std::shared_future<void> index_ready =
+      dut.AddObjectsAsync(MakeRowOfBoxes(kNumObjects), [&callback_called]() { callback_called = true; });
+  // Queries are answered right away, either by linear search or by the index.
+  EXPECT_EQ(kNumObjects, static_cast<int>(dut.objects().size()));
+  EXPECT_EQ(std::vector<std::string>({"box_4", "box_5", "box_6"}),
+            SortedIds(dut.FindOverlappingIn(kRegion, maliput::math::OverlappingType::kIntersected)));
+  index_ready.wait();
+  EXPECT_TRUE(callback_called);
+  EXPECT_EQ(std::future_status::ready, dut.index_ready().wait_for(std::chrono::seconds(0)));
+  EXPECT_EQ(std::vector<std::string>({"box_4", "box_5", "box_6"}),
+            SortedIds(dut.FindOverlappingIn(kRegion, maliput::math::OverlappingType::kIntersected)));
+  // Modifications wait for the pending build.
+  dut.AddObjectsAsync({});
+  dut.RemoveObject(api::Object<Vector3>::Id("box_5"));
+  EXPECT_EQ(std::vector<std::string>({"box_4", "box_6"}),
+            SortedIds(dut.FindOverlappingIn(kRegion, maliput::math::OverlappingType::kIntersected)));
+}
+
+TEST_F(ManualObjectBookIndexTest, FindNearestAndWithinDistance) {
+  ManualObjectBook<Vector3> linear_book;
+  for (auto& object : MakeRowOfBoxes(kNumObjects)) {
+    linear_book.AddObject(std::move(object));
+  }
+  ManualObjectBook<Vector3> dut;
+  dut.AddObjects(MakeRowOfBoxes(kNumObjects));
+  const auto ids = [](const std::vector<api::Object<Vector3>*>& objects) {
+    std::vector<std::string> ids;
+    for (const auto* object : objects) {
+      ids.push_back(object->id().string());
+    }
+    return ids;
+  };
+  const Vector3 kPosition{10.2, 0., 0.};
+  const auto not_box_5 = [](const api::Object<Vector3>* object) { return object->id().string() != "box_5"; };
+
+  for (const ManualObjectBook<Vector3>* book : {&linear_book, &dut}) {
+    EXPECT_EQ(std::vector<std::string>({"box_5", "box_6", "box_4"}), ids(book->FindNearest(kPosition, 3)));
+    EXPECT_EQ(std::vector<std::string>({"box_6", "box_4", "box_7"}), ids(book->FindNearest(kPosition, 3, not_box_5)));
+    EXPECT_EQ(kNumObjects, static_cast<int>(book->FindNearest(kPosition, 2 * kNumObjects).size()));
+    EXPECT_TRUE(book->FindNearest(kPosition, 0).empty());
+    // Ties are sorted by id.
+    EXPECT_EQ(std::vector<std::string>({"box_5", "box_6"}), ids(book->FindNearest(Vector3{11., 0., 0.}, 2)));
+    EXPECT_EQ(std::vector<std::string>({"box_5", "box_6"}), ids(book->FindWithinDistance(kPosition, 1.5)));
+    EXPECT_EQ(std::vector<std::string>({"box_5"}), ids(book->FindWithinDistance(kPosition, 0.)));
+    EXPECT_THROW(book->FindNearest(kPosition, -1), maliput::common::assertion_error);
+    EXPECT_THROW(book->FindWithinDistance(kPosition, -1.), maliput::common::assertion_error);
+  }
+
+  // Objects added after the index is built are found too.
+  dut.AddObject(MakeBoxObject("late_box", Vector3{10.2, 1., 0.}));
+  EXPECT_EQ(std::vector<std::string>({"box_5", "late_box"}), ids(dut.FindNearest(kPosition, 2)));
+  EXPECT_EQ(std::vector<std::string>({"box_5", "late_box", "box_6"}), ids(dut.FindWithinDistance(kPosition, 1.5)));
+}
+
+TEST_F(ManualObjectBookIndexTest, RayCastAndFindInFrustum) {
+  ManualObjectBook<Vector3> linear_book;
+  for (auto& object : MakeRowOfBoxes(kNumObjects)) {
+    linear_book.AddObject(std::move(object));
+  }
+  ManualObjectBook<Vector3> dut;
+  dut.AddObjects(MakeRowOfBoxes(kNumObjects));
+  const auto ids = [](const std::vector<api::RayHit<Vector3>>& hits) {
+    std::vector<std::string> ids;
+    for (const auto& hit : hits) {
+      ids.push_back(hit.object->id().string());
+    }
+    return ids;
+  };
+  const std::vector<api::Ray<Vector3>> kRays{
+      {{-5., 0., 0.}, {1., 0., 0.}, 100.},
+      {{200., 0., 0.}, {-1., 0., 0.}, 100.},
+      {{10., 5., 0.}, {0., -1., 0.}, 10.},
+      {{10., 5., 0.}, {0., 1., 0.}, 10.},
+  };
+  // The half space 5 <= x <= 11.
+  const api::Frustum<Vector3> kFrustum{{{{1., 0., 0.}, -5.}, {{-1., 0., 0.}, 11.}}};
+
+  for (const ManualObjectBook<Vector3>* book : {&linear_book, &dut}) {
+    const std::optional<api::RayHit<Vector3>> hit = book->RayCast({-5., 0., 0.}, {3., 0., 0.}, 100.);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ("box_0", hit->object->id().string());
+    EXPECT_DOUBLE_EQ(4.5, hit->distance);
+    EXPECT_FALSE(book->RayCast({-5., 0., 0.}, {1., 0., 0.}, 4.).has_value());
+    EXPECT_FALSE(book->RayCast({-5., 0., 0.}, {-1., 0., 0.}, 100.).has_value());
+    const std::vector<api::RayHit<Vector3>> hits = book->RayCastAll({-5., 0., 0.}, {1., 0., 0.}, 9.);
+    EXPECT_EQ(std::vector<std::string>({"box_0", "box_1", "box_2"}), ids(hits));
+    EXPECT_DOUBLE_EQ(6.5, hits[1].distance);
+
+    const std::vector<std::optional<api::RayHit<Vector3>>> packet_hits = book->RayCast(kRays);
+    ASSERT_EQ(kRays.size(), packet_hits.size());
+    EXPECT_EQ("box_0", packet_hits[0]->object->id().string());
+    EXPECT_EQ("box_99", packet_hits[1]->object->id().string());
+    EXPECT_DOUBLE_EQ(1.5, packet_hits[1]->distance);
+    EXPECT_EQ("box_5", packet_hits[2]->object->id().string());
+    EXPECT_DOUBLE_EQ(4.5, packet_hits[2]->distance);
+    EXPECT_FALSE(packet_hits[3].has_value());
+
+    EXPECT_EQ(std::vector<std::string>({"box_3", "box_4", "box_5"}), SortedIds(book->FindInFrustum(kFrustum)));
+    EXPECT_EQ(kNumObjects, static_cast<int>(book->FindInFrustum(api::Frustum<Vector3>{}).size()));
+
+    EXPECT_THROW(book->RayCast({0., 0., 0.}, {0., 0., 0.}, 1.), maliput::common::assertion_error);
+    EXPECT_THROW(book->RayCastAll({0., 0., 0.}, {1., 0., 0.}, -1.), maliput::common::assertion_error);
+  }
+
+  // Objects added after the index is built are hit too, and ties are broken by id.
+  dut.AddObject(MakeBoxObject("a_box", Vector3{0., 0., 0.}));
+  EXPECT_EQ("a_box", dut.RayCast({-5., 0., 0.}, {1., 0., 0.}, 100.)->object->id().string());
+  EXPECT_EQ("a_box", dut.RayCast(kRays)[0]->object->id().string());
+  EXPECT_EQ(std::vector<std::string>({"a_box", "box_0"}), ids(dut.RayCastAll({-5., 0., 0.}, {1., 0., 0.}, 5.)));
+  dut.AddObject(MakeBoxObject("late_box", Vector3{8., 0., 0.}));
+  EXPECT_EQ(std::vector<std::string>({"box_3", "box_4", "box_5", "late_box"}), SortedIds(dut.FindInFrustum(kFrustum)));
+}
+
+TEST_F(ManualObjectBookIndexTest, FindAllOverlappingPairs) {
+  ManualObjectBook<Vector3> dut;
+  dut.AddObjects(MakeRowOfBoxes(kNumObjects));
+  EXPECT_TRUE(dut.FindAllOverlappingPairs().empty());
+  dut.AddObject(MakeBoxObject("a_box", Vector3{0.5, 0., 0.}));
+  dut.AddObject(MakeBoxObject("late_box", Vector3{8.4, 0., 0.}));
+  const auto pairs = dut.FindAllOverlappingPairs();
+  std::vector<std::pair<std::string, std::string>> ids;
+  for (const auto& pair : pairs) {
+    ids.emplace_back(pair.first->id().string(), pair.second->id().string());
+  }
+  EXPECT_EQ((std::vector<std::pair<std::string, std::string>>{{"a_box", "box_0"}, {"box_4", "late_box"}}), ids);
+
+  // Removed objects leave the pairs.
+  dut.RemoveObject(api::Object<Vector3>::Id("box_4"));
+  dut.RemoveObject(api::Object<Vector3>::Id("a_box"));
+  EXPECT_TRUE(dut.FindAllOverlappingPairs().empty());
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace object
@@ -0,0 +1,138 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/memory_usage.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/bounding_volume_hierarchy.h"
+#include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/base/shared_memory_object_book.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+std::unique_ptr<api::Object<Vector3>> MakeBoxObject(const std::string& id,
+                                                    const std::map<std::string, std::string>& properties,
+                                                    const Vector3& position) {
+  return std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id(id), properties,
+      std::make_unique<BoundingBox>(position, Vector3(1., 1., 1.), RollPitchYaw(0., 0., 0.), kTolerance));
+}
+
+TEST(MemoryUsageTest, Estimators) {
+  EXPECT_EQ(0u, EstimateHeapSize(""));
+  const std::string long_string(100, 'a');
+  EXPECT_GT(EstimateHeapSize(long_string), long_string.size());
+  EXPECT_EQ(3 * sizeof(void*), EstimateHashTableSize(3, 0, 8));
+  EXPECT_GT(EstimateHashTableSize(3, 2, 8), EstimateHashTableSize(3, 1, 8));
+
+  MemoryUsageReport report;
+  report.objects = 1;
+  report.mapped = 2;
+  report += report;
+  EXPECT_EQ(2u, report.objects);
+  EXPECT_EQ(4u, report.mapped);
+  EXPECT_EQ(6u, report.total());
+}
+
+TEST(MemoryUsageTest, Object) {
+  const auto small_object = MakeBoxObject("id", {}, Vector3(0., 0., 0.));
+  const MemoryUsageReport small_report = EstimateMemoryUsage(*small_object);
+  EXPECT_EQ(sizeof(api::Object<Vector3>), small_report.objects);
+  EXPECT_EQ(sizeof(BoundingBox), small_report.bounding_regions);
+  EXPECT_EQ(0u, small_report.ids);
+  EXPECT_EQ(0u, small_report.properties);
+
+  const std::string long_id(64, 'i');
+  const auto large_object = MakeBoxObject(long_id, {{"key", std::string(64, 'v')}}, Vector3(0., 0., 0.));
+  const MemoryUsageReport large_report = EstimateMemoryUsage(*large_object);
+  EXPECT_GT(large_report.ids, long_id.size());
+  EXPECT_GT(large_report.properties, 64u);
+}
+
+TEST(MemoryUsageTest, ManualObjectBook) {
+  constexpr int kNumObjects{100};
+  ManualObjectBook<Vector3> dut(kTolerance);
+  const MemoryUsageReport empty_report = dut.MemoryUsage();
+  EXPECT_EQ(0u, empty_report.objects);
+  EXPECT_EQ(0u, empty_report.index);
+
+  std::vector<std::unique_ptr<api::Object<Vector3>>> objects;
+  for (int i = 0; i < kNumObjects; ++i) {
+    objects.push_back(MakeBoxObject(std::to_string(i), {{"type", "box"}}, Vector3(2. * i, 0., 0.)));
+  }
+  dut.AddObjects(std::move(objects));
+  const MemoryUsageReport report = dut.MemoryUsage();
+  EXPECT_EQ(kNumObjects * sizeof(api::Object<Vector3>), report.objects);
+  EXPECT_EQ(kNumObjects * sizeof(BoundingBox), report.bounding_regions);
+  EXPECT_GT(report.properties, 0u);
+  EXPECT_GT(report.containers, empty_report.containers);
+  EXPECT_GT(report.index, 0u);
+  EXPECT_EQ(0u, report.mapped);
+
+  const BoundingVolumeHierarchy<Vector3> index({}, kTolerance);
+  EXPECT_EQ(index.MemoryUsage().total(), index.MemoryUsage().index);
+}
+
+TEST(MemoryUsageTest, SharedMemoryObjectBook) {
+  ManualObjectBook<Vector3> object_book(kTolerance);
+  object_book.AddObject(MakeBoxObject("0", {}, Vector3(0., 0., 0.)));
+  object_book.AddObject(MakeBoxObject("1", {}, Vector3(2., 0., 0.)));
+  const std::string filename = ::testing::TempDir() + "memory_usage_test.bin";
+  SharedMemoryObjectBook::Write(filename, object_book);
+
+  const SharedMemoryObjectBook dut(filename);
+  EXPECT_EQ(dut.mapped_size(), dut.MemoryUsage().mapped);
+  EXPECT_EQ(0u, dut.MemoryUsage().objects);
+  dut.FindById(api::Object<Vector3>::Id("1"));
+  EXPECT_EQ(sizeof(api::Object<Vector3>), dut.MemoryUsage().objects);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
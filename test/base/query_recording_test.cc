@@ -0,0 +1,462 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/query_recording.h"
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+#include <maliput/test_utilities/mock.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/base/recording_object_book.h"
+#include "maliput_object/base/recording_object_query.h"
+#include "maliput_object/test_utilities/mock.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::api::LaneId;
+using maliput::api::SRange;
+using maliput::math::BoundingBox;
+using maliput::math::OverlappingType;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+std::unique_ptr<api::Object<Vector3>> MakeBoxObject(const std::string& id, const Vector3& position) {
+  return std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id(id), std::map<std::string, std::string>{{"type", "box"}},
+      std::make_unique<BoundingBox>(position, Vector3(1., 1., 1.), RollPitchYaw(0., 0., 0.), kTolerance));
+}
+
+class QueryRecordingTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    for (int i = 0; i < kNumObjects; ++i) {
+      object_book_.AddObject(MakeBoxObject(std::to_string(i), Vector3(2. * i, 0., 0.)));
+    }
+    object_book_.AddObjects({});
+  }
+
+  // Records one call of every ObjectBook method.
+  void RecordCalls() {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectBook dut(&object_book_, &recorder);
+    EXPECT_EQ(kNumObjects, static_cast<int>(dut.objects().size()));
+    EXPECT_NE(nullptr, dut.FindById(api::Object<Vector3>::Id("1")));
+    EXPECT_EQ(nullptr, dut.FindById(api::Object<Vector3>::Id("unknown")));
+    EXPECT_EQ(kNumObjects,
+              static_cast<int>(dut.FindByPredicate([](const api::Object<Vector3>*) { return true; }).size()));
+    const BoundingBox region(Vector3(3., 0., 0.), Vector3(4., 1., 1.), RollPitchYaw(0., 0., 0.), kTolerance);
+    EXPECT_EQ(2, static_cast<int>(dut.FindOverlappingIn(region, OverlappingType::kIntersected).size()));
+  }
+
+  static constexpr int kNumObjects{10};
+  const std::string filename_{::testing::TempDir() + "query_recording_test.rec"};
+  ManualObjectBook<Vector3> object_book_;
+};
+
+TEST_F(QueryRecordingTest, RoundTrip) {
+  RecordCalls();
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(5u, records.size());
+
+  EXPECT_EQ(QueryRecord::Method::kObjects, records[0].method);
+  EXPECT_EQ(static_cast<std::size_t>(kNumObjects), records[0].result_ids.size());
+
+  EXPECT_EQ(QueryRecord::Method::kFindById, records[1].method);
+  EXPECT_EQ(std::vector<std::string>{"1"}, records[1].object_ids);
+  EXPECT_EQ(std::vector<std::string>{"1"}, records[1].result_ids);
+  EXPECT_EQ(std::vector<std::string>{"unknown"}, records[2].object_ids);
+  EXPECT_TRUE(records[2].result_ids.empty());
+
+  EXPECT_EQ(QueryRecord::Method::kFindByPredicate, records[3].method);
+  EXPECT_TRUE(records[3].has_predicate);
+  EXPECT_EQ(static_cast<std::size_t>(kNumObjects), records[3].predicate_ids.size());
+
+  EXPECT_EQ(QueryRecord::Method::kFindOverlappingIn, records[4].method);
+  ASSERT_TRUE(records[4].region.has_value());
+  EXPECT_EQ(Vector3(3., 0., 0.), records[4].region->position);
+  EXPECT_EQ(Vector3(4., 1., 1.), records[4].region->box_size);
+  ASSERT_TRUE(records[4].overlapping_type.has_value());
+  EXPECT_EQ(OverlappingType::kIntersected, records[4].overlapping_type.value());
+  EXPECT_THAT(records[4].result_ids, ::testing::UnorderedElementsAre("1", "2"));
+
+  for (std::size_t i = 1; i < records.size(); ++i) {
+    EXPECT_LE(records[i - 1].start, records[i].start);
+  }
+}
+
+TEST_F(QueryRecordingTest, ReplayOnTheSameBook) {
+  RecordCalls();
+  const ReplayReport report = Replay(ReadQueryRecording(filename_), &object_book_, nullptr, 3);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+  EXPECT_EQ(1u, report.methods.count(QueryRecord::Method::kFindByPredicate));
+  ASSERT_EQ(1u, report.methods.count(QueryRecord::Method::kFindById));
+  const ReplayReport::MethodReport& find_by_id = report.methods.at(QueryRecord::Method::kFindById);
+  EXPECT_EQ(2, find_by_id.num_calls);
+  EXPECT_EQ(0, find_by_id.num_mismatches);
+  for (const int percentile : ReplayReport::kPercentiles) {
+    EXPECT_EQ(1u, find_by_id.recorded_latencies.count(percentile));
+    EXPECT_EQ(1u, find_by_id.replayed_latencies.count(percentile));
+  }
+}
+
+TEST_F(QueryRecordingTest, BufferAndVisitorOverloads) {
+  const BoundingBox region(Vector3(3., 0., 0.), Vector3(4., 1., 1.), RollPitchYaw(0., 0., 0.), kTolerance);
+  const auto predicate = [](const api::Object<Vector3>* object) { return object->id().string() == "3"; };
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectBook dut(&object_book_, &recorder);
+    std::vector<api::Object<Vector3>*> objects;
+    dut.FindByPredicate(predicate, &objects);
+    EXPECT_EQ(1u, objects.size());
+    int num_visited{0};
+    dut.VisitOverlappingIn(region, OverlappingType::kIntersected,
+                           [&num_visited](api::Object<Vector3>*) { ++num_visited; });
+    EXPECT_EQ(2, num_visited);
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(2u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kFindByPredicate, records[0].method);
+  EXPECT_EQ(std::vector<std::string>{"3"}, records[0].result_ids);
+  EXPECT_EQ(std::vector<std::string>{"3"}, records[0].predicate_ids);
+  EXPECT_EQ(QueryRecord::Method::kFindOverlappingIn, records[1].method);
+  ASSERT_TRUE(records[1].region.has_value());
+  EXPECT_THAT(records[1].result_ids, ::testing::UnorderedElementsAre("1", "2"));
+
+  const ReplayReport report = Replay(records, &object_book_, nullptr);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+}
+
+TEST_F(QueryRecordingTest, FindNearestAndFindWithinDistance) {
+  const auto predicate = [](const api::Object<Vector3>* object) { return object->id().string() != "0"; };
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectBook dut(&object_book_, &recorder);
+    EXPECT_EQ(2u, dut.FindNearest(Vector3(0., 0., 0.), 2, predicate).size());
+    EXPECT_EQ(2u, dut.FindWithinDistance(Vector3(1., 0., 0.), 1.5).size());
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(2u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kFindNearest, records[0].method);
+  EXPECT_EQ((std::vector<double>{0., 0., 0., 2.}), records[0].parameters);
+  EXPECT_TRUE(records[0].has_predicate);
+  EXPECT_EQ(static_cast<std::size_t>(kNumObjects - 1), records[0].predicate_ids.size());
+  EXPECT_EQ((std::vector<std::string>{"1", "2"}), records[0].result_ids);
+  EXPECT_EQ(QueryRecord::Method::kFindWithinDistance, records[1].method);
+  EXPECT_EQ((std::vector<double>{1., 0., 0., 1.5}), records[1].parameters);
+  EXPECT_THAT(records[1].result_ids, ::testing::UnorderedElementsAre("0", "1"));
+
+  const ReplayReport report = Replay(records, &object_book_, nullptr);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+  object_book_.RemoveObject(api::Object<Vector3>::Id("1"));
+  EXPECT_EQ((std::vector<std::size_t>{0, 1}), Replay(records, &object_book_, nullptr).mismatched_records);
+}
+
+TEST_F(QueryRecordingTest, RayCastAndFindInFrustum) {
+  api::Frustum<Vector3> frustum;
+  frustum.planes.push_back({Vector3(-1., 0., 0.), 3.});
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectBook dut(&object_book_, &recorder);
+    EXPECT_EQ(static_cast<std::size_t>(kNumObjects),
+              dut.RayCastAll(Vector3(-1., 0., 0.), Vector3(2., 0., 0.), 100.).size());
+    EXPECT_EQ(2u, dut.RayCast({{Vector3(-1., 0., 0.), Vector3(1., 0., 0.), 100.},
+                               {Vector3(5., 0., 0.), Vector3(-1., 0., 0.), 100.}})
+                      .size());
+    EXPECT_EQ(2u, dut.FindInFrustum(frustum).size());
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(3u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kRayCastAll, records[0].method);
+  EXPECT_EQ((std::vector<double>{-1., 0., 0., 1., 0., 0., 100.}), records[0].parameters);
+  EXPECT_EQ(QueryRecord::Method::kRayCast, records[1].method);
+  EXPECT_EQ(14u, records[1].parameters.size());
+  EXPECT_EQ((std::vector<std::string>{"0", "2"}), records[1].result_ids);
+  EXPECT_EQ(QueryRecord::Method::kFindInFrustum, records[2].method);
+  EXPECT_EQ((std::vector<double>{-1., 0., 0., 3.}), records[2].parameters);
+  EXPECT_THAT(records[2].result_ids, ::testing::UnorderedElementsAre("0", "1"));
+
+  const ReplayReport report = Replay(records, &object_book_, nullptr);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+  object_book_.RemoveObject(api::Object<Vector3>::Id("0"));
+  EXPECT_EQ((std::vector<std::size_t>{0, 1, 2}), Replay(records, &object_book_, nullptr).mismatched_records);
+}
+
+TEST_F(QueryRecordingTest, FindAllOverlappingPairs) {
+  object_book_.AddObject(MakeBoxObject("overlapping", Vector3(2.5, 0., 0.)));
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectBook dut(&object_book_, &recorder);
+    EXPECT_EQ(1u, dut.FindAllOverlappingPairs().size());
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(1u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kFindAllOverlappingPairs, records[0].method);
+  EXPECT_EQ((std::vector<std::string>{"1", "overlapping"}), records[0].result_ids);
+
+  const ReplayReport report = Replay(records, &object_book_, nullptr);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+  object_book_.RemoveObject(api::Object<Vector3>::Id("overlapping"));
+  EXPECT_EQ((std::vector<std::size_t>{0}), Replay(records, &object_book_, nullptr).mismatched_records);
+}
+
+TEST_F(QueryRecordingTest, FindObjectsOnLane) {
+  const api::Object<Vector3>* object = object_book_.FindById(api::Object<Vector3>::Id("1"));
+  test_utilities::MockObjectQuery object_query;
+  EXPECT_CALL(object_query, DoFindObjectsOnLane(LaneId("lane"), ::testing::_))
+      .WillRepeatedly([object](const LaneId&, const SRange& s_range) {
+        return s_range.s0() == 1. && s_range.s1() == 2. ? std::vector<const api::Object<Vector3>*>{object}
+                                                         : std::vector<const api::Object<Vector3>*>{};
+      });
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectQuery dut(&object_query, &recorder);
+    EXPECT_EQ(1u, dut.FindObjectsOnLane(LaneId("lane"), SRange(1., 2.)).size());
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(1u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kFindObjectsOnLane, records[0].method);
+  EXPECT_EQ(std::vector<std::string>{"lane"}, records[0].object_ids);
+  EXPECT_EQ((std::vector<double>{1., 2.}), records[0].parameters);
+  EXPECT_EQ(std::vector<std::string>{"1"}, records[0].result_ids);
+
+  const ReplayReport report = Replay(records, &object_book_, &object_query);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+  EXPECT_EQ(1, Replay(records, &object_book_, nullptr).num_skipped);
+}
+
+TEST_F(QueryRecordingTest, FindObjectsAlongRoute) {
+  const api::Object<Vector3>* object = object_book_.FindById(api::Object<Vector3>::Id("1"));
+  test_utilities::MockObjectQuery object_query;
+  EXPECT_CALL(object_query, DoFindObjectsAlongRoute(::testing::_, 0.5))
+      .WillRepeatedly([object](const maliput::api::LaneSRoute& route, double) {
+        return route.ranges().size() == 2 && route.ranges()[1].lane_id() == LaneId("b") &&
+                       route.ranges()[1].s_range().s1() == 4.
+                   ? std::vector<api::ObjectAlongRoute>{{object, 3.}}
+                   : std::vector<api::ObjectAlongRoute>{};
+      });
+  const maliput::api::LaneSRoute route(
+      {maliput::api::LaneSRange(LaneId("a"), SRange(0., 1.)), maliput::api::LaneSRange(LaneId("b"), SRange(2., 4.))});
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectQuery dut(&object_query, &recorder);
+    EXPECT_EQ(1u, dut.FindObjectsAlongRoute(route, 0.5).size());
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(1u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kFindObjectsAlongRoute, records[0].method);
+  EXPECT_EQ((std::vector<std::string>{"a", "b"}), records[0].object_ids);
+  EXPECT_EQ((std::vector<double>{0., 1., 2., 4., 0.5}), records[0].parameters);
+  EXPECT_EQ(std::vector<std::string>{"1"}, records[0].result_ids);
+
+  const ReplayReport report = Replay(records, &object_book_, &object_query);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+}
+
+TEST_F(QueryRecordingTest, FindNextObjectsAhead) {
+  const api::Object<Vector3>* object = object_book_.FindById(api::Object<Vector3>::Id("1"));
+  const std::unique_ptr<maliput::api::Lane> lane = maliput::api::test::CreateLane(LaneId("lane"));
+  test_utilities::MockObjectQuery object_query;
+  EXPECT_CALL(object_query, do_object_book()).WillRepeatedly(::testing::Return(&object_book_));
+  EXPECT_CALL(object_query, DoFindNextObjectsAhead(::testing::_, 20., ::testing::_))
+      .WillRepeatedly(::testing::Return(std::vector<api::ObjectAhead>{{object, 5.}}));
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectQuery dut(&object_query, &recorder);
+    const maliput::api::RoadPosition road_position(lane.get(), maliput::api::LanePosition(1., 2., 3.));
+    const auto predicate = [](const api::Object<Vector3>* object) {
+      return object->id().string() == "1" || object->id().string() == "2";
+    };
+    EXPECT_EQ(1u, dut.FindNextObjectsAhead(road_position, 20., predicate).size());
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(1u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kFindNextObjectsAhead, records[0].method);
+  EXPECT_EQ(std::vector<std::string>{"lane"}, records[0].object_ids);
+  EXPECT_EQ((std::vector<double>{1., 2., 3., 20.}), records[0].parameters);
+  EXPECT_TRUE(records[0].has_predicate);
+  EXPECT_THAT(records[0].predicate_ids, ::testing::UnorderedElementsAre("1", "2"));
+  EXPECT_EQ(std::vector<std::string>{"1"}, records[0].result_ids);
+
+  // The Lane cannot be found without a RoadNetwork.
+  EXPECT_CALL(object_query, do_road_network()).WillRepeatedly(::testing::Return(nullptr));
+  EXPECT_EQ(1, Replay(records, &object_book_, &object_query).num_skipped);
+}
+
+TEST_F(QueryRecordingTest, FindFreeGaps) {
+  test_utilities::MockObjectQuery object_query;
+  EXPECT_CALL(object_query, DoFindFreeGaps(LaneId("lane"), ::testing::_, 2.))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(std::vector<SRange>{SRange(0., 3.)}));
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectQuery dut(&object_query, &recorder);
+    EXPECT_EQ(1u, dut.FindFreeGaps(LaneId("lane"), SRange(0., 10.), 2.).size());
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(1u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kFindFreeGaps, records[0].method);
+  EXPECT_EQ(std::vector<std::string>{"lane"}, records[0].object_ids);
+  EXPECT_EQ((std::vector<double>{0., 10., 2.}), records[0].parameters);
+
+  const ReplayReport report = Replay(records, &object_book_, &object_query);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+  EXPECT_EQ(1, report.methods.at(QueryRecord::Method::kFindFreeGaps).num_calls);
+}
+
+TEST_F(QueryRecordingTest, RouteAvoiding) {
+  const api::Object<Vector3>* origin = object_book_.FindById(api::Object<Vector3>::Id("0"));
+  const api::Object<Vector3>* target = object_book_.FindById(api::Object<Vector3>::Id("9"));
+  const maliput::api::LaneSRoute route({maliput::api::LaneSRange(LaneId("detour"), SRange(0., 10.))});
+  test_utilities::MockObjectQuery object_query;
+  EXPECT_CALL(object_query, do_object_book()).WillRepeatedly(::testing::Return(&object_book_));
+  EXPECT_CALL(object_query, DoRoute(origin, target, ::testing::_))
+      .Times(2)
+      .WillRepeatedly([route, this](const api::Object<Vector3>*, const api::Object<Vector3>*,
+                                    const api::RouteAvoidance& avoidance) {
+        EXPECT_EQ("barriers", avoidance.cache_key);
+        EXPECT_EQ(api::RouteAvoidance::Mode::kPenalize, avoidance.mode);
+        EXPECT_EQ(5., avoidance.penalty);
+        EXPECT_TRUE(avoidance.predicate(object_book_.FindById(api::Object<Vector3>::Id("4"))));
+        EXPECT_FALSE(avoidance.predicate(object_book_.FindById(api::Object<Vector3>::Id("5"))));
+        return std::make_optional(route);
+      });
+  api::RouteAvoidance avoidance;
+  avoidance.predicate = [](const api::Object<Vector3>* object) { return object->id().string() == "4"; };
+  avoidance.cache_key = "barriers";
+  avoidance.mode = api::RouteAvoidance::Mode::kPenalize;
+  avoidance.penalty = 5.;
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectQuery dut(&object_query, &recorder);
+    EXPECT_TRUE(dut.Route(origin, target, avoidance).has_value());
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(1u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kRouteAvoiding, records[0].method);
+  EXPECT_EQ((std::vector<std::string>{"0", "9", "barriers"}), records[0].object_ids);
+  EXPECT_EQ((std::vector<double>{1., 5.}), records[0].parameters);
+  EXPECT_EQ(std::vector<std::string>{"4"}, records[0].predicate_ids);
+  EXPECT_EQ(std::vector<std::string>{"detour"}, records[0].result_ids);
+
+  const ReplayReport report = Replay(records, &object_book_, &object_query);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+}
+
+TEST_F(QueryRecordingTest, FindNearestNeighborsAndFindLaneClearances) {
+  const api::Object<Vector3>* object = object_book_.FindById(api::Object<Vector3>::Id("1"));
+  const api::Object<Vector3>* neighbor = object_book_.FindById(api::Object<Vector3>::Id("2"));
+  const std::unique_ptr<maliput::api::Lane> lane = maliput::api::test::CreateLane(LaneId("lane"));
+  test_utilities::MockObjectQuery object_query;
+  EXPECT_CALL(object_query, DoFindNearestNeighbors(std::vector<const api::Object<Vector3>*>{object}, 3, 10.))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(std::vector<std::vector<api::ObjectDistance>>{{{neighbor, 1.}}}));
+  EXPECT_CALL(object_query, DoFindLaneClearances(std::vector<const api::Object<Vector3>*>{object}, 4.))
+      .Times(2)
+      .WillRepeatedly(::testing::Return(std::vector<std::vector<api::LaneClearance>>{{{lane.get(), 1., 2.}}}));
+  {
+    QueryRecorder recorder(filename_);
+    const RecordingObjectQuery dut(&object_query, &recorder);
+    EXPECT_EQ(1u, dut.FindNearestNeighbors(object, 3, 10.).size());
+    EXPECT_EQ(1u, dut.FindLaneClearances(object, 4.).size());
+  }
+  const std::vector<QueryRecord> records = ReadQueryRecording(filename_);
+  ASSERT_EQ(2u, records.size());
+  EXPECT_EQ(QueryRecord::Method::kFindNearestNeighbors, records[0].method);
+  EXPECT_EQ(std::vector<std::string>{"1"}, records[0].object_ids);
+  EXPECT_EQ((std::vector<double>{3., 10.}), records[0].parameters);
+  EXPECT_EQ(std::vector<std::string>{"2"}, records[0].result_ids);
+  EXPECT_EQ(QueryRecord::Method::kFindLaneClearances, records[1].method);
+  EXPECT_EQ(std::vector<std::string>{"1"}, records[1].object_ids);
+  EXPECT_EQ(std::vector<double>{4.}, records[1].parameters);
+  EXPECT_EQ(std::vector<std::string>{"lane"}, records[1].result_ids);
+
+  const ReplayReport report = Replay(records, &object_book_, &object_query);
+  EXPECT_TRUE(report.mismatched_records.empty());
+  EXPECT_EQ(0, report.num_skipped);
+  object_book_.RemoveObject(api::Object<Vector3>::Id("1"));
+  EXPECT_EQ(2, Replay(records, &object_book_, &object_query).num_skipped);
+}
+
+TEST_F(QueryRecordingTest, ReplayOnAModifiedBook) {
+  RecordCalls();
+  object_book_.RemoveObject(api::Object<Vector3>::Id("2"));
+  const ReplayReport report = Replay(ReadQueryRecording(filename_), &object_book_, nullptr);
+  // objects(), FindByPredicate() and FindOverlappingIn() miss the removed object.
+  EXPECT_EQ((std::vector<std::size_t>{0, 3, 4}), report.mismatched_records);
+  EXPECT_EQ(1, report.methods.at(QueryRecord::Method::kFindOverlappingIn).num_mismatches);
+}
+
+TEST_F(QueryRecordingTest, Throws) {
+  EXPECT_THROW(QueryRecorder(::testing::TempDir() + "non_existent_directory/recording.rec"),
+               maliput::common::assertion_error);
+  EXPECT_THROW(ReadQueryRecording(::testing::TempDir() + "non_existent.rec"), maliput::common::assertion_error);
+  {
+    std::ofstream file(filename_);
+    file << "not a recording";
+  }
+  EXPECT_THROW(ReadQueryRecording(filename_), maliput::common::assertion_error);
+  QueryRecorder recorder(filename_);
+  EXPECT_THROW(RecordingObjectBook(nullptr, &recorder), maliput::common::assertion_error);
+  EXPECT_THROW(RecordingObjectBook(&object_book_, nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(Replay({}, nullptr, nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(Replay({}, &object_book_, nullptr, 0), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
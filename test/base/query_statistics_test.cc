@@ -0,0 +1,174 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/query_statistics.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::OverlappingType;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+class QueryStatisticsTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    for (int i = 0; i < kNumObjects; ++i) {
+      object_book_.AddObject(std::make_unique<api::Object<Vector3>>(
+          api::Object<Vector3>::Id(std::to_string(i)), std::map<std::string, std::string>{},
+          std::make_unique<BoundingBox>(Vector3(2. * i, 0., 0.), Vector3(1., 1., 1.), RollPitchYaw(0., 0., 0.),
+                                        kTolerance)));
+    }
+    object_book_.AddObjects({});
+    ResetQueryStatistics();
+  }
+
+  void TearDown() override { EnableQueryStatistics(false); }
+
+  static constexpr int kNumObjects{100};
+  ManualObjectBook<Vector3> object_book_;
+};
+
+TEST_F(QueryStatisticsTest, DisabledByDefault) {
+  EXPECT_FALSE(QueryStatisticsEnabled());
+  object_book_.FindById(api::Object<Vector3>::Id("1"));
+  EXPECT_TRUE(GetQueryStatistics().methods.empty());
+}
+
+TEST_F(QueryStatisticsTest, CollectsCallStatistics) {
+  EnableQueryStatistics(true);
+  EXPECT_TRUE(QueryStatisticsEnabled());
+  object_book_.FindById(api::Object<Vector3>::Id("1"));
+  object_book_.FindById(api::Object<Vector3>::Id("unknown"));
+  object_book_.FindByPredicate([](const api::Object<Vector3>*) { return false; });
+  const BoundingBox region(Vector3(3., 0., 0.), Vector3(4., 1., 1.), RollPitchYaw(0., 0., 0.), kTolerance);
+  object_book_.FindOverlappingIn(region, OverlappingType::kIntersected);
+
+  const QueryStatistics statistics = GetQueryStatistics();
+  ASSERT_EQ(3u, statistics.methods.size());
+  const QueryStatistics::MethodStatistics& find_by_id = statistics.methods.at(QueryRecord::Method::kFindById);
+  EXPECT_EQ(2u, find_by_id.num_calls);
+  EXPECT_EQ(1u, find_by_id.results_returned);
+  std::uint64_t histogram_calls{0};
+  for (const std::uint64_t count : find_by_id.latency_histogram) {
+    histogram_calls += count;
+  }
+  EXPECT_EQ(2u, histogram_calls);
+  EXPECT_GT(find_by_id.latency_percentile(100.), std::chrono::nanoseconds{0});
+  EXPECT_GE(find_by_id.latency_percentile(100.), find_by_id.latency_percentile(50.));
+
+  const QueryStatistics::MethodStatistics& find_by_predicate =
+      statistics.methods.at(QueryRecord::Method::kFindByPredicate);
+  EXPECT_EQ(static_cast<std::uint64_t>(kNumObjects), find_by_predicate.candidates_examined);
+  EXPECT_EQ(0u, find_by_predicate.results_returned);
+
+  // The index prunes most of the objects.
+  const QueryStatistics::MethodStatistics& find_overlapping_in =
+      statistics.methods.at(QueryRecord::Method::kFindOverlappingIn);
+  EXPECT_EQ(2u, find_overlapping_in.results_returned);
+  EXPECT_GE(find_overlapping_in.candidates_examined, 2u);
+  EXPECT_LT(find_overlapping_in.candidates_examined, static_cast<std::uint64_t>(kNumObjects));
+
+  ResetQueryStatistics();
+  EXPECT_TRUE(GetQueryStatistics().methods.empty());
+}
+
+TEST_F(QueryStatisticsTest, AggregatesThreads) {
+  EnableQueryStatistics(true);
+  constexpr int kNumThreads{4};
+  constexpr int kNumCalls{50};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([this]() {
+      for (int j = 0; j < kNumCalls; ++j) {
+        object_book_.FindById(api::Object<Vector3>::Id(std::to_string(j)));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  object_book_.FindById(api::Object<Vector3>::Id("1"));
+  // Counters of the exited threads are kept.
+  EXPECT_EQ(static_cast<std::uint64_t>(kNumThreads * kNumCalls + 1),
+            GetQueryStatistics().methods.at(QueryRecord::Method::kFindById).num_calls);
+}
+
+TEST(QueryStatisticsScopeTest, CacheHitRatio) {
+  EnableQueryStatistics(true);
+  ResetQueryStatistics();
+  {
+    QueryStatisticsScope dut(QueryRecord::Method::kFindOverlappingLanesIn);
+    dut.AddCacheLookup(true);
+    dut.AddCacheLookup(true);
+    dut.AddCacheLookup(true);
+    dut.AddCacheLookup(false);
+    dut.AddCandidates(7);
+    dut.SetResults(3);
+  }
+  EnableQueryStatistics(false);
+  const QueryStatistics::MethodStatistics& statistics =
+      GetQueryStatistics().methods.at(QueryRecord::Method::kFindOverlappingLanesIn);
+  EXPECT_EQ(1u, statistics.num_calls);
+  EXPECT_EQ(3u, statistics.cache_hits);
+  EXPECT_EQ(1u, statistics.cache_misses);
+  EXPECT_DOUBLE_EQ(0.75, statistics.cache_hit_ratio());
+  EXPECT_EQ(7u, statistics.candidates_examined);
+  EXPECT_EQ(3u, statistics.results_returned);
+  EXPECT_THROW(statistics.latency_percentile(101.), maliput::common::assertion_error);
+  EXPECT_DOUBLE_EQ(0., QueryStatistics::MethodStatistics{}.cache_hit_ratio());
+  EXPECT_EQ(std::chrono::nanoseconds{0}, QueryStatistics::MethodStatistics{}.latency_percentile(50.));
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,243 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/shared_memory_object_book.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/test_utilities/mock_math.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::OverlappingType;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+std::vector<std::string> SortedIds(const std::vector<api::Object<Vector3>*>& objects) {
+  std::vector<std::string> ids;
+  std::transform(objects.begin(), objects.end(), std::back_inserter(ids),
+                 [](const api::Object<Vector3>* object) { return object->id().string(); });
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+class SharedMemoryObjectBookTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // A 10 x 10 grid of unit boxes, 2 meters apart from each other, that share their properties.
+    std::vector<std::unique_ptr<api::Object<Vector3>>> objects;
+    for (int i = 0; i < kGridSize; ++i) {
+      for (int j = 0; j < kGridSize; ++j) {
+        objects.push_back(std::make_unique<api::Object<Vector3>>(
+            api::Object<Vector3>::Id(std::to_string(i) + "_" + std::to_string(j)),
+            std::map<std::string, std::string>{{"type", "cone"}, {"row", std::to_string(i)}},
+            std::make_unique<BoundingBox>(Vector3(2. * i, 2. * j, 0.), Vector3(1., 1., 1.), RollPitchYaw(0., 0., 0.3),
+                                          kTolerance)));
+      }
+    }
+    object_book_.AddObjects(std::move(objects));
+    SharedMemoryObjectBook::Write(filename_, object_book_, kTolerance);
+  }
+
+  void TearDown() override { std::remove(filename_.c_str()); }
+
+  static constexpr int kGridSize{10};
+  const std::string filename_{::testing::TempDir() + "shared_memory_object_book_test.bin"};
+  ManualObjectBook<Vector3> object_book_{kTolerance};
+};
+
+TEST_F(SharedMemoryObjectBookTest, Objects) {
+  const SharedMemoryObjectBook dut(filename_);
+  EXPECT_GT(dut.mapped_size(), 0u);
+  const auto objects = dut.objects();
+  ASSERT_EQ(object_book_.objects().size(), objects.size());
+  for (const auto& id_object : object_book_.objects()) {
+    const api::Object<Vector3>* object = dut.FindById(id_object.first);
+    ASSERT_NE(nullptr, object);
+    EXPECT_EQ(objects.at(id_object.first), object);
+    EXPECT_EQ(id_object.second->get_properties(), object->get_properties());
+    const auto* bounding_box = dynamic_cast<const BoundingBox*>(&object->bounding_region());
+    ASSERT_NE(nullptr, bounding_box);
+    EXPECT_EQ(id_object.second->position(), bounding_box->position());
+    EXPECT_EQ(Vector3(1., 1., 1.), bounding_box->box_size());
+    EXPECT_DOUBLE_EQ(0.3, bounding_box->get_orientation().yaw_angle());
+  }
+  EXPECT_EQ(nullptr, dut.FindById(api::Object<Vector3>::Id("unknown")));
+  EXPECT_EQ(kGridSize, static_cast<int>(dut.FindByPredicate([](const api::Object<Vector3>* object) {
+                                             return object->get_property("row") == "3";
+                                           }).size()));
+}
+
+TEST_F(SharedMemoryObjectBookTest, FindOverlappingInMatchesManualObjectBook) {
+  const SharedMemoryObjectBook dut(filename_);
+  const std::vector<BoundingBox> regions{
+      {{0., 0., 0.}, {100., 100., 100.}, {0., 0., 0.}, kTolerance},
+      {{100., 100., 100.}, {1., 1., 1.}, {0., 0., 0.}, kTolerance},
+      {{6., 6., 0.}, {5., 3., 1.}, {0., 0., 0.7}, kTolerance},
+      {{4., 4., 0.}, {0.5, 0.5, 0.5}, {0., 0., 0.}, kTolerance},
+  };
+  for (const auto& region : regions) {
+    for (const OverlappingType overlapping_type :
+         {OverlappingType::kIntersected, OverlappingType::kContained, OverlappingType::kDisjointed}) {
+      EXPECT_EQ(SortedIds(object_book_.FindOverlappingIn(region, overlapping_type)),
+                SortedIds(dut.FindOverlappingIn(region, overlapping_type)));
+    }
+  }
+}
+
+TEST_F(SharedMemoryObjectBookTest, FindNearestAndWithinDistanceMatchManualObjectBook) {
+  const SharedMemoryObjectBook dut(filename_);
+  const auto ids = [](const std::vector<api::Object<Vector3>*>& objects) {
+    std::vector<std::string> ids;
+    for (const auto* object : objects) {
+      ids.push_back(object->id().string());
+    }
+    return ids;
+  };
+  const auto row_3 = [](const api::Object<Vector3>* object) { return object->get_property("row") == "3"; };
+  for (const Vector3& position : {Vector3(0., 0., 0.), Vector3(7.3, 4.1, 0.5), Vector3(-20., 50., 3.)}) {
+    for (const int k : {0, 1, 5, 2 * kGridSize * kGridSize}) {
+      EXPECT_EQ(ids(object_book_.FindNearest(position, k)), ids(dut.FindNearest(position, k)));
+      EXPECT_EQ(ids(object_book_.FindNearest(position, k, row_3)), ids(dut.FindNearest(position, k, row_3)));
+    }
+    for (const double radius : {0., 1., 4.5, 100.}) {
+      EXPECT_EQ(ids(object_book_.FindWithinDistance(position, radius)), ids(dut.FindWithinDistance(position, radius)));
+    }
+  }
+  EXPECT_EQ(std::vector<std::string>({"4_2", "3_2", "4_3"}), ids(dut.FindNearest(Vector3(7.3, 4.1, 0.5), 3)));
+}
+
+TEST_F(SharedMemoryObjectBookTest, RayCastAndFindInFrustumMatchManualObjectBook) {
+  const SharedMemoryObjectBook dut(filename_);
+  const auto to_pairs = [](const std::vector<api::RayHit<Vector3>>& hits) {
+    std::vector<std::pair<std::string, double>> pairs;
+    for (const auto& hit : hits) {
+      pairs.emplace_back(hit.object->id().string(), hit.distance);
+    }
+    return pairs;
+  };
+  std::vector<api::Ray<Vector3>> rays;
+  for (int i = 0; i < 80; ++i) {
+    const double angle = M_PI / 2. * i / 79.;
+    rays.push_back({{-1., -1., 0.2}, {std::cos(angle), std::sin(angle), 0.}, 5. + 0.25 * i});
+  }
+  rays.push_back({{4., 4., 10.}, {0., 0., -1.}, 20.});
+  for (const auto& ray : rays) {
+    EXPECT_EQ(to_pairs(object_book_.RayCastAll(ray.origin, ray.direction, ray.max_range)),
+              to_pairs(dut.RayCastAll(ray.origin, ray.direction, ray.max_range)));
+  }
+  const std::vector<std::optional<api::RayHit<Vector3>>> expected_hits = object_book_.RayCast(rays);
+  const std::vector<std::optional<api::RayHit<Vector3>>> hits = dut.RayCast(rays);
+  ASSERT_EQ(expected_hits.size(), hits.size());
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    ASSERT_EQ(expected_hits[i].has_value(), hits[i].has_value());
+    if (hits[i].has_value()) {
+      EXPECT_EQ(expected_hits[i]->object->id(), hits[i]->object->id());
+      EXPECT_EQ(expected_hits[i]->distance, hits[i]->distance);
+    }
+  }
+  EXPECT_EQ("2_2", hits.back()->object->id().string());
+
+  // A square pyramid looking down from above the center of the grid.
+  const api::Frustum<Vector3> kFrustum{{{Vector3{1., 0., -1.}.normalized(), 0.},
+                                        {Vector3{-1., 0., -1.}.normalized(), 18. / std::sqrt(2.)},
+                                        {Vector3{0., 1., -1.}.normalized(), 0.},
+                                        {Vector3{0., -1., -1.}.normalized(), 18. / std::sqrt(2.)}}};
+  const api::Frustum<Vector3> kShifted{{{Vector3{1., 0., -1.}.normalized(), -5.}}};
+  for (const auto& frustum : {kFrustum, kShifted}) {
+    EXPECT_EQ(SortedIds(object_book_.FindInFrustum(frustum)), SortedIds(dut.FindInFrustum(frustum)));
+  }
+}
+
+TEST_F(SharedMemoryObjectBookTest, SeveralAttachedBooks) {
+  const SharedMemoryObjectBook dut_a(filename_);
+  const SharedMemoryObjectBook dut_b(filename_);
+  // Rewriting the file does not affect attached books.
+  ManualObjectBook<Vector3> empty_book;
+  SharedMemoryObjectBook::Write(filename_, empty_book);
+  const SharedMemoryObjectBook dut_c(filename_);
+  const api::Object<Vector3>::Id id{"3_4"};
+  ASSERT_NE(nullptr, dut_a.FindById(id));
+  ASSERT_NE(nullptr, dut_b.FindById(id));
+  EXPECT_NE(dut_a.FindById(id), dut_b.FindById(id));
+  EXPECT_EQ(dut_a.FindById(id)->get_properties(), dut_b.FindById(id)->get_properties());
+  EXPECT_TRUE(dut_c.objects().empty());
+  const BoundingBox region{{4., 4., 0.}, {100., 100., 100.}, {0., 0., 0.}, kTolerance};
+  EXPECT_TRUE(dut_c.FindOverlappingIn(region, OverlappingType::kIntersected).empty());
+}
+
+TEST_F(SharedMemoryObjectBookTest, Throws) {
+  EXPECT_THROW(SharedMemoryObjectBook::Write(filename_, object_book_, -1.), maliput::common::assertion_error);
+  EXPECT_THROW(SharedMemoryObjectBook(filename_ + ".unknown"), maliput::common::assertion_error);
+
+  // Truncated file.
+  {
+    std::ifstream input(filename_, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    std::ofstream output(filename_, std::ios::binary | std::ios::trunc);
+    output.write(contents.data(), contents.size() / 2);
+  }
+  EXPECT_THROW(SharedMemoryObjectBook{filename_}, maliput::common::assertion_error);
+
+  // Not a bounding box.
+  ManualObjectBook<Vector3> object_book;
+  object_book.AddObject(std::make_unique<api::Object<Vector3>>(api::Object<Vector3>::Id("unbounded"),
+                                                               std::map<std::string, std::string>{},
+                                                               std::make_unique<test_utilities::MockBoundingRegion>()));
+  EXPECT_THROW(SharedMemoryObjectBook::Write(filename_, object_book), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
@@ -29,15 +29,26 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_object/base/simple_object_query.h"
 
+#include <cmath>
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <maliput/api/road_network.h>
 #include <maliput/common/assertion_error.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
 #include <maliput/test_utilities/mock.h>
 
 #include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
 #include "maliput_object/test_utilities/mock.h"
+#include "maliput_object/test_utilities/mock_math.h"
 
 namespace maliput {
 namespace object {
@@ -63,6 +74,134 @@ TEST_F(SimpleObjectQueryTest, Getters) {
   EXPECT_EQ(object_book_.get(), dut.object_book());
 }
 
+TEST_F(SimpleObjectQueryTest, FindObjectsOnLaneWithLaneObjectIndex) {
+  EXPECT_THROW(SimpleObjectQuery(road_network_.get(), object_book_.get(), nullptr), maliput::common::assertion_error);
+  const api::Object<maliput::math::Vector3> object{
+      api::Object<maliput::math::Vector3>::Id("object"), {}, std::make_unique<test_utilities::MockBoundingRegion>()};
+  auto lane_object_index = std::make_shared<LaneObjectIndex>();
+  const maliput::api::LaneId kLaneId{"lane"};
+  lane_object_index->Update(&object, {LaneFootprint{kLaneId, {}, 10., 15., -1., 1.}});
+  const SimpleObjectQuery dut(road_network_.get(), object_book_.get(), lane_object_index);
+  EXPECT_EQ(std::vector<const api::Object<maliput::math::Vector3>*>{&object},
+            dut.FindObjectsOnLane(kLaneId, maliput::api::SRange(0., 12.)));
+  EXPECT_TRUE(dut.FindObjectsOnLane(kLaneId, maliput::api::SRange(16., 20.)).empty());
+  // Updates of the index are seen by the query.
+  lane_object_index->Update(&object, {LaneFootprint{kLaneId, {}, 17., 18., -1., 1.}});
+  EXPECT_EQ(std::vector<const api::Object<maliput::math::Vector3>*>{&object},
+            dut.FindObjectsOnLane(kLaneId, maliput::api::SRange(16., 20.)));
+  EXPECT_GT(dut.MemoryUsage().index, 0u);
+}
+
+TEST_F(SimpleObjectQueryTest, FindFreeGapsWithLaneObjectIndex) {
+  const auto make_object = [](const std::string& id) {
+    return std::make_unique<api::Object<maliput::math::Vector3>>(
+        api::Object<maliput::math::Vector3>::Id(id), std::map<std::string, std::string>{},
+        std::make_unique<test_utilities::MockBoundingRegion>());
+  };
+  const auto first = make_object("first");
+  const auto overlapping_first = make_object("overlapping_first");
+  const auto within_first = make_object("within_first");
+  const auto second = make_object("second");
+  const maliput::api::LaneId kLaneId{"lane"};
+  auto lane_object_index = std::make_shared<LaneObjectIndex>();
+  lane_object_index->Update(first.get(), {LaneFootprint{kLaneId, {}, 10., 20., -1., 1.}});
+  lane_object_index->Update(overlapping_first.get(), {LaneFootprint{kLaneId, {}, 15., 25., 1., 2.}});
+  lane_object_index->Update(within_first.get(), {LaneFootprint{kLaneId, {}, 12., 14., -1., 1.}});
+  lane_object_index->Update(second.get(), {LaneFootprint{kLaneId, {}, 28., 30., -1., 1.}});
+  const SimpleObjectQuery dut(road_network_.get(), object_book_.get(), lane_object_index);
+
+  const auto expect_gaps = [](const std::vector<std::pair<double, double>>& expected,
+                              const std::vector<maliput::api::SRange>& gaps) {
+    ASSERT_EQ(expected.size(), gaps.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_DOUBLE_EQ(expected[i].first, gaps[i].s0());
+      EXPECT_DOUBLE_EQ(expected[i].second, gaps[i].s1());
+    }
+  };
+  expect_gaps({{0., 10.}, {25., 28.}, {30., 50.}}, dut.FindFreeGaps(kLaneId, maliput::api::SRange(0., 50.), 0.));
+  expect_gaps({{0., 10.}, {30., 50.}}, dut.FindFreeGaps(kLaneId, maliput::api::SRange(50., 0.), 5.));
+  // Gaps are clipped to the range.
+  expect_gaps({{26., 28.}, {30., 32.}}, dut.FindFreeGaps(kLaneId, maliput::api::SRange(26., 32.), 1.));
+  expect_gaps({}, dut.FindFreeGaps(kLaneId, maliput::api::SRange(16., 22.), 0.));
+  expect_gaps({{0., 100.}}, dut.FindFreeGaps(maliput::api::LaneId("empty"), maliput::api::SRange(0., 100.), 10.));
+}
+
+TEST_F(SimpleObjectQueryTest, FindObjectsAlongRouteWithLaneObjectIndex) {
+  const auto make_object = [](const std::string& id) {
+    return std::make_unique<api::Object<maliput::math::Vector3>>(
+        api::Object<maliput::math::Vector3>::Id(id), std::map<std::string, std::string>{},
+        std::make_unique<test_utilities::MockBoundingRegion>());
+  };
+  const auto before_route = make_object("before_route");
+  const auto on_a = make_object("on_a");
+  const auto on_b = make_object("on_b");
+  const auto on_a_and_b = make_object("on_a_and_b");
+  const auto after_route = make_object("after_route");
+  const maliput::api::LaneId kLaneA{"a"};
+  const maliput::api::LaneId kLaneB{"b"};
+  auto lane_object_index = std::make_shared<LaneObjectIndex>();
+  lane_object_index->Update(before_route.get(), {LaneFootprint{kLaneA, {}, 1., 4., -1., 1.}});
+  lane_object_index->Update(on_a.get(), {LaneFootprint{kLaneA, {}, 20., 25., -1., 1.}});
+  lane_object_index->Update(on_b.get(), {LaneFootprint{kLaneB, {}, 12., 15., -1., 1.}});
+  lane_object_index->Update(on_a_and_b.get(), {LaneFootprint{kLaneA, {}, 45., 60., -1., 1.},
+                                               LaneFootprint{kLaneB, {}, 28., 35., -1., 1.}});
+  lane_object_index->Update(after_route.get(), {LaneFootprint{kLaneB, {}, 0., 5., -1., 1.}});
+  const SimpleObjectQuery dut(road_network_.get(), object_book_.get(), lane_object_index);
+
+  // Along "a" from s = 5 to s = 50, then along "b" backwards from s = 30 to s = 10.
+  const maliput::api::LaneSRoute route({maliput::api::LaneSRange(kLaneA, maliput::api::SRange(5., 50.)),
+                                        maliput::api::LaneSRange(kLaneB, maliput::api::SRange(30., 10.))});
+  const std::vector<api::ObjectAlongRoute> objects = dut.FindObjectsAlongRoute(route, 0.);
+  ASSERT_EQ(3u, objects.size());
+  EXPECT_EQ(on_a.get(), objects[0].object);
+  EXPECT_DOUBLE_EQ(15., objects[0].route_s);
+  EXPECT_EQ(on_a_and_b.get(), objects[1].object);
+  EXPECT_DOUBLE_EQ(40., objects[1].route_s);
+  EXPECT_EQ(on_b.get(), objects[2].object);
+  EXPECT_DOUBLE_EQ(60., objects[2].route_s);
+  EXPECT_TRUE(dut.FindObjectsAlongRoute(maliput::api::LaneSRoute(), 0.).empty());
+  EXPECT_THROW(dut.FindObjectsAlongRoute(route, -1.), maliput::common::assertion_error);
+}
+
+TEST_F(SimpleObjectQueryTest, FindNearestNeighbors) {
+  using maliput::math::Vector3;
+  const auto make_box_object = [](const std::string& id, const Vector3& position, const Vector3& box_size) {
+    return std::make_unique<api::Object<Vector3>>(
+        api::Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+        std::make_unique<maliput::math::BoundingBox>(position, box_size, maliput::math::RollPitchYaw{}, 1e-3));
+  };
+  ManualObjectBook<Vector3> object_book;
+  object_book.AddObject(make_box_object("a", {0., 0., 0.}, {2., 2., 2.}));
+  object_book.AddObject(make_box_object("b", {4., 0., 0.}, {2., 2., 2.}));
+  object_book.AddObject(make_box_object("c", {0., 3.5, 0.}, {2., 2., 2.}));
+  object_book.AddObject(make_box_object("far", {20., 0., 0.}, {2., 2., 2.}));
+  // Its position is far from "a", but its region is not.
+  object_book.AddObject(make_box_object("long", {0., -10., 0.}, {2., 16., 2.}));
+  const api::Object<Vector3>* a = object_book.FindById(api::Object<Vector3>::Id("a"));
+  const api::Object<Vector3>* b = object_book.FindById(api::Object<Vector3>::Id("b"));
+  const api::Object<Vector3>* long_object = object_book.FindById(api::Object<Vector3>::Id("long"));
+  const SimpleObjectQuery dut(road_network_.get(), &object_book);
+
+  const auto expect_neighbors = [](const std::vector<std::pair<std::string, double>>& expected,
+                                   const std::vector<api::ObjectDistance>& neighbors) {
+    ASSERT_EQ(expected.size(), neighbors.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i].first, neighbors[i].object->id().string());
+      EXPECT_NEAR(expected[i].second, neighbors[i].distance, 1e-9);
+    }
+  };
+  expect_neighbors({{"long", 1.}, {"c", 1.5}}, dut.FindNearestNeighbors(a, 2, 3.));
+  expect_neighbors({{"long", 1.}}, dut.FindNearestNeighbors(a, 1, 3.));
+  expect_neighbors({{"long", 1.}, {"c", 1.5}, {"b", 2.}}, dut.FindNearestNeighbors(a, 5, 3.));
+  expect_neighbors({{"a", 1.}}, dut.FindNearestNeighbors(long_object, 5, 1.5));
+  expect_neighbors({}, dut.FindNearestNeighbors(a, 0, 3.));
+
+  const std::vector<std::vector<api::ObjectDistance>> batch = dut.FindNearestNeighbors({a, b}, 2, 3.);
+  ASSERT_EQ(2u, batch.size());
+  expect_neighbors({{"long", 1.}, {"c", 1.5}}, batch[0]);
+  expect_neighbors({{"a", 2.}, {"long", std::sqrt(5.)}}, batch[1]);
+}
+
 // Route and FindOverlappingIn methods are easier to test via integration tests. They are tested at
 // maliput_integration_tests package.
 
@@ -0,0 +1,177 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/spatial_join.h"
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/base/manual_object_book.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::OverlappingType;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+std::unique_ptr<api::Object<Vector3>> MakeBoxObject(const std::string& id, const Vector3& position,
+                                                    const Vector3& box_size, double yaw) {
+  return std::make_unique<api::Object<Vector3>>(api::Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+                                                std::make_unique<BoundingBox>(position, box_size,
+                                                                              RollPitchYaw{0., 0., yaw}, kTolerance));
+}
+
+std::vector<std::pair<std::string, std::string>> ToIds(
+    const std::vector<std::pair<api::Object<Vector3>*, api::Object<Vector3>*>>& pairs) {
+  std::vector<std::pair<std::string, std::string>> ids;
+  for (const auto& pair : pairs) {
+    ids.emplace_back(pair.first->id().string(), pair.second->id().string());
+  }
+  return ids;
+}
+
+// Queries @p rhs with the region of every object of @p lhs.
+std::vector<std::pair<std::string, std::string>> BruteForce(const api::ObjectBook<Vector3>& lhs,
+                                                            const api::ObjectBook<Vector3>& rhs,
+                                                            OverlappingType overlapping_type) {
+  std::map<std::string, api::Object<Vector3>*> sorted_lhs;
+  for (const auto& id_object : lhs.objects()) {
+    sorted_lhs.emplace(id_object.first.string(), id_object.second);
+  }
+  std::vector<std::pair<std::string, std::string>> ids;
+  for (const auto& id_object : sorted_lhs) {
+    std::map<std::string, api::Object<Vector3>*> sorted_rhs;
+    for (api::Object<Vector3>* object : rhs.FindOverlappingIn(id_object.second->bounding_region(), overlapping_type)) {
+      sorted_rhs.emplace(object->id().string(), object);
+    }
+    for (const auto& rhs_id_object : sorted_rhs) {
+      ids.emplace_back(id_object.first, rhs_id_object.first);
+    }
+  }
+  return ids;
+}
+
+// Scatters small actors over large static objects.
+class SpatialJoinTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(0., 200.);
+    std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+    std::vector<std::unique_ptr<api::Object<Vector3>>> static_objects;
+    for (int i = 0; i < kNumStaticObjects; ++i) {
+      static_objects.push_back(MakeBoxObject("static_" + std::to_string(i),
+                                             {coordinate(generator), coordinate(generator), 0.}, {12., 6., 4.},
+                                             yaw(generator)));
+    }
+    static_book_.AddObjects(std::move(static_objects));
+    for (int i = 0; i < kNumActors; ++i) {
+      actor_book_.AddObject(MakeBoxObject("actor_" + std::to_string(i),
+                                          {coordinate(generator), coordinate(generator), 0.}, {1., 1., 1.},
+                                          yaw(generator)));
+    }
+  }
+
+  static constexpr int kNumStaticObjects{300};
+  static constexpr int kNumActors{500};
+  ManualObjectBook<Vector3> static_book_;
+  // Without spatial index, so the join builds one.
+  ManualObjectBook<Vector3> actor_book_;
+};
+
+TEST_F(SpatialJoinTest, MatchesBruteForce) {
+  ASSERT_NE(nullptr, static_book_.index());
+  ASSERT_EQ(nullptr, actor_book_.index());
+  for (const OverlappingType overlapping_type : {OverlappingType::kIntersected, OverlappingType::kContained}) {
+    const std::vector<std::pair<std::string, std::string>> expected =
+        BruteForce(actor_book_, static_book_, overlapping_type);
+    EXPECT_FALSE(expected.empty());
+    for (const int num_threads : {1, 4}) {
+      EXPECT_EQ(expected, ToIds(SpatialJoin(actor_book_, static_book_, overlapping_type, num_threads)));
+    }
+  }
+  // The other way around, both books with an index.
+  actor_book_.AddObjects({});
+  ASSERT_NE(nullptr, actor_book_.index());
+  EXPECT_EQ(BruteForce(static_book_, actor_book_, OverlappingType::kIntersected),
+            ToIds(SpatialJoin(static_book_, actor_book_, OverlappingType::kIntersected, 3)));
+}
+
+TEST_F(SpatialJoinTest, RemovedObjects) {
+  static_book_.RemoveObject(api::Object<Vector3>::Id("static_0"));
+  static_book_.RemoveObject(api::Object<Vector3>::Id("static_1"));
+  ASSERT_NE(nullptr, static_book_.index());
+  EXPECT_EQ(BruteForce(actor_book_, static_book_, OverlappingType::kIntersected),
+            ToIds(SpatialJoin(actor_book_, static_book_, OverlappingType::kIntersected, 2)));
+  // Objects added after the index was built are joined too.
+  static_book_.AddObject(MakeBoxObject("late", {100., 100., 0.}, {50., 50., 4.}, 0.));
+  EXPECT_EQ(nullptr, static_book_.index());
+  EXPECT_EQ(BruteForce(actor_book_, static_book_, OverlappingType::kIntersected),
+            ToIds(SpatialJoin(actor_book_, static_book_, OverlappingType::kIntersected, 2)));
+}
+
+TEST(SpatialJoinSmallTest, DisjointedAndThrows) {
+  ManualObjectBook<Vector3> lhs;
+  lhs.AddObject(MakeBoxObject("a", {0., 0., 0.}, {1., 1., 1.}, 0.));
+  ManualObjectBook<Vector3> rhs;
+  rhs.AddObject(MakeBoxObject("b", {0.5, 0., 0.}, {1., 1., 1.}, 0.));
+  rhs.AddObject(MakeBoxObject("c", {10., 0., 0.}, {1., 1., 1.}, 0.));
+  EXPECT_EQ((std::vector<std::pair<std::string, std::string>>{{"a", "b"}, {"a", "c"}}),
+            ToIds(SpatialJoin<Vector3>(lhs, rhs, OverlappingType::kDisjointed)));
+  EXPECT_EQ((std::vector<std::pair<std::string, std::string>>{{"a", "b"}}),
+            ToIds(SpatialJoin<Vector3>(lhs, rhs, OverlappingType::kIntersected)));
+  EXPECT_TRUE(SpatialJoin<Vector3>(lhs, ManualObjectBook<Vector3>(), OverlappingType::kIntersected).empty());
+  EXPECT_THROW(SpatialJoin<Vector3>(lhs, rhs, OverlappingType::kIntersected, -1), maliput::common::assertion_error);
+  EXPECT_THROW(SpatialJoin<Vector3>(lhs, rhs, OverlappingType::kIntersected, 1, -1.),
+               maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
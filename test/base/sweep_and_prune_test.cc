@@ -0,0 +1,230 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/sweep_and_prune.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/test_utilities/mock_math.h"
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::RollPitchYaw;
+using maliput::math::Vector3;
+
+constexpr double kTolerance{1e-3};
+
+using ObjectPair = std::pair<api::Object<Vector3>*, api::Object<Vector3>*>;
+
+std::unique_ptr<api::Object<Vector3>> MakeBoxObject(const std::string& id, const Vector3& position, double yaw) {
+  return std::make_unique<api::Object<Vector3>>(
+      api::Object<Vector3>::Id(id), std::map<std::string, std::string>{},
+      std::make_unique<BoundingBox>(position, Vector3{4., 2., 1.5}, RollPitchYaw{0., 0., yaw}, kTolerance));
+}
+
+std::vector<std::pair<std::string, std::string>> ToIds(const std::vector<ObjectPair>& pairs) {
+  std::vector<std::pair<std::string, std::string>> ids;
+  for (const ObjectPair& pair : pairs) {
+    ids.emplace_back(pair.first->id().string(), pair.second->id().string());
+  }
+  return ids;
+}
+
+// Checks every pair of @p objects.
+std::vector<std::pair<std::string, std::string>> BruteForce(const std::vector<api::Object<Vector3>*>& objects) {
+  std::map<std::string, api::Object<Vector3>*> sorted;
+  for (api::Object<Vector3>* object : objects) {
+    sorted.emplace(object->id().string(), object);
+  }
+  std::vector<std::pair<std::string, std::string>> ids;
+  for (auto lhs = sorted.begin(); lhs != sorted.end(); ++lhs) {
+    for (auto rhs = std::next(lhs); rhs != sorted.end(); ++rhs) {
+      if (lhs->second->bounding_region().Overlaps(rhs->second->bounding_region()) !=
+          maliput::math::OverlappingType::kDisjointed) {
+        ids.emplace_back(lhs->first, rhs->first);
+      }
+    }
+  }
+  return ids;
+}
+
+TEST(SweepAndPruneTest, Constructor) {
+  EXPECT_THROW(SweepAndPrune<Vector3>(-1.), maliput::common::assertion_error);
+  const SweepAndPrune<Vector3> dut(kTolerance);
+  EXPECT_EQ(0, dut.size());
+  EXPECT_TRUE(dut.FindOverlappingPairs().empty());
+  EXPECT_THROW(SweepAndPrune<Vector3>(kTolerance).Update({nullptr}), maliput::common::assertion_error);
+}
+
+TEST(SweepAndPruneTest, FindOverlappingPairs) {
+  const auto a = MakeBoxObject("a", {0., 0., 0.}, 0.);
+  const auto b = MakeBoxObject("b", {3., 0., 0.}, 0.);
+  const auto c = MakeBoxObject("c", {6., 0., 0.}, 0.);
+  // Its axis-aligned box overlaps the one of "c", but the box itself does not.
+  const auto d = MakeBoxObject("d", {9.5, 2.5, 0.}, M_PI / 4.);
+  SweepAndPrune<Vector3> dut(kTolerance);
+  dut.Update({d.get(), c.get(), b.get(), a.get()});
+  EXPECT_EQ(4, dut.size());
+  EXPECT_EQ(0, dut.axis());
+  int num_candidates{0};
+  dut.VisitCandidatePairs([&num_candidates](api::Object<Vector3>*, api::Object<Vector3>*) { ++num_candidates; });
+  EXPECT_EQ(3, num_candidates);
+  std::size_t num_confirmed_candidates{0};
+  EXPECT_EQ((std::vector<std::pair<std::string, std::string>>{{"a", "b"}, {"b", "c"}}),
+            ToIds(dut.FindOverlappingPairs(&num_confirmed_candidates)));
+  EXPECT_EQ(3u, num_confirmed_candidates);
+  EXPECT_EQ(ToIds(dut.FindOverlappingPairs()), ToIds(FindOverlappingPairs<Vector3>({a.get(), b.get(), c.get()}, 0.)));
+  EXPECT_GT(dut.MemoryUsage().index, 0u);
+}
+
+TEST(SweepAndPruneTest, UnboundedObjects) {
+  const auto a = MakeBoxObject("a", {0., 0., 0.}, 0.);
+  const auto b = MakeBoxObject("b", {10., 0., 0.}, 0.);
+  const api::Object<Vector3> unbounded(api::Object<Vector3>::Id("unbounded"), {},
+                                       std::make_unique<test_utilities::MockBoundingRegion>());
+  SweepAndPrune<Vector3> dut(kTolerance);
+  dut.Update({a.get(), b.get(), const_cast<api::Object<Vector3>*>(&unbounded)});
+  std::vector<ObjectPair> candidates;
+  dut.VisitCandidatePairs([&candidates](api::Object<Vector3>* lhs, api::Object<Vector3>* rhs) {
+    candidates.emplace_back(lhs, rhs);
+  });
+  ASSERT_EQ(2u, candidates.size());
+  EXPECT_EQ(&unbounded, candidates[0].first);
+  EXPECT_EQ(&unbounded, candidates[1].first);
+}
+
+// Moves, replaces, adds and removes objects across steps and checks that the incremental order matches a brute force
+// search at every step.
+TEST(SweepAndPruneTest, IncrementalUpdatesMatchBruteForce) {
+  constexpr int kNumObjects{200};
+  constexpr int kNumSteps{20};
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> coordinate(0., 100.);
+  std::uniform_real_distribution<double> step(-0.5, 0.5);
+  std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+  std::vector<Vector3> positions;
+  std::vector<double> yaws;
+  for (int i = 0; i < kNumObjects; ++i) {
+    positions.push_back({coordinate(generator), coordinate(generator), 0.});
+    yaws.push_back(yaw(generator));
+  }
+  SweepAndPrune<Vector3> dut(kTolerance);
+  for (int s = 0; s < kNumSteps; ++s) {
+    // Objects are immutable, so every step replaces them with new ones with the same ids.
+    std::vector<std::unique_ptr<api::Object<Vector3>>> owned;
+    std::vector<api::Object<Vector3>*> objects;
+    for (int i = 0; i < kNumObjects; ++i) {
+      positions[i] = positions[i] + Vector3{step(generator), step(generator), 0.};
+      // Drops a different subset of the objects every step.
+      if ((i + s) % 17 == 0) {
+        continue;
+      }
+      owned.push_back(MakeBoxObject("object_" + std::to_string(i), positions[i], yaws[i]));
+      objects.push_back(owned.back().get());
+    }
+    dut.Update(objects);
+    EXPECT_EQ(static_cast<int>(objects.size()), dut.size());
+    EXPECT_EQ(BruteForce(objects), ToIds(dut.FindOverlappingPairs()));
+  }
+}
+
+TEST(SweepAndPruneTest, InsertAndRemoveMatchBruteForce) {
+  constexpr int kNumObjects{100};
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> coordinate(0., 50.);
+  std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+  std::vector<std::unique_ptr<api::Object<Vector3>>> owned;
+  for (int i = 0; i < kNumObjects; ++i) {
+    owned.push_back(MakeBoxObject("object_" + std::to_string(i),
+                                  {coordinate(generator), coordinate(generator), 0.}, yaw(generator)));
+  }
+  SweepAndPrune<Vector3> dut(kTolerance);
+  // Builds half of the order at once and inserts the rest one at a time.
+  std::vector<api::Object<Vector3>*> objects;
+  for (int i = 0; i < kNumObjects / 2; ++i) {
+    objects.push_back(owned[i].get());
+  }
+  dut.Update(objects);
+  for (int i = kNumObjects / 2; i < kNumObjects; ++i) {
+    dut.Insert(owned[i].get());
+    objects.push_back(owned[i].get());
+  }
+  EXPECT_EQ(kNumObjects, dut.size());
+  EXPECT_EQ(BruteForce(objects), ToIds(dut.FindOverlappingPairs()));
+
+  for (int i = 0; i < kNumObjects; i += 3) {
+    EXPECT_TRUE(dut.Remove(owned[i]->id()));
+    objects.erase(std::find(objects.begin(), objects.end(), owned[i].get()));
+  }
+  EXPECT_FALSE(dut.Remove(owned[0]->id()));
+  EXPECT_EQ(static_cast<int>(objects.size()), dut.size());
+  EXPECT_EQ(BruteForce(objects), ToIds(dut.FindOverlappingPairs()));
+  EXPECT_THROW(dut.Insert(nullptr), maliput::common::assertion_error);
+}
+
+TEST(SweepAndPruneTest, InsertAndRemoveUnboundedObjects) {
+  const auto a = MakeBoxObject("a", {0., 0., 0.}, 0.);
+  api::Object<Vector3> unbounded(api::Object<Vector3>::Id("unbounded"), {},
+                                 std::make_unique<test_utilities::MockBoundingRegion>());
+  SweepAndPrune<Vector3> dut(kTolerance);
+  dut.Insert(a.get());
+  dut.Insert(&unbounded);
+  EXPECT_EQ(2, dut.size());
+  int num_candidates{0};
+  dut.VisitCandidatePairs([&num_candidates](api::Object<Vector3>*, api::Object<Vector3>*) { ++num_candidates; });
+  EXPECT_EQ(1, num_candidates);
+  EXPECT_TRUE(dut.Remove(unbounded.id()));
+  EXPECT_EQ(1, dut.size());
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
@@ -0,0 +1,114 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/base/tracing.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace object {
+namespace test {
+namespace {
+
+using ::testing::HasSubstr;
+using ::testing::Not;
+
+std::string ReadFile(const std::string& filename) {
+  std::ifstream file(filename);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  return ss.str();
+}
+
+int CountOccurrences(const std::string& text, const std::string& pattern) {
+  int count{0};
+  for (std::size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+    ++count;
+  }
+  return count;
+}
+
+class TracingTest : public ::testing::Test {
+ public:
+  const std::string filename_{::testing::TempDir() + "tracing_test.json"};
+};
+
+TEST_F(TracingTest, WritesChromeTraceEvents) {
+  EXPECT_FALSE(TracingActive());
+  { const TraceSpan ignored("before_start"); }
+  StartTracing(filename_);
+  EXPECT_TRUE(TracingActive());
+  {
+    const TraceSpan outer("outer");
+    { const TraceSpan inner("inner\"quoted\""); }
+    std::thread([]() { const TraceSpan other_thread("other_thread"); }).join();
+  }
+  StopTracing();
+  EXPECT_FALSE(TracingActive());
+  { const TraceSpan ignored("after_stop"); }
+
+  const std::string trace = ReadFile(filename_);
+  EXPECT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+  EXPECT_EQ(3, CountOccurrences(trace, "\"ph\":\"X\""));
+  EXPECT_THAT(trace, HasSubstr("\"name\":\"outer\""));
+  EXPECT_THAT(trace, HasSubstr("\"name\":\"inner\\\"quoted\\\"\""));
+  EXPECT_THAT(trace, HasSubstr("\"name\":\"other_thread\""));
+  EXPECT_THAT(trace, Not(HasSubstr("before_start")));
+  EXPECT_THAT(trace, Not(HasSubstr("after_stop")));
+}
+
+TEST_F(TracingTest, SpansOpenWhenTracingStopsAreDropped) {
+  StartTracing(filename_);
+  {
+    const TraceSpan dropped("dropped");
+    StopTracing();
+  }
+  EXPECT_THAT(ReadFile(filename_), Not(HasSubstr("dropped")));
+}
+
+TEST_F(TracingTest, Throws) {
+  EXPECT_THROW(StopTracing(), maliput::common::assertion_error);
+  EXPECT_THROW(StartTracing(::testing::TempDir() + "non_existent_directory/trace.json"),
+               maliput::common::assertion_error);
+  StartTracing(filename_);
+  EXPECT_THROW(StartTracing(filename_), maliput::common::assertion_error);
+  StopTracing();
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace object
+}  // namespace maliput
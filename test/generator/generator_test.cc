@@ -0,0 +1,173 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Woven by Toyota.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_object/generator/generator.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_object/api/object.h"
+#include "maliput_object/api/object_book.h"
+#include "maliput_object/loader/loader.h"
+
+namespace maliput {
+namespace object {
+namespace generator {
+namespace test {
+namespace {
+
+using maliput::math::BoundingBox;
+using maliput::math::Vector3;
+
+std::vector<const api::Object<Vector3>*> ToPointers(const std::vector<std::unique_ptr<api::Object<Vector3>>>& objects) {
+  std::vector<const api::Object<Vector3>*> pointers;
+  for (const auto& object : objects) {
+    pointers.push_back(object.get());
+  }
+  return pointers;
+}
+
+GeneratorConfig MakeConfig(SpatialDistribution spatial_distribution) {
+  GeneratorConfig config;
+  config.num_objects = 500;
+  config.seed = 3;
+  config.spatial_distribution = spatial_distribution;
+  config.region_min = {-50., 10., 0.};
+  config.region_max = {50., 60., 5.};
+  config.num_clusters = 3;
+  config.cluster_radius = 5.;
+  config.min_box_size = {1., 2., 3.};
+  config.max_box_size = {2., 3., 4.};
+  config.max_yaw = 0.5;
+  config.num_properties = 3;
+  config.property_cardinality = 2;
+  return config;
+}
+
+class GenerateObjectsTest : public ::testing::TestWithParam<SpatialDistribution> {};
+
+TEST_P(GenerateObjectsTest, RespectsTheConfiguration) {
+  const GeneratorConfig config = MakeConfig(GetParam());
+  const std::vector<std::unique_ptr<api::Object<Vector3>>> dut = GenerateObjects(config);
+  ASSERT_EQ(config.num_objects, static_cast<int>(dut.size()));
+  std::set<std::string> values;
+  for (int i = 0; i < config.num_objects; ++i) {
+    EXPECT_EQ("object_" + std::to_string(i), dut[i]->id().string());
+    const auto* bounding_box = dynamic_cast<const BoundingBox*>(&dut[i]->bounding_region());
+    ASSERT_NE(nullptr, bounding_box);
+    for (std::size_t j = 0; j < 3; ++j) {
+      EXPECT_LE(config.region_min[j], bounding_box->position()[j]);
+      EXPECT_GE(config.region_max[j], bounding_box->position()[j]);
+      EXPECT_LE(config.min_box_size[j], bounding_box->box_size()[j]);
+      EXPECT_GE(config.max_box_size[j], bounding_box->box_size()[j]);
+    }
+    EXPECT_GE(config.max_yaw, std::abs(bounding_box->get_orientation().yaw_angle()));
+    ASSERT_EQ(3u, dut[i]->get_properties().size());
+    for (const auto& property : dut[i]->get_properties()) {
+      values.insert(property.second);
+    }
+  }
+  EXPECT_EQ((std::set<std::string>{"value_0", "value_1"}), values);
+}
+
+TEST_P(GenerateObjectsTest, IsDeterministic) {
+  GeneratorConfig config = MakeConfig(GetParam());
+  const std::string document = ToYamlDocument(ToPointers(GenerateObjects(config)));
+  EXPECT_EQ(document, ToYamlDocument(ToPointers(GenerateObjects(config))));
+  config.seed = 4;
+  EXPECT_NE(document, ToYamlDocument(ToPointers(GenerateObjects(config))));
+}
+
+INSTANTIATE_TEST_CASE_P(GenerateObjectsTestGroup, GenerateObjectsTest,
+                        ::testing::Values(SpatialDistribution::kUniform, SpatialDistribution::kClustered));
+
+TEST(GenerateObjectsTest, Clustered) {
+  GeneratorConfig config = MakeConfig(SpatialDistribution::kClustered);
+  config.num_clusters = 1;
+  config.cluster_radius = 0.;
+  const std::vector<std::unique_ptr<api::Object<Vector3>>> dut = GenerateObjects(config);
+  for (const auto& object : dut) {
+    EXPECT_EQ(dut.front()->position(), object->position());
+  }
+}
+
+TEST(GenerateObjectsTest, Throws) {
+  const GeneratorConfig config = MakeConfig(SpatialDistribution::kUniform);
+  GeneratorConfig dut = config;
+  dut.num_objects = -1;
+  EXPECT_THROW(GenerateObjects(dut), maliput::common::assertion_error);
+  dut = config;
+  dut.region_max = {-60., 60., 5.};
+  EXPECT_THROW(GenerateObjects(dut), maliput::common::assertion_error);
+  dut = config;
+  dut.min_box_size = {3., 2., 3.};
+  EXPECT_THROW(GenerateObjects(dut), maliput::common::assertion_error);
+  dut = config;
+  dut.property_cardinality = 0;
+  EXPECT_THROW(GenerateObjects(dut), maliput::common::assertion_error);
+  dut = config;
+  dut.spatial_distribution = SpatialDistribution::kClustered;
+  dut.num_clusters = 0;
+  EXPECT_THROW(GenerateObjects(dut), maliput::common::assertion_error);
+  dut = config;
+  dut.spatial_distribution = SpatialDistribution::kAlongLanes;
+  EXPECT_THROW(GenerateObjects(dut), maliput::common::assertion_error);
+}
+
+TEST(ToYamlDocumentTest, RoundTrip) {
+  const std::vector<std::unique_ptr<api::Object<Vector3>>> objects =
+      GenerateObjects(MakeConfig(SpatialDistribution::kUniform));
+  const std::unique_ptr<api::ObjectBook<Vector3>> object_book = loader::Load(ToYamlDocument(ToPointers(objects)));
+  ASSERT_EQ(objects.size(), object_book->objects().size());
+  for (const auto& object : objects) {
+    const api::Object<Vector3>* loaded_object = object_book->FindById(object->id());
+    ASSERT_NE(nullptr, loaded_object);
+    EXPECT_EQ(object->get_properties(), loaded_object->get_properties());
+    const auto* bounding_box = dynamic_cast<const BoundingBox*>(&object->bounding_region());
+    const auto* loaded_bounding_box = dynamic_cast<const BoundingBox*>(&loaded_object->bounding_region());
+    ASSERT_NE(nullptr, loaded_bounding_box);
+    EXPECT_EQ(bounding_box->position(), loaded_bounding_box->position());
+    EXPECT_EQ(bounding_box->box_size(), loaded_bounding_box->box_size());
+    EXPECT_DOUBLE_EQ(bounding_box->get_orientation().yaw_angle(), loaded_bounding_box->get_orientation().yaw_angle());
+  }
+  EXPECT_THROW(ToYamlDocument({nullptr}), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace generator
+}  // namespace object
+}  // namespace maliput
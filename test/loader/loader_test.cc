@@ -30,12 +30,17 @@
 #include "maliput_object/loader/loader.h"
 
 #include <fstream>
+#include <future>
+#include <map>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
+#include <maliput/api/lane_data.h>
 #include <maliput/common/assertion_error.h>
 #include <maliput/math/bounding_box.h>
 #include <maliput/math/bounding_region.h>
@@ -46,6 +51,8 @@
 #include "maliput/common/filesystem.h"
 #include "maliput_object/api/object.h"
 #include "maliput_object/api/object_book.h"
+#include "maliput_object/base/manual_object_book.h"
+#include "maliput_object/base/object_lane_associations.h"
 
 namespace maliput {
 namespace object {
@@ -275,6 +282,225 @@ TEST(LoadFromStringTest, OneValidObject) {
   ObjectTestFeatures::TestObjectBook(object_book.get());
 }
 
+TEST(LoadFromStringTest, IndexReadyCallback) {
+  bool index_ready{false};
+  std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book = Load(
+      ObjectTestFeatures::GenerateYamlString(), LoadOptions{false, [&index_ready]() { index_ready = true; }});
+  EXPECT_TRUE(index_ready);
+  ObjectTestFeatures::TestObjectBook(object_book.get());
+}
+
+TEST(LoadFromStringTest, BuildIndexInBackground) {
+  std::promise<void> index_ready;
+  std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book =
+      Load(ObjectTestFeatures::GenerateYamlString(), LoadOptions{true, [&index_ready]() { index_ready.set_value(); }});
+  // The book answers queries whether the index is ready or not.
+  ObjectTestFeatures::TestObjectBook(object_book.get());
+  index_ready.get_future().wait();
+  ObjectTestFeatures::TestObjectBook(object_book.get());
+}
+
+TEST(LoadLaneAssociationsTest, NoLaneAssociations) {
+  EXPECT_FALSE(LoadLaneAssociations(ObjectTestFeatures::GenerateYamlString()).has_value());
+}
+
+TEST(LoadLaneAssociationsTest, RoundTrip) {
+  const ObjectLaneAssociations lane_associations{
+      "0123456789abcdef",
+      {{Object<maliput::math::Vector3>::Id(ObjectTestFeatures::kObjectId),
+        {LaneFootprint{maliput::api::LaneId("lane_1"), maliput::api::LanePosition(1., 2., 3.), 0.5, 1.5, 1., 3.},
+         LaneFootprint{maliput::api::LaneId("lane_2"), maliput::api::LanePosition(4., 5., 6.), 3.5, 4.5, 4., 6.}}},
+       {Object<maliput::math::Vector3>::Id("object_without_lanes"), {}}},
+      {{Object<maliput::math::Vector3>::Id(ObjectTestFeatures::kObjectId), "0011223344556677"}}};
+
+  const std::string yaml = AddLaneAssociations(ObjectTestFeatures::GenerateYamlString(), lane_associations);
+  // Objects are still loaded.
+  std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book = Load(yaml);
+  ObjectTestFeatures::TestObjectBook(object_book.get());
+
+  const std::optional<ObjectLaneAssociations> dut = LoadLaneAssociations(yaml);
+  ASSERT_TRUE(dut.has_value());
+  EXPECT_EQ(lane_associations.road_network_hash, dut->road_network_hash);
+  EXPECT_EQ(lane_associations.object_hashes, dut->object_hashes);
+  ASSERT_EQ(lane_associations.footprints.size(), dut->footprints.size());
+  for (const auto& id_footprints : lane_associations.footprints) {
+    const auto it = dut->footprints.find(id_footprints.first);
+    ASSERT_NE(dut->footprints.end(), it);
+    ASSERT_EQ(id_footprints.second.size(), it->second.size());
+    for (std::size_t i = 0; i < id_footprints.second.size(); ++i) {
+      const LaneFootprint& expected = id_footprints.second[i];
+      const LaneFootprint& footprint = it->second[i];
+      EXPECT_EQ(expected.lane_id, footprint.lane_id);
+      EXPECT_DOUBLE_EQ(expected.lane_position.s(), footprint.lane_position.s());
+      EXPECT_DOUBLE_EQ(expected.lane_position.r(), footprint.lane_position.r());
+      EXPECT_DOUBLE_EQ(expected.lane_position.h(), footprint.lane_position.h());
+      EXPECT_DOUBLE_EQ(expected.s_min, footprint.s_min);
+      EXPECT_DOUBLE_EQ(expected.s_max, footprint.s_max);
+      EXPECT_DOUBLE_EQ(expected.r_min, footprint.r_min);
+      EXPECT_DOUBLE_EQ(expected.r_max, footprint.r_max);
+    }
+  }
+
+  // Adding lane associations again replaces them.
+  const std::optional<ObjectLaneAssociations> replaced =
+      LoadLaneAssociations(AddLaneAssociations(yaml, ObjectLaneAssociations{"fedcba9876543210", {}, {}}));
+  ASSERT_TRUE(replaced.has_value());
+  EXPECT_EQ("fedcba9876543210", replaced->road_network_hash);
+  EXPECT_TRUE(replaced->footprints.empty());
+  EXPECT_TRUE(replaced->object_hashes.empty());
+}
+
+TEST(LoadLaneAssociationsTest, SchemaErrors) {
+  const std::vector<std::string> yamls_with_schema_errors{
+      // No road_network_hash.
+      R"R(---
+maliput_objects_lane_associations:
+  objects:
+    an_object: []
+)R",
+      // No objects.
+      R"R(---
+maliput_objects_lane_associations:
+  road_network_hash: 0123456789abcdef
+)R",
+      // Lanes must be a sequence.
+      R"R(---
+maliput_objects_lane_associations:
+  road_network_hash: 0123456789abcdef
+  objects:
+    an_object:
+      lane_id: lane_1
+)R",
+      // No lane_position.
+      R"R(---
+maliput_objects_lane_associations:
+  road_network_hash: 0123456789abcdef
+  objects:
+    an_object:
+      - lane_id: lane_1
+        s_range: [1., 2.]
+        r_range: [1., 2.]
+)R",
+      // Inverted s_range.
+      R"R(---
+maliput_objects_lane_associations:
+  road_network_hash: 0123456789abcdef
+  objects:
+    an_object:
+      - lane_id: lane_1
+        lane_position: [1., 2., 3.]
+        s_range: [2., 1.]
+        r_range: [1., 2.]
+)R",
+      // Object hashes must be a map.
+      R"R(---
+maliput_objects_lane_associations:
+  road_network_hash: 0123456789abcdef
+  objects:
+    an_object: []
+  object_hashes: [0123456789abcdef]
+)R",
+  };
+  for (const auto& yaml : yamls_with_schema_errors) {
+    EXPECT_THROW(LoadLaneAssociations(yaml), maliput::common::assertion_error) << yaml;
+  }
+}
+// Returns a document with one unit box per entry of @p objects, which maps object ids to their x coordinate.
+std::string GenerateBoxesYamlString(const std::map<std::string, double>& objects) {
+  std::stringstream ss;
+  ss << "maliput_objects:\n";
+  for (const auto& id_x : objects) {
+    ss << "  " << id_x.first << ":\n";
+    ss << "    bounding_region:\n";
+    ss << "      position: [" << id_x.second << ", 0., 0.]\n";
+    ss << "      rotation: [0., 0., 0.]\n";
+    ss << "      type: box\n";
+    ss << "      box_size: [1., 1., 1.]\n";
+    ss << "    properties:\n";
+    ss << "      a_key: a_value\n";
+  }
+  return ss.str();
+}
+
+TEST(ReloadTest, AppliesOnlyTheDifferences) {
+  std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book =
+      Load(GenerateBoxesYamlString({{"kept", 0.}, {"moved", 10.}, {"removed", 20.}}));
+  const Object<maliput::math::Vector3>* kept_object = object_book->FindById(Object<maliput::math::Vector3>::Id("kept"));
+  ASSERT_NE(nullptr, kept_object);
+
+  const ReloadResult dut =
+      Reload(GenerateBoxesYamlString({{"kept", 0.}, {"moved", 30.}, {"added", 40.}}), object_book.get());
+  EXPECT_EQ(std::vector<Object<maliput::math::Vector3>::Id>{Object<maliput::math::Vector3>::Id("added")}, dut.added);
+  EXPECT_EQ(std::vector<Object<maliput::math::Vector3>::Id>{Object<maliput::math::Vector3>::Id("removed")},
+            dut.removed);
+  EXPECT_EQ(std::vector<Object<maliput::math::Vector3>::Id>{Object<maliput::math::Vector3>::Id("moved")}, dut.changed);
+
+  ASSERT_EQ(3u, object_book->objects().size());
+  // Unchanged objects are not replaced.
+  EXPECT_EQ(kept_object, object_book->FindById(Object<maliput::math::Vector3>::Id("kept")));
+  EXPECT_EQ(nullptr, object_book->FindById(Object<maliput::math::Vector3>::Id("removed")));
+  EXPECT_DOUBLE_EQ(30., object_book->FindById(Object<maliput::math::Vector3>::Id("moved"))->position().x());
+  // Queries see the changes.
+  const BoundingBox region{{30., 0., 0.}, {1., 1., 1.}, {0., 0., 0.}, 1e-3};
+  const auto overlapping = object_book->FindOverlappingIn(region, maliput::math::OverlappingType::kIntersected);
+  ASSERT_EQ(1u, overlapping.size());
+  EXPECT_EQ(Object<maliput::math::Vector3>::Id("moved"), overlapping.front()->id());
+
+  // Reloading the same document changes nothing.
+  const ReloadResult no_changes =
+      Reload(GenerateBoxesYamlString({{"kept", 0.}, {"moved", 30.}, {"added", 40.}}), object_book.get());
+  EXPECT_TRUE(no_changes.added.empty());
+  EXPECT_TRUE(no_changes.removed.empty());
+  EXPECT_TRUE(no_changes.changed.empty());
+}
+
+TEST(ReloadTest, RebuildsTheIndexOnceItIsOutOfDate) {
+  std::map<std::string, double> objects;
+  for (int i = 0; i < 8; ++i) {
+    objects.emplace("object_" + std::to_string(i), 2. * i);
+  }
+  std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book = Load(GenerateBoxesYamlString(objects));
+  const auto* manual_object_book = dynamic_cast<const ManualObjectBook<maliput::math::Vector3>*>(object_book.get());
+  ASSERT_NE(nullptr, manual_object_book);
+  EXPECT_EQ(0, manual_object_book->num_stale_index_entries());
+
+  // Moving one object leaves the index out of date by the removed entry and the added object.
+  objects["object_0"] = 100.;
+  Reload(GenerateBoxesYamlString(objects), object_book.get());
+  EXPECT_EQ(2, manual_object_book->num_stale_index_entries());
+  EXPECT_EQ(nullptr, manual_object_book->index());
+
+  // Moving another one makes it exceed a quarter of the book.
+  objects["object_1"] = 102.;
+  Reload(GenerateBoxesYamlString(objects), object_book.get());
+  EXPECT_EQ(0, manual_object_book->num_stale_index_entries());
+  ASSERT_NE(nullptr, manual_object_book->index());
+  EXPECT_EQ(8, manual_object_book->index()->size());
+  const BoundingBox region{{101., 0., 0.}, {3., 1., 1.}, {0., 0., 0.}, 1e-3};
+  EXPECT_EQ(2u, object_book->FindOverlappingIn(region, maliput::math::OverlappingType::kIntersected).size());
+}
+
+TEST(ReloadTest, ChangedProperties) {
+  std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book = Load(ObjectTestFeatures::GenerateYamlString());
+  std::string input = ObjectTestFeatures::GenerateYamlString();
+  input.replace(input.find(ObjectTestFeatures::kValue), std::string(ObjectTestFeatures::kValue).size(), "new value");
+  const ReloadResult dut = Reload(input, object_book.get());
+  ASSERT_EQ(1u, dut.changed.size());
+  EXPECT_EQ("new value",
+            object_book->FindById(Object<maliput::math::Vector3>::Id(ObjectTestFeatures::kObjectId))
+                ->get_property(ObjectTestFeatures::kKey));
+}
+
+TEST(ReloadTest, Throws) {
+  std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book = Load(ObjectTestFeatures::GenerateYamlString());
+  EXPECT_THROW(Reload(ObjectTestFeatures::GenerateYamlString(), nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(Reload(GetYamlsWithSchemaErrors().back().yaml_under_test, object_book.get()),
+               maliput::common::assertion_error);
+  // A failed reload leaves the book untouched.
+  ObjectTestFeatures::TestObjectBook(object_book.get());
+}
+
+
 class LoadFromFileTest : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -306,6 +532,11 @@ class LoadFromFileTest : public ::testing::Test {
 TEST_F(LoadFromFileTest, EvaluateLoadFromFile) {
   std::unique_ptr<api::ObjectBook<maliput::math::Vector3>> object_book = LoadFile(filepath_);
   ObjectTestFeatures::TestObjectBook(object_book.get());
+  EXPECT_FALSE(LoadLaneAssociationsFile(filepath_).has_value());
+  const ReloadResult reload_result = ReloadFile(filepath_, object_book.get());
+  EXPECT_TRUE(reload_result.added.empty());
+  EXPECT_TRUE(reload_result.removed.empty());
+  EXPECT_TRUE(reload_result.changed.empty());
 }
 
 }  // namespace